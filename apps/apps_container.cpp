@@ -184,7 +184,11 @@ bool AppsContainer::processEvent(Ion::Events::Event event) {
        * pictogram. */
       updateBatteryState();
       switchToBuiltinApp(usbConnectedAppSnapshot());
+      /* The host can write into the storage: computing the checksum before
+       * and after DFU lets the storage rebuild its records index. */
+      Ion::Storage::FileSystem::sharedFileSystem->checksum();
       Ion::USB::DFU();
+      Ion::Storage::FileSystem::sharedFileSystem->checksum();
       // Update LED when exiting DFU mode
       Ion::LED::updateColorWithPlugAndCharge();
       switchToBuiltinApp(activeSnapshot);
@@ -15,6 +15,7 @@ CalculationSelectableTableView::CalculationSelectableTableView(
   setVerticalCellOverlap(0);
   setMargins(0);
   hideScrollBars();
+  setScrollByCopy(true);
 }
 
 void CalculationSelectableTableView::scrollToBottom() {
@@ -26,8 +27,13 @@ void CalculationSelectableTableView::scrollToBottom() {
 }
 
 void CalculationSelectableTableView::scrollToCell(int i, int j) {
+  KDPoint previousOffset = contentOffset();
   ::SelectableTableView::scrollToCell(i, j);
-  TableView::layoutSubviews();
+  /* Scrolling already layouted the table, doing it again would dirty the
+   * pixels moved by the scroll. */
+  if (contentOffset() == previousOffset) {
+    TableView::layoutSubviews();
+  }
   if (m_contentView.bounds().height() - contentOffset().y() <
       bounds().height()) {
     // Avoid empty space at the end of the table
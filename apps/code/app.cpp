@@ -127,12 +127,14 @@ void App::initPythonWithUser(const void *pythonUser) {
 
     char *heap = pythonHeap();
     MicroPython::init(heap, heap + k_pythonHeapSize);
+    MicroPython::registerCompiledModuleCache(&m_compiledModuleCache);
   }
   m_pythonUser = pythonUser;
 }
 
 void App::deinitPython() {
   if (m_pythonUser) {
+    MicroPython::registerCompiledModuleCache(nullptr);
     MicroPython::deinit();
     m_pythonUser = nullptr;
     /* Re-construct the tree pool, which might have been ovewritten by the heap.
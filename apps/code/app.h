@@ -88,6 +88,9 @@ class App : public Shared::InputEventHandlerDelegateApp {
   Escher::StackViewController m_codeStackViewController;
   PythonToolbox m_toolbox;
   VariableBoxController m_variableBoxController;
+  /* The compiled modules outlive the Python heap, which is reset each time
+   * MicroPython is initialized. */
+  MicroPython::CompiledModuleCache m_compiledModuleCache;
 #if PLATFORM_DEVICE
   /* On the device, we reach 64K of heap by repurposing the unused tree pool.
    * The linker must make sure that the pool and the apps buffer are
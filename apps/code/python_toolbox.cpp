@@ -370,6 +370,10 @@ constexpr ToolboxMessageTree KandinskyModuleChildren[] = {
                              I18n::Message::PythonGetPixel),
     ToolboxMessageTree::Leaf(I18n::Message::PythonCommandSetPixel,
                              I18n::Message::PythonSetPixel),
+    ToolboxMessageTree::Leaf(I18n::Message::PythonCommandGetPixels,
+                             I18n::Message::PythonGetPixels),
+    ToolboxMessageTree::Leaf(I18n::Message::PythonCommandSetPixels,
+                             I18n::Message::PythonSetPixels),
     ToolboxMessageTree::Leaf(I18n::Message::PythonCommandColor,
                              I18n::Message::PythonColor),
     ToolboxMessageTree::Leaf(I18n::Message::PythonCommandDrawString,
@@ -740,6 +744,8 @@ constexpr ToolboxMessageTree catalogChildren[] = {
                              I18n::Message::PythonGcd),
     ToolboxMessageTree::Leaf(I18n::Message::PythonCommandGetPixel,
                              I18n::Message::PythonGetPixel),
+    ToolboxMessageTree::Leaf(I18n::Message::PythonCommandGetPixels,
+                             I18n::Message::PythonGetPixels),
     ToolboxMessageTree::Leaf(I18n::Message::PythonCommandGetrandbits,
                              I18n::Message::PythonGetrandbits),
     ToolboxMessageTree::Leaf(I18n::Message::PythonTurtleCommandGoto,
@@ -935,6 +941,8 @@ constexpr ToolboxMessageTree catalogChildren[] = {
                              I18n::Message::PythonSeed),
     ToolboxMessageTree::Leaf(I18n::Message::PythonCommandSetPixel,
                              I18n::Message::PythonSetPixel),
+    ToolboxMessageTree::Leaf(I18n::Message::PythonCommandSetPixels,
+                             I18n::Message::PythonSetPixels),
     ToolboxMessageTree::Leaf(I18n::Message::PythonTurtleCommandSetheading,
                              I18n::Message::PythonTurtleSetheading),
     ToolboxMessageTree::Leaf(I18n::Message::PythonCommandShow,
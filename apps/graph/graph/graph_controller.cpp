@@ -75,6 +75,11 @@ static Coordinate2D<T> evaluatorSecondCurve(T t, const void *model,
   const ContinuousFunction *f = static_cast<const ContinuousFunction *>(model);
   return f->evaluateXYAtParameter(t, context, 1);
 }
+static bool batchEvaluator(const float *t, float *y, int numberOfValues,
+                           const void *model, Context *context) {
+  const ContinuousFunction *f = static_cast<const ContinuousFunction *>(model);
+  return f->evaluateYAtParameters(t, y, numberOfValues, context);
+}
 template <typename T, int coordinate>
 static Coordinate2D<T> parametricExpressionEvaluator(T t, const void *model,
                                                      Context *context) {
@@ -259,7 +264,7 @@ Range2D GraphController::optimalRange(bool computeX, bool computeY,
         continue;
       }
       bool alongY = f->isAlongY();
-      zoom.fitMagnitude(evaluator, f.operator->(), alongY);
+      zoom.fitMagnitude(evaluator, f.operator->(), alongY, batchEvaluator);
       if (f->numberOfSubCurves() > 1) {
         zoom.fitMagnitude(evaluatorSecondCurve, f.operator->(), alongY);
       }
@@ -284,9 +289,8 @@ PointsOfInterestCache *GraphController::pointsOfInterestForRecord(
   }
 
   if (!cache) {
-    PointsOfInterestCache newCache(record);
-    m_pointsOfInterest.push(newCache);
-    cache = m_pointsOfInterest.elementAtIndex(m_pointsOfInterest.length() - 1);
+    cache = m_pointsOfInterest.pushElement();
+    cache->init(record, functionStore(), App::app()->localContext());
   }
 
   // Set bounds of cache
@@ -54,6 +54,7 @@ void GraphView::drawRecord(Ion::Storage::Record record, int index,
                            bool firstDrawnRecord) const {
   if (firstDrawnRecord) {
     m_areaIndex = 0;
+    functionStore()->startDrawingPass();
   }
 
   ExpiringPointer<ContinuousFunction> f =
@@ -81,7 +82,7 @@ void GraphView::drawRecord(Ion::Storage::Record record, int index,
     }
   }
 
-  ContinuousFunctionCache *cch = functionStore()->cacheAtIndex(index);
+  ContinuousFunctionCache *cch = functionStore()->cacheForRecord(record);
   float tmin = f->tMin();
   float tmax = f->tMax();
   Axis axis = f->isAlongY() ? Axis::Vertical : Axis::Horizontal;
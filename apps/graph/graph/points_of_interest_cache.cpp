@@ -6,20 +6,27 @@
 
 #include <algorithm>
 
-#include "../app.h"
-
 using namespace Poincare;
 using namespace Shared;
 
 namespace Graph {
 
+static bool IsStrictlyBetween(double x, double a, double b) {
+  return (a < x && x < b) || (b < x && x < a);
+}
+
 // PointsOfInterestCache
 
-PointsOfInterestCache PointsOfInterestCache::clone() const {
-  PointsOfInterestCache result = *this;
-  Expression cloneList = result.list().clone();
-  result.m_list.setList(static_cast<List &>(cloneList));
-  return result;
+void PointsOfInterestCache::init(Ion::Storage::Record record,
+                                 ContinuousFunctionStore *store,
+                                 Context *context) {
+  m_record = record;
+  m_store = store;
+  m_context = context;
+  m_checksum = 0;
+  m_start = m_end = m_computedStart = m_computedEnd = NAN;
+  m_list.init();
+  m_overflow = false;
 }
 
 void PointsOfInterestCache::setBounds(float start, float end) {
@@ -30,20 +37,14 @@ void PointsOfInterestCache::setBounds(float start, float end) {
     /* Discard the old results if anything in the storage has changed. */
     m_computedStart = m_computedEnd = start;
     m_list.init();
-    m_interestingPointsOverflowPool = false;
+    m_overflow = false;
   }
 
   m_start = start;
   m_end = end;
   m_computedEnd = std::clamp(m_computedEnd, start, end);
   m_computedStart = std::clamp(m_computedStart, start, end);
-
-  if (m_list.isUninitialized()) {
-    m_list.init();
-    m_interestingPointsOverflowPool = false;
-  } else {
-    stripOutOfBounds();
-  }
+  stripOutOfBounds();
 
   m_checksum = checksum;
 }
@@ -72,52 +73,6 @@ int PointsOfInterestCache::numberOfPoints(
   return result;
 }
 
-PointOfInterest PointsOfInterestCache::firstPointInDirection(
-    double start, double end, Solver<double>::Interest interest,
-    int subCurveIndex) {
-  if (start == end) {
-    return PointOfInterest();
-  }
-  m_list.sort();
-  int n = numberOfPoints();
-  int direction = start > end ? -1 : 1;
-  int firstIndex = 0;
-  int lastIndex = n - 1;
-  if (direction < 0) {
-    std::swap(firstIndex, lastIndex);
-  }
-  for (int i = firstIndex; direction * i <= direction * lastIndex;
-       i += direction) {
-    PointOfInterest p = pointAtIndex(i);
-    if (direction * p.abscissa() <= direction * start) {
-      continue;
-    }
-    if (direction * p.abscissa() >= direction * end) {
-      break;
-    }
-    if ((interest == Solver<double>::Interest::None ||
-         interest == p.interest()) &&
-        p.subCurveIndex() == subCurveIndex) {
-      return p;
-    }
-  }
-  return PointOfInterest();
-}
-
-bool PointsOfInterestCache::hasInterestAtCoordinates(
-    double x, double y, Solver<double>::Interest interest) const {
-  int n = numberOfPoints();
-  for (int i = 0; i < n; i++) {
-    PointOfInterest p = pointAtIndex(i);
-    if (p.x() == x && p.y() == y &&
-        (interest == Solver<double>::Interest::None ||
-         p.interest() == interest)) {
-      return true;
-    }
-  }
-  return false;
-}
-
 bool PointsOfInterestCache::hasDisplayableInterestAtCoordinates(
     double x, double y, Poincare::Solver<double>::Interest interest,
     bool allInterestsAreDisplayed) const {
@@ -140,60 +95,59 @@ float PointsOfInterestCache::step() const {
 }
 
 void PointsOfInterestCache::stripOutOfBounds() {
-  assert(!m_list.isUninitialized());
-
   int initialNumberOfPoints = numberOfPoints();
-  for (int i = initialNumberOfPoints - 1; i >= 0; i--) {
-    float x = static_cast<float>(pointAtIndex(i).abscissa());
-    if (x < m_start || m_end < x) {
-      m_list.list().removeChildAtIndexInPlace(i);
-      m_interestingPointsOverflowPool = false;
-    }
+  m_list.removePointsOutside(m_start, m_end);
+  if (numberOfPoints() < initialNumberOfPoints) {
+    m_overflow = false;
   }
 }
 
 bool PointsOfInterestCache::computeNextStep(bool allowUserInterruptions) {
-  // Clone the cache to prevent modifying the pool before the checkpoint
-  PointsOfInterestCache cacheClone;
-  {
-    /* Always use an ExceptionCheckpoint in case cloning or computing interest
-     * points overflows the pool. */
-    ExceptionCheckpoint ecp;
-    if (ExceptionRun(ecp)) {
-      /* If allowed, use a CircuitBreakerCheckpoint so that computation can be
-       * interrupted to allow plot navigation in parallel of computation. */
-      CircuitBreakerCheckpoint checkpoint(
-          Ion::CircuitBreaker::CheckpointType::AnyKey);
-      if (!allowUserInterruptions || CircuitBreakerRun(checkpoint)) {
-        cacheClone = clone();
-        if (m_computedEnd < m_end) {
-          cacheClone.computeBetween(
-              m_computedEnd,
-              std::clamp(m_computedEnd + step(), m_start, m_end));
-        } else if (m_computedStart > m_start) {
-          cacheClone.computeBetween(
-              std::clamp(m_computedStart - step(), m_start, m_end),
-              m_computedStart);
-        }
-      } else {
-        tidyDownstreamPoolFrom(checkpoint.endOfPoolBeforeCheckpoint());
-        return false;
+  /* Points are appended during the computation, remember the state of the
+   * cache to discard them if the computation is interrupted. */
+  int previousNumberOfPoints = numberOfPoints();
+  float previousComputedStart = m_computedStart;
+  float previousComputedEnd = m_computedEnd;
+  /* Always use an ExceptionCheckpoint in case computing interest points
+   * overflows the pool. */
+  ExceptionCheckpoint ecp;
+  if (ExceptionRun(ecp)) {
+    /* If allowed, use a CircuitBreakerCheckpoint so that computation can be
+     * interrupted to allow plot navigation in parallel of computation. */
+    CircuitBreakerCheckpoint checkpoint(
+        Ion::CircuitBreaker::CheckpointType::AnyKey);
+    if (!allowUserInterruptions || CircuitBreakerRun(checkpoint)) {
+      if (m_computedEnd < m_end) {
+        computeBetween(m_computedEnd,
+                       std::clamp(m_computedEnd + step(), m_start, m_end));
+      } else if (m_computedStart > m_start) {
+        computeBetween(std::clamp(m_computedStart - step(), m_start, m_end),
+                       m_computedStart);
       }
-    } else {
-      // TODO : Notify the user that the pool is full
-      m_interestingPointsOverflowPool = true;
-      tidyDownstreamPoolFrom(ecp.endOfPoolBeforeCheckpoint());
-      return false;
+      if (m_overflow) {
+        /* The list is full. Discard the points of the step so that the list
+         * holds all the points between the computed bounds. */
+        m_list.truncate(previousNumberOfPoints);
+        m_computedStart = previousComputedStart;
+        m_computedEnd = previousComputedEnd;
+      }
+      return true;
     }
+    tidyDownstreamPoolFrom(checkpoint.endOfPoolBeforeCheckpoint());
+  } else {
+    // TODO : Notify the user that the pool is full
+    m_overflow = true;
+    tidyDownstreamPoolFrom(ecp.endOfPoolBeforeCheckpoint());
   }
-  *this = cacheClone;
-  return true;
+  m_list.truncate(previousNumberOfPoints);
+  m_computedStart = previousComputedStart;
+  m_computedEnd = previousComputedEnd;
+  return false;
 }
 
 void PointsOfInterestCache::computeBetween(float start, float end) {
   assert(!m_record.isNull());
   assert(m_checksum == Ion::Storage::FileSystem::sharedFileSystem->checksum());
-  assert(!m_list.isUninitialized());
   assert((end == m_computedStart && start < m_computedStart) ||
          (start == m_computedEnd && end > m_computedEnd));
   assert(start >= m_start && end <= m_end);
@@ -206,8 +160,8 @@ void PointsOfInterestCache::computeBetween(float start, float end) {
 
   float searchStep = Solver<double>::MaximalStep(m_start - m_end);
 
-  ContinuousFunctionStore *store = App::app()->functionStore();
-  Context *context = App::app()->localContext();
+  ContinuousFunctionStore *store = m_store;
+  Context *context = m_context;
   ExpiringPointer<ContinuousFunction> f = store->modelForRecord(m_record);
   Expression e = f->expressionApproximated(context);
 
@@ -293,32 +247,186 @@ void PointsOfInterestCache::computeBetween(float start, float end) {
   }
 }
 
+PointOfInterest PointsOfInterestCache::firstPointInDirection(
+    double start, double end, Solver<double>::Interest interest,
+    int subCurveIndex) {
+  if (!m_overflow) {
+    return m_list.firstPointInDirection(start, end, interest, subCurveIndex);
+  }
+  /* The list holds the points in [m_computedStart, m_computedEnd), the points
+   * outside are computed on demand. The point at m_computedEnd is found by
+   * computing from the double just before it. */
+  double computedStart = m_computedStart;
+  double computedEnd = m_computedEnd;
+  double beforeComputedEnd = std::nextafter(computedEnd, -INFINITY);
+  PointOfInterest result;
+  if (start < end) {
+    if (start < computedStart) {
+      result = computeFirstPointInDirection(
+          start, std::min(end, computedStart), interest, subCurveIndex);
+    }
+    if (result.isUninitialized()) {
+      result =
+          m_list.firstPointInDirection(start, end, interest, subCurveIndex);
+    }
+    if (result.isUninitialized() && end > computedEnd) {
+      result = computeFirstPointInDirection(std::max(start, beforeComputedEnd),
+                                            end, interest, subCurveIndex);
+    }
+  } else {
+    if (start >= computedEnd) {
+      result = computeFirstPointInDirection(
+          start, std::max(end, beforeComputedEnd), interest, subCurveIndex);
+    }
+    if (result.isUninitialized()) {
+      result =
+          m_list.firstPointInDirection(start, end, interest, subCurveIndex);
+    }
+    if (result.isUninitialized() && end < computedStart) {
+      result = computeFirstPointInDirection(std::min(start, computedStart), end,
+                                            interest, subCurveIndex);
+    }
+  }
+  return result;
+}
+
+PointOfInterest PointsOfInterestCache::computeFirstPointInDirection(
+    double start, double end, Solver<double>::Interest interest,
+    int subCurveIndex) {
+  assert(!m_record.isNull());
+  PointOfInterest result;
+  if (start == end) {
+    return result;
+  }
+  ExceptionCheckpoint ecp;
+  if (!ExceptionRun(ecp)) {
+    tidyDownstreamPoolFrom(ecp.endOfPoolBeforeCheckpoint());
+    return result;
+  }
+
+  ContinuousFunctionStore *store = m_store;
+  Context *context = m_context;
+  ExpiringPointer<ContinuousFunction> f = store->modelForRecord(m_record);
+  bool inverted = f->isAlongY();
+  Expression e = f->expressionApproximated(context);
+  float searchStep = Solver<double>::MaximalStep(m_start - m_end);
+  /* Solutions are looked for between start and the closest solution found so
+   * far. */
+  double bound = end;
+  auto isAfterStart = [&](double x) {
+    return (x - start) * (end - start) > 0.;
+  };
+  auto keep = [&](double x, double y, Solver<double>::Interest pointInterest,
+                  uint32_t data, int pointSubCurveIndex) {
+    if (!IsStrictlyBetween(x, start, bound) ||
+        (interest != Solver<double>::Interest::None &&
+         interest != pointInterest) ||
+        pointSubCurveIndex != subCurveIndex) {
+      return;
+    }
+    bound = x;
+    result = PointOfInterest(
+        x, pointInterest == Solver<double>::Interest::Root ? 0. : y,
+        pointInterest, data, inverted, pointSubCurveIndex);
+  };
+
+  if (IsStrictlyBetween(0., start, end)) {
+    Coordinate2D<double> xy =
+        f->evaluateXYAtParameter(0., context, subCurveIndex);
+    if (std::isfinite(xy.x()) && std::isfinite(xy.y())) {
+      if (inverted) {
+        xy = Coordinate2D<double>(xy.y(), xy.x());
+      }
+      keep(xy.x(), xy.y(), Solver<double>::Interest::YIntercept, 0,
+           subCurveIndex);
+    }
+  }
+
+  if (subCurveIndex != 0) {
+    // Only the y-intercepts are computed for the other sub-curves
+    return result;
+  }
+
+  typedef Coordinate2D<double> (Solver<double>::*NextSolution)(
+      const Expression &e);
+  NextSolution methodsNext[] = {&Solver<double>::nextRoot,
+                                &Solver<double>::nextMinimum,
+                                &Solver<double>::nextMaximum};
+  for (NextSolution next : methodsNext) {
+    if (next != static_cast<NextSolution>(&Solver<double>::nextRoot) &&
+        inverted) {
+      continue;
+    }
+    Solver<double> solver = PoincareHelpers::Solver<double>(
+        start, bound, ContinuousFunction::k_unknownName, context);
+    solver.setSearchStep(searchStep);
+    solver.stretch();
+    solver.setGrowthSpeed(Solver<double>::GrowthSpeed::Fast);
+    Coordinate2D<double> solution;
+    while (std::isfinite(
+        (solution = (solver.*next)(e)).x())) {  // assignment in condition
+      // Skip the solutions before start since the interval was stretched
+      if (isAfterStart(solution.x())) {
+        keep(solution.x(), solution.y(), solver.lastInterest(), 0, 0);
+        break;
+      }
+    }
+  }
+
+  if ((interest != Solver<double>::Interest::None &&
+       interest != Solver<double>::Interest::Intersection) ||
+      store->memoizationOverflows() || !f->shouldDisplayIntersections()) {
+    return result;
+  }
+
+  int n = store->numberOfActiveFunctions();
+  for (int i = 0; i < n; i++) {
+    Ion::Storage::Record record = store->activeRecordAtIndex(i);
+    if (record == m_record) {
+      continue;
+    }
+    ExpiringPointer<ContinuousFunction> g = store->modelForRecord(record);
+    if (!g->shouldDisplayIntersections()) {
+      continue;
+    }
+    Expression e2 = g->expressionApproximated(context);
+    Solver<double> solver = PoincareHelpers::Solver<double>(
+        start, bound, ContinuousFunction::k_unknownName, context);
+    solver.setSearchStep(searchStep);
+    solver.stretch();
+    Expression diff;
+    Coordinate2D<double> intersection;
+    while (std::isfinite((intersection = solver.nextIntersection(e, e2, &diff))
+                             .x())) {  // assignment in condition
+      if (isAfterStart(intersection.x())) {
+        keep(intersection.x(), intersection.y(),
+             Solver<double>::Interest::Intersection,
+             *reinterpret_cast<uint32_t *>(&record), 0);
+        break;
+      }
+    }
+  }
+  return result;
+}
+
 void PointsOfInterestCache::append(double x, double y,
                                    Solver<double>::Interest interest,
                                    uint32_t data, int subCurveIndex) {
   assert(std::isfinite(x) && std::isfinite(y));
-#if __EMSCRIPTEN__
-  // Cap the total number of points
-  if (m_interestingPointsOverflowPool ||
-      (numberOfPoints() > k_numberOfPointsToOverflowEmscripten)) {
-    m_interestingPointsOverflowPool = true;
-    return;
+  ExpiringPointer<ContinuousFunction> f = m_store->modelForRecord(m_record);
+  if (!m_list.append(x, y, data, interest, f->isAlongY(), subCurveIndex)) {
+    m_overflow = true;
   }
-#endif
-  ExpiringPointer<ContinuousFunction> f =
-      App::app()->functionStore()->modelForRecord(m_record);
-  m_list.append(x, y, data, interest, f->isAlongY(), subCurveIndex);
 }
 
 void PointsOfInterestCache::tidyDownstreamPoolFrom(
     TreeNode *treePoolCursor) const {
-  ContinuousFunctionStore *store = App::app()->functionStore();
-  int n = store->numberOfActiveFunctions();
+  int n = m_store->numberOfActiveFunctions();
   for (int i = 0; i < n; i++) {
-    store->modelForRecord(store->activeRecordAtIndex(i))
+    m_store->modelForRecord(m_store->activeRecordAtIndex(i))
         ->tidyDownstreamPoolFrom(treePoolCursor);
   }
-  App::app()->localContext()->tidyDownstreamPoolFrom(treePoolCursor);
+  m_context->tidyDownstreamPoolFrom(treePoolCursor);
 }
 
 }  // namespace Graph
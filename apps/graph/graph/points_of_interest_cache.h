@@ -1,6 +1,7 @@
 #ifndef GRAPH_POINTS_OF_INTEREST_CACHE
 #define GRAPH_POINTS_OF_INTEREST_CACHE
 
+#include <apps/shared/continuous_function_store.h>
 #include <ion/storage/record.h>
 #include <poincare/point_of_interest.h>
 #include <poincare/range.h>
@@ -9,23 +10,29 @@ namespace Graph {
 
 class PointsOfInterestCache {
  public:
-  PointsOfInterestCache(Ion::Storage::Record record)
+  PointsOfInterestCache(Ion::Storage::Record record,
+                        Shared::ContinuousFunctionStore* store,
+                        Poincare::Context* context)
       : m_record(record),
+        m_store(store),
+        m_context(context),
         m_checksum(0),
         m_start(NAN),
         m_end(NAN),
         m_computedStart(NAN),
         m_computedEnd(NAN),
-        m_interestingPointsOverflowPool(false) {}
-  PointsOfInterestCache() : PointsOfInterestCache(Ion::Storage::Record()) {}
+        m_overflow(false) {}
+  PointsOfInterestCache()
+      : PointsOfInterestCache(Ion::Storage::Record(), nullptr, nullptr) {}
+
+  void init(Ion::Storage::Record record, Shared::ContinuousFunctionStore* store,
+            Poincare::Context* context);
 
-  Poincare::List list() { return m_list.list(); }
   Ion::Storage::Record record() const { return m_record; }
-  PointsOfInterestCache clone() const;
 
   void setBounds(float start, float end);
   bool isFullyComputed() const {
-    return m_interestingPointsOverflowPool ||
+    return m_overflow ||
            (m_start == m_computedStart && m_end == m_computedEnd);
   }
 
@@ -39,6 +46,8 @@ class PointsOfInterestCache {
   // Return false it has been interrupted by the pool or the user (if allowed)
   bool computeNextStep(bool allowUserInterruptions);
 
+  /* Once the list is full, the points outside of the computed bounds are
+   * computed on demand. */
   Poincare::PointOfInterest firstPointInDirection(
       double start, double end,
       Poincare::Solver<double>::Interest interest =
@@ -47,7 +56,9 @@ class PointsOfInterestCache {
   bool hasInterestAtCoordinates(
       double x, double y,
       Poincare::Solver<double>::Interest interest =
-          Poincare::Solver<double>::Interest::None) const;
+          Poincare::Solver<double>::Interest::None) const {
+    return m_list.hasPointAtCoordinates(x, y, interest);
+  }
   bool hasDisplayableInterestAtCoordinates(
       double x, double y,
       Poincare::Solver<double>::Interest interest =
@@ -56,17 +67,11 @@ class PointsOfInterestCache {
 
   bool canDisplayPoints(Poincare::Solver<double>::Interest interest =
                             Poincare::Solver<double>::Interest::None) const {
-    return !m_interestingPointsOverflowPool &&
+    return !m_overflow &&
            (numberOfPoints(interest) <= k_maxNumberOfDisplayablePoints);
   }
 
  private:
-#if __EMSCRIPTEN__
-  /* Since emscripten does not handle ExceptionCheckpoint and will crash if the
-   * pool is overflown, the total number of cached points is capped. Pool can
-   * still be overflown, but it is less likely. */
-  constexpr static int k_numberOfPointsToOverflowEmscripten = 128;
-#endif
   constexpr static int k_maxNumberOfDisplayablePoints = 64;
   constexpr static float k_numberOfSteps = 25.0;
 
@@ -74,19 +79,28 @@ class PointsOfInterestCache {
 
   void stripOutOfBounds();
   void computeBetween(float start, float end);
+  /* Compute the point in the open interval between start and end that is the
+   * closest to start, without storing it. */
+  Poincare::PointOfInterest computeFirstPointInDirection(
+      double start, double end, Poincare::Solver<double>::Interest interest,
+      int subCurveIndex);
   void append(double x, double y, Poincare::Solver<double>::Interest,
               uint32_t data = 0, int subCurveIndex = 0);
   void tidyDownstreamPoolFrom(Poincare::TreeNode* treePoolCursor) const;
 
   Ion::Storage::Record
       m_record;  // This is not const because of the copy constructor
+  Shared::ContinuousFunctionStore* m_store;
+  Poincare::Context* m_context;
   uint32_t m_checksum;
   float m_start;
   float m_end;
   float m_computedStart;
   float m_computedEnd;
   Poincare::PointsOfInterestList m_list;
-  bool m_interestingPointsOverflowPool;
+  /* The list is full or the computation overflowed the pool. When the list is
+   * full, it holds all the points between m_computedStart and m_computedEnd. */
+  bool m_overflow;
 };
 
 }  // namespace Graph
@@ -45,7 +45,7 @@ void assert_cartesian_cache_stays_valid_while_panning(
     ContinuousFunction* function, Context* context,
     InteractiveCurveViewRange* range, CurveViewCursor* cursor,
     ContinuousFunctionStore* store, float step) {
-  ContinuousFunctionCache* cache = store->cacheAtIndex(0);
+  ContinuousFunctionCache* cache = store->cacheForRecord(*function);
   assert(cache);
 
   float tMin, tStep;
@@ -70,7 +70,7 @@ void assert_check_polar_cache_against_function(ContinuousFunction* function,
                                                Context* context,
                                                InteractiveCurveViewRange* range,
                                                ContinuousFunctionStore* store) {
-  ContinuousFunctionCache* cache = store->cacheAtIndex(0);
+  ContinuousFunctionCache* cache = store->cacheForRecord(*function);
   assert(cache);
 
   float tMin = range->xMin();
@@ -156,4 +156,87 @@ QUIZ_CASE(graph_caching) {
   Preferences::sharedPreferences->setAngleUnit(previousAngleUnit);
 }
 
+QUIZ_CASE(graph_caches_lending) {
+  GlobalContext globalContext;
+  ContinuousFunctionStore functionStore;
+  constexpr int numberOfFunctions =
+      ContinuousFunctionCache::k_numberOfAvailableCaches + 1;
+  const char* definitions[numberOfFunctions] = {"f(x)=x", "g(x)=x^2",
+                                                "h(x)=x^3", "p(x)=x^4",
+                                                "q(x)=x^5"};
+  Ion::Storage::Record records[numberOfFunctions];
+  for (int i = 0; i < numberOfFunctions; i++) {
+    records[i] = *addFunction(definitions[i], &functionStore, &globalContext);
+  }
+
+  ContinuousFunctionCache* caches[numberOfFunctions];
+  for (int pass = 0; pass < 2; pass++) {
+    functionStore.startDrawingPass();
+    for (int i = 0; i < numberOfFunctions; i++) {
+      ContinuousFunctionCache* cache =
+          functionStore.cacheForRecord(records[i]);
+      // Caches are not taken back from functions drawn in the same pass
+      quiz_assert(pass == 0 || cache == caches[i]);
+      caches[i] = cache;
+    }
+  }
+  for (int i = 0; i < numberOfFunctions - 1; i++) {
+    quiz_assert(caches[i] != nullptr);
+    for (int j = 0; j < i; j++) {
+      quiz_assert(caches[i] != caches[j]);
+    }
+  }
+  quiz_assert(caches[numberOfFunctions - 1] == nullptr);
+
+  // The least recently used cache is lent to the last function
+  functionStore.startDrawingPass();
+  for (int i = 1; i < numberOfFunctions; i++) {
+    functionStore.cacheForRecord(records[i]);
+  }
+  quiz_assert(functionStore.cacheForRecord(records[numberOfFunctions - 1]) ==
+              caches[0]);
+
+  functionStore.removeAll();
+}
+
+QUIZ_CASE(graph_caching_more_functions_than_caches) {
+  GlobalContext globalContext;
+  ContinuousFunctionStore functionStore;
+  constexpr int numberOfFunctions =
+      ContinuousFunctionCache::k_numberOfAvailableCaches + 2;
+  const char* definitions[numberOfFunctions] = {
+      "f(x)=x+1", "g(x)=x+2", "h(x)=x+3", "p(x)=x+4", "q(x)=x+5", "s(x)=x+6"};
+  Ion::Storage::Record records[numberOfFunctions];
+  for (int i = 0; i < numberOfFunctions; i++) {
+    records[i] = *addFunction(definitions[i], &functionStore, &globalContext);
+  }
+
+  constexpr float tMin = -5.f;
+  constexpr float tStep = 10.f / (Ion::Display::Width - 1);
+  /* The last pass is drawn in reverse order: the last functions are lent the
+   * caches filled by the first ones, which must not serve stale values. */
+  for (int pass = 0; pass < 3; pass++) {
+    functionStore.startDrawingPass();
+    for (int k = 0; k < numberOfFunctions; k++) {
+      int i = pass < 2 ? k : numberOfFunctions - 1 - k;
+      ContinuousFunctionCache* cache = functionStore.cacheForRecord(records[i]);
+      quiz_assert(
+          (cache == nullptr) ==
+          (pass < 2 ? i >= ContinuousFunctionCache::k_numberOfAvailableCaches
+                    : i < 2));
+      ExpiringPointer<ContinuousFunction> function =
+          functionStore.modelForRecord(records[i]);
+      ContinuousFunctionCache::PrepareForCaching(function.operator->(), cache,
+                                                 tMin, tStep);
+      for (int j = 0; j < Ion::Display::Width; j++) {
+        float t = tMin + j * tStep;
+        assert_float_equals(
+            function->evaluateXYAtParameter(t, &globalContext).y(), t + i + 1);
+      }
+    }
+  }
+
+  functionStore.removeAll();
+}
+
 }  // namespace Graph
@@ -0,0 +1,62 @@
+#include <apps/shared/global_context.h>
+#include <quiz.h>
+
+#include <cmath>
+
+#include "../graph/points_of_interest_cache.h"
+#include "helper.h"
+
+using namespace Poincare;
+using namespace Shared;
+
+namespace Graph {
+
+void assert_root_is(PointOfInterest p, double expected) {
+  quiz_assert(!p.isUninitialized() &&
+              p.interest() == Solver<double>::Interest::Root);
+  assert_roughly_equal(p.abscissa(), expected, 1e-6, true);
+}
+
+QUIZ_CASE(graph_points_of_interest_past_the_list_capacity) {
+  using Interest = Solver<double>::Interest;
+  Preferences::AngleUnit previousAngleUnit =
+      Preferences::sharedPreferences->angleUnit();
+  Preferences::sharedPreferences->setAngleUnit(Preferences::AngleUnit::Radian);
+  GlobalContext globalContext;
+  ContinuousFunctionStore functionStore;
+  ContinuousFunction* function =
+      addFunction("f(x)=sin(2x)", &functionStore, &globalContext);
+
+  PointsOfInterestCache cache(*function, &functionStore, &globalContext);
+  cache.setBounds(-50.f, 50.f);
+  while (!cache.isFullyComputed()) {
+    quiz_assert(cache.computeNextStep(false));
+  }
+  // sin(2x) has 63 roots and 64 extrema in [-50, 50]
+  quiz_assert(!cache.canDisplayPoints());
+  quiz_assert(cache.numberOfPoints() <=
+              PointsOfInterestList::k_maxNumberOfPoints);
+
+  constexpr double period = M_PI / 2.;
+  // In the computed part of the list
+  assert_root_is(cache.firstPointInDirection(-50., 50., Interest::Root),
+                 -31. * period);
+  // Past the computed part of the list
+  assert_root_is(cache.firstPointInDirection(45., 50., Interest::Root),
+                 29. * period);
+  assert_root_is(cache.firstPointInDirection(47.5, -50., Interest::Root),
+                 30. * period);
+  assert_root_is(
+      cache.firstPointInDirection(29.2 * period, 50., Interest::Root),
+      30. * period);
+  PointOfInterest p = cache.firstPointInDirection(44., 50.);
+  quiz_assert(p.interest() == Interest::LocalMaximum);
+  assert_roughly_equal(p.abscissa(), 28.5 * period, 1e-6, true);
+  quiz_assert(
+      cache.firstPointInDirection(50., 49.9, Interest::Root).isUninitialized());
+
+  functionStore.removeAll();
+  Preferences::sharedPreferences->setAngleUnit(previousAngleUnit);
+}
+
+}  // namespace Graph
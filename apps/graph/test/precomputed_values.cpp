@@ -0,0 +1,61 @@
+#include <apps/shared/global_context.h>
+#include <apps/shared/precomputed_values.h>
+#include <quiz.h>
+
+#include <cmath>
+
+#include "helper.h"
+
+using namespace Poincare;
+using namespace Shared;
+
+namespace Graph {
+
+QUIZ_CASE(graph_precomputed_values_of_derivatives) {
+  /* The values table precomputes the derivatives of a page on Ion::Workers.
+   * They must be the values approximated one at a time. */
+  constexpr int numberOfFunctions = 4;
+  constexpr int numberOfRows = 10;
+  const char* definitions[numberOfFunctions] = {
+      "f(x)=cos(x)+x^2", "g(x)=ln(x)", "h(x)=e^(-x)×sin(3x)",
+      "p(x)=√(x)-1/x"};
+  GlobalContext globalContext;
+  ContinuousFunctionStore functionStore;
+  for (int i = 0; i < numberOfFunctions; i++) {
+    addFunction(definitions[i], &functionStore, &globalContext);
+  }
+
+  PrecomputedValues<numberOfFunctions, numberOfRows> values;
+  for (int i = 0; i < numberOfFunctions; i++) {
+    ExpiringPointer<ContinuousFunction> function =
+        functionStore.modelForRecord(functionStore.recordAtIndex(i));
+    Preferences::ComplexFormat complexFormat;
+    Expression derivative =
+        function->derivativeToApproximate(&globalContext, &complexFormat);
+    quiz_assert(!derivative.isUninitialized());
+    int columnIndex = values.addColumn(
+        i, derivative, ContinuousFunction::k_unknownName, complexFormat,
+        Preferences::sharedPreferences->angleUnit());
+    quiz_assert(columnIndex == i);
+    for (int row = 0; row < numberOfRows; row++) {
+      values.addCell(columnIndex, -2.25 + 0.5 * row, i * numberOfRows + row);
+    }
+  }
+  values.compute();
+
+  for (int i = 0; i < numberOfFunctions; i++) {
+    ExpiringPointer<ContinuousFunction> function =
+        functionStore.modelForRecord(functionStore.recordAtIndex(i));
+    for (int row = 0; row < numberOfRows; row++) {
+      double value;
+      quiz_assert(values.valueAtMemoizedIndex(i * numberOfRows + row, &value));
+      double expected = function->approximateDerivative(
+          -2.25 + 0.5 * row, &globalContext, 0, false);
+      quiz_assert(value == expected ||
+                  (std::isnan(value) && std::isnan(expected)));
+    }
+  }
+  functionStore.removeAll();
+}
+
+}  // namespace Graph
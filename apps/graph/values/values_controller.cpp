@@ -379,8 +379,11 @@ void ValuesController::createMemoizedLayout(int column, int row, int index) {
   Expression result;
   if (isDerivative) {
     // Compute derivative approximate result
-    result = Float<double>::Builder(
-        function->approximateDerivative(abscissa, context, 0, false));
+    double derivative;
+    if (!precomputedValueAtMemoizedIndex(index, &derivative)) {
+      derivative = function->approximateDerivative(abscissa, context, 0, false);
+    }
+    result = Float<double>::Builder(derivative);
   } else {
     // Compute exact result
     result = function->expressionReduced(context);
@@ -415,6 +418,31 @@ void ValuesController::createMemoizedLayout(int column, int row, int index) {
       Preferences::VeryLargeNumberOfSignificantDigits, context);
 }
 
+void ValuesController::precomputeMemoizedValue(int column, int row, int index,
+                                               PageValues *values) {
+  double abscissa;
+  bool isDerivative = false;
+  Shared::ExpiringPointer<ContinuousFunction> function =
+      functionAtIndex(column, row, &abscissa, &isDerivative);
+  // Values of functions are exact results, only derivatives are approximated
+  if (!isDerivative) {
+    return;
+  }
+  int columnIndex = values->indexOfColumn(column);
+  if (columnIndex < 0) {
+    Preferences::ComplexFormat complexFormat;
+    Expression derivative = function->derivativeToApproximate(
+        textFieldDelegateApp()->localContext(), &complexFormat);
+    if (derivative.isUninitialized()) {
+      return;
+    }
+    columnIndex = values->addColumn(
+        column, derivative, ContinuousFunction::k_unknownName, complexFormat,
+        Preferences::sharedPreferences->angleUnit());
+  }
+  values->addCell(columnIndex, abscissa, index);
+}
+
 int ValuesController::numberOfColumnsForAbscissaColumn(int column) {
   return numberOfColumnsForSymbolType((int)symbolTypeAtColumn(&column));
 }
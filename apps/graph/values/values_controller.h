@@ -121,6 +121,8 @@ class ValuesController : public Shared::ValuesController,
   void setStartEndMessages(Shared::IntervalParameterController *controller,
                            int column) override;
   void createMemoizedLayout(int column, int row, int index) override;
+  void precomputeMemoizedValue(int column, int row, int index,
+                               PageValues *values) override;
   int numberOfColumnsForAbscissaColumn(int column) override;
   void updateSizeMemoizationForColumnAfterIndexChanged(
       int column, KDCoordinate columnPreviousWidth, int changedRow) override;
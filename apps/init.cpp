@@ -1,5 +1,7 @@
 #include "init.h"
 
+#include <string.h>
+
 #include "apps_container_storage.h"
 #include "global_preferences.h"
 #include "shared/global_context.h"
@@ -13,4 +15,19 @@ void Init() {
   ::AppsContainerStorage::sharedAppsContainerStorage.init();
 }
 
+/* Some members are only set by the zero-initialization of the globals at
+ * startup, which must be done again before the next Init. */
+template <typename T>
+static void DeinitAndClear(OMG::GlobalBox<T>& box) {
+  box.deinit();
+  memset(static_cast<void*>(box), 0, sizeof(T));
+}
+
+void Deinit() {
+  DeinitAndClear(::AppsContainerStorage::sharedAppsContainerStorage);
+  DeinitAndClear(::Shared::GlobalContext::continuousFunctionStore);
+  DeinitAndClear(::Shared::GlobalContext::sequenceStore);
+  DeinitAndClear(::GlobalPreferences::sharedGlobalPreferences);
+}
+
 }  // namespace Apps
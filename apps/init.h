@@ -4,6 +4,8 @@
 namespace Apps {
 
 void Init();
+// Destroy what Init built, so that Init can be called again
+void Deinit();
 
 }
 
@@ -116,6 +116,13 @@ void ion_main(int argc, const char *const argv[]) {
   Ion::setStackStart((void *)(&stackTop));
 
   AppsContainer::sharedAppsContainer()->run();
+
+  /* Destroy the globals in the reverse order, so that ion_main can run again
+   * in the same process, as when the simulator replays a list of state
+   * files. */
+  Apps::Deinit();
+  Escher::Deinit();
+  Poincare::Deinit();
 }
 
 #endif
@@ -742,6 +742,96 @@ QUIZ_CASE(sequence_sum_evaluation) {
                                        "u(n)+u(n+1)+2", "0", "0");
 }
 
+QUIZ_CASE(sequence_rank_checkpoints) {
+  Shared::GlobalContext globalContext;
+  SequenceStore* store = globalContext.sequenceStore;
+  SequenceContext* sequenceContext = globalContext.sequenceContext();
+  // Affine recurrences are not stepped through, these sequences are not
+  Sequence* u = addSequence(store, Sequence::Type::SingleRecurrence,
+                            "abs(u(n))+2", "0", nullptr, sequenceContext);
+  Sequence* v = addSequence(store, Sequence::Type::DoubleRecurrence,
+                            "v(n+1)v(n)", "1", "-1", sequenceContext);
+  Sequence* w = addSequence(store, Sequence::Type::SingleRecurrence,
+                            "w(n)+u(n)", "0", nullptr, sequenceContext);
+  constexpr double periodOfV[] = {1., -1., -1.};
+  // Step backwards and forwards across the checkpoints
+  constexpr int ranks[] = {9000, 8000, 8999, 300, 10000, 157, 156, 9999, 0};
+  for (int rank : ranks) {
+    double n = static_cast<double>(rank);
+    quiz_assert(u->evaluateXYAtParameter(n, sequenceContext).y() == 2. * n);
+    quiz_assert(v->evaluateXYAtParameter(n, sequenceContext).y() ==
+                periodOfV[rank % 3]);
+    quiz_assert(w->evaluateXYAtParameter(n, sequenceContext).y() ==
+                n * (n - 1.));
+  }
+  store->removeAll();
+  store->tidyDownstreamPoolFrom();
+}
+
+void assert_affine_coefficients(Sequence::Type type, const char* definition,
+                                bool isAffine, double a = 0., double b = 0.,
+                                double c = 0.) {
+  Shared::GlobalContext globalContext;
+  SequenceStore* store = globalContext.sequenceStore;
+  SequenceContext* sequenceContext = globalContext.sequenceContext();
+  Sequence* u =
+      addSequence(store, type, definition, "0", "0", sequenceContext);
+  double coefficients[Sequence::k_numberOfAffineCoefficients];
+  quiz_assert(u->isAffineRecurrence(sequenceContext, coefficients) ==
+              isAffine);
+  if (isAffine) {
+    assert_roughly_equal(coefficients[0], a);
+    assert_roughly_equal(coefficients[1], b);
+    assert_roughly_equal(coefficients[2], c);
+  }
+  store->removeAll();
+  store->tidyDownstreamPoolFrom();
+}
+
+QUIZ_CASE(sequence_affine_recurrence) {
+  assert_affine_coefficients(Sequence::Type::SingleRecurrence, "u(n)", true,
+                             1.);
+  assert_affine_coefficients(Sequence::Type::SingleRecurrence,
+                             "(u(n)-3)/2+cos(0)", true, 0.5, 0., -0.5);
+  assert_affine_coefficients(Sequence::Type::DoubleRecurrence,
+                             "3u(n+1)-u(n)/4+2u(n+1)+1", true, 5., -0.25, 1.);
+  assert_affine_coefficients(Sequence::Type::SingleRecurrence, "u(n)^2",
+                             false);
+  assert_affine_coefficients(Sequence::Type::SingleRecurrence, "n*u(n)",
+                             false);
+  assert_affine_coefficients(Sequence::Type::SingleRecurrence, "u(n)+u(0)",
+                             false);
+  assert_affine_coefficients(Sequence::Type::SingleRecurrence, "u(n)+v(n)",
+                             false);
+  assert_affine_coefficients(Sequence::Type::SingleRecurrence, "u(n)+x",
+                             false);
+  assert_affine_coefficients(Sequence::Type::DoubleRecurrence, "u(n+1)u(n)",
+                             false);
+
+  Shared::GlobalContext globalContext;
+  SequenceStore* store = globalContext.sequenceStore;
+  SequenceContext* sequenceContext = globalContext.sequenceContext();
+  Sequence* u = addSequence(store, Sequence::Type::DoubleRecurrence,
+                            "u(n+1)+u(n)", "0", "1", sequenceContext);
+  Sequence* v = addSequence(store, Sequence::Type::SingleRecurrence, "1-v(n)",
+                            "0", nullptr, sequenceContext);
+  Sequence* w = addSequence(store, Sequence::Type::SingleRecurrence,
+                            "w(n)/2+1", "0", nullptr, sequenceContext);
+  quiz_assert(u->evaluateXYAtParameter(78., sequenceContext).y() ==
+              8944394323791464.);
+  quiz_assert(u->evaluateXYAtParameter(10., sequenceContext).y() == 55.);
+  quiz_assert(u->evaluateXYAtParameter(9., sequenceContext).y() == 34.);
+  // The rank is not capped
+  quiz_assert(v->evaluateXYAtParameter(123457., sequenceContext).y() == 1.);
+  quiz_assert(v->evaluateXYAtParameter(123456., sequenceContext).y() == 0.);
+  assert_roughly_equal(w->evaluateXYAtParameter(20., sequenceContext).y(),
+                       2. - std::pow(2., -19.));
+  // Overflows are stepped through
+  quiz_assert(u->evaluateXYAtParameter(2000., sequenceContext).y() == INFINITY);
+  store->removeAll();
+  store->tidyDownstreamPoolFrom();
+}
+
 QUIZ_CASE(sequence_suitable_for_cobweb) {
   Shared::GlobalContext globalContext;
   SequenceStore* store = globalContext.sequenceStore;
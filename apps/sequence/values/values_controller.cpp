@@ -179,15 +179,44 @@ void ValuesController::createMemoizedLayout(int column, int row, int index) {
     result =
         sequence->sumBetweenBounds(sequence->initialRank(), abscissa, context);
   } else {
-    Coordinate2D<double> xy =
-        sequence->evaluateXYAtParameter(abscissa, context);
-    result = Float<double>::Builder(xy.y());
+    double value;
+    if (!precomputedValueAtMemoizedIndex(index, &value)) {
+      value = sequence->evaluateXYAtParameter(abscissa, context).y();
+    }
+    result = Float<double>::Builder(value);
   }
   *memoizedLayoutAtIndex(index) = result.createLayout(
       Preferences::PrintFloatMode::Decimal,
       Preferences::VeryLargeNumberOfSignificantDigits, context);
 }
 
+void ValuesController::precomputeMemoizedValue(int column, int row, int index,
+                                               PageValues *values) {
+  bool isSumColumn = false;
+  Ion::Storage::Record record = recordAtColumn(column, &isSumColumn);
+  Shared::ExpiringPointer<Shared::Sequence> sequence =
+      functionStore()->modelForRecord(record);
+  Shared::SequenceContext *context = App::app()->localContext();
+  /* Only the terms of explicit sequences are approximations of a same
+   * expression, as computed by Sequence::approximateAtRank. */
+  int rank = std::round(intervalAtColumn(column)->element(row - 1));
+  if (isSumColumn || sequence->type() != Shared::Sequence::Type::Explicit ||
+      !sequence->isDefined() || rank < sequence->initialRank() ||
+      context->sequenceIsNotComputable(
+          Shared::SequenceStore::SequenceIndexForName(
+              sequence->fullName()[0]))) {
+    return;
+  }
+  int columnIndex = values->indexOfColumn(column);
+  if (columnIndex < 0) {
+    columnIndex = values->addColumn(
+        column, sequence->expressionReduced(context),
+        Shared::Sequence::k_unknownName, sequence->complexFormat(context),
+        Preferences::sharedPreferences->angleUnit());
+  }
+  values->addCell(columnIndex, rank, index);
+}
+
 Shared::Interval *ValuesController::intervalAtColumn(int column) {
   return App::app()->interval();
 }
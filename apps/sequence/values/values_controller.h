@@ -87,6 +87,8 @@ class ValuesController : public Shared::ValuesController,
     setDefaultStartEndMessages();
   }
   void createMemoizedLayout(int i, int j, int index) override;
+  void precomputeMemoizedValue(int i, int j, int index,
+                               PageValues *values) override;
   Shared::Interval *intervalAtColumn(int column) override;
   I18n::Message valuesParameterMessageAtColumn(int column) const override {
     return I18n::Message::N;
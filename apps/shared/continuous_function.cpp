@@ -33,7 +33,6 @@ namespace Shared {
 
 ContinuousFunction ContinuousFunction::NewModel(
     Ion::Storage::Record::ErrorStatus *error, const char *baseName) {
-  static int s_colorIndex = 0;
   assert(baseName != nullptr);
   // Create the record
   /* WARNING: We create an empty record with the baseName and extension right
@@ -46,7 +45,8 @@ ContinuousFunction ContinuousFunction::NewModel(
    * calling the method "createRecordWithExtension". */
   Ion::Storage::Record record =
       Ion::Storage::Record(baseName, Ion::Storage::funcExtension);
-  RecordDataBuffer data(Escher::Palette::nextDataColor(&s_colorIndex));
+  RecordDataBuffer data(
+      GlobalContext::continuousFunctionStore->nextFunctionColor());
   *error =
       Ion::Storage::FileSystem::sharedFileSystem->createRecordWithExtension(
           baseName, Ion::Storage::funcExtension, &data, sizeof(data));
@@ -280,19 +280,31 @@ double ContinuousFunction::approximateDerivative(double x, Context *context,
                                                  bool useDomain) const {
   assert(canDisplayDerivative());
   assert(subCurveIndex < numberOfSubCurves());
-  if ((useDomain && (x < tMin() || x > tMax())) || isAlongY() ||
-      numberOfSubCurves() > 1) {
+  if (useDomain && (x < tMin() || x > tMax())) {
+    return NAN;
+  }
+  Preferences::ComplexFormat complexFormat;
+  Expression derivate = derivativeToApproximate(context, &complexFormat);
+  if (derivate.isUninitialized()) {
     return NAN;
   }
-  // Derivative is simplified once and for all
-  Expression derivate = expressionDerivateReduced(context);
   assert(subCurveIndex == 0);
   Preferences preferences =
-      Preferences::ClonePreferencesWithNewComplexFormat(complexFormat(context));
+      Preferences::ClonePreferencesWithNewComplexFormat(complexFormat);
   return PoincareHelpers::ApproximateWithValueForSymbol(
       derivate, k_unknownName, x, context, &preferences, false);
 }
 
+Expression ContinuousFunction::derivativeToApproximate(
+    Context *context, Preferences::ComplexFormat *complexFormat) const {
+  if (isAlongY() || numberOfSubCurves() > 1) {
+    return Expression();
+  }
+  *complexFormat = this->complexFormat(context);
+  // Derivative is simplified once and for all
+  return expressionDerivateReduced(context);
+}
+
 Poincare::Layout ContinuousFunction::derivativeTitleLayout() {
   constexpr size_t bufferNameSize =
       ContinuousFunction::k_maxNameWithArgumentSize + 1;
@@ -403,6 +415,46 @@ Coordinate2D<T> ContinuousFunction::privateEvaluateXYAtParameter(
   return Coordinate2D<T>(r * std::cos(angle), r * std::sin(angle));
 }
 
+bool ContinuousFunction::privateEvaluateYAtParameters(
+    const float *t, float *y, int numberOfValues, Context *context) const {
+  if (!properties().isCartesian() || isAlongY()) {
+    return false;
+  }
+  // The program is compiled along with the approximated expression
+  expressionApproximated(context);
+  const ApproximationProgram &program = m_model.approximationProgram();
+  if (program.isEmpty()) {
+    return false;
+  }
+  Preferences preferences =
+      Preferences::ClonePreferencesWithNewComplexFormat(complexFormat(context));
+  program.approximateWithValuesForSymbol(0, t, y, numberOfValues,
+                                         preferences.complexFormat(),
+                                         preferences.angleUnit());
+  for (int i = 0; i < numberOfValues; i++) {
+    if (t[i] < tMin() || t[i] > tMax()) {
+      y[i] = NAN;
+    }
+  }
+  return true;
+}
+
+/* Approximate the component of the function with the compiled program if
+ * there is one, since it is much faster than walking the expression. */
+template <typename T>
+static T ApproximateComponentWithValueForSymbol(
+    const ApproximationProgram &program, int componentIndex,
+    const Expression component, const char *symbol, T x, Context *context,
+    Preferences *preferences) {
+  if (program.isEmpty()) {
+    return PoincareHelpers::ApproximateWithValueForSymbol(
+        component, symbol, x, context, preferences, false);
+  }
+  return program.approximateWithValueForSymbol(componentIndex, x,
+                                               preferences->complexFormat(),
+                                               preferences->angleUnit());
+}
+
 template <typename T>
 Coordinate2D<T> ContinuousFunction::templatedApproximateAtParameter(
     T t, Context *context, int subCurveIndex) const {
@@ -444,16 +496,14 @@ Coordinate2D<T> ContinuousFunction::templatedApproximateAtParameter(
     } else {
       assert(subCurveIndex == 0);
     }
+    T value = ApproximateComponentWithValueForSymbol(
+        m_model.approximationProgram(), subCurveIndex, e, k_unknownName, t,
+        context, &preferences);
     if (isAlongY()) {
       // Invert x and y with vertical lines so it can be scrolled vertically
-      return Coordinate2D<T>(
-          PoincareHelpers::ApproximateWithValueForSymbol(
-              e, k_unknownName, t, context, &preferences, false),
-          t);
+      return Coordinate2D<T>(value, t);
     }
-    return Coordinate2D<T>(
-        t, PoincareHelpers::ApproximateWithValueForSymbol(
-               e, k_unknownName, t, context, &preferences, false));
+    return Coordinate2D<T>(t, value);
   }
   if (e.type() == ExpressionNode::Type::Dependency) {
     e = e.childAtIndex(0);
@@ -466,10 +516,12 @@ Coordinate2D<T> ContinuousFunction::templatedApproximateAtParameter(
   assert(static_cast<Matrix &>(e).numberOfRows() == 2);
   assert(static_cast<Matrix &>(e).numberOfColumns() == 1);
   return Coordinate2D<T>(
-      PoincareHelpers::ApproximateWithValueForSymbol(
-          e.childAtIndex(0), k_unknownName, t, context, &preferences, false),
-      PoincareHelpers::ApproximateWithValueForSymbol(
-          e.childAtIndex(1), k_unknownName, t, context, &preferences, false));
+      ApproximateComponentWithValueForSymbol(m_model.approximationProgram(), 0,
+                                             e.childAtIndex(0), k_unknownName,
+                                             t, context, &preferences),
+      ApproximateComponentWithValueForSymbol(m_model.approximationProgram(), 1,
+                                             e.childAtIndex(1), k_unknownName,
+                                             t, context, &preferences));
 }
 
 /* ContinuousFunction::Model */
@@ -609,6 +661,7 @@ Poincare::Expression ContinuousFunction::Model::expressionApproximated(
         SymbolicComputation::DoNotReplaceAnySymbol,
         PoincareHelpers::k_defaultUnitConversion, &preferences, false);
     m_expressionApproximated = e;
+    compileApproximationProgram(record);
   }
   return m_expressionApproximated;
 }
@@ -937,6 +990,7 @@ void ContinuousFunction::Model::tidyDownstreamPoolFrom(
   if (treePoolCursor == nullptr ||
       m_expressionApproximated.isDownstreamOf(treePoolCursor)) {
     m_expressionApproximated = Expression();
+    m_approximationProgram.reset();
   }
   ExpressionModel::tidyDownstreamPoolFrom(treePoolCursor);
 }
@@ -971,6 +1025,43 @@ void ContinuousFunction::Model::setStorageChangeFlag() const {
   GlobalContext::continuousFunctionStore->setStorageChangeFlag(true);
 }
 
+void ContinuousFunction::Model::compileApproximationProgram(
+    const Ion::Storage::Record *record) const {
+  /* The components must be the expressions approximated by
+   * templatedApproximateAtParameter for each subCurveIndex. */
+  m_approximationProgram.reset();
+  ContinuousFunctionProperties thisProperties = properties();
+  Expression e = m_expressionApproximated;
+  if (thisProperties.isScatterPlot()) {
+    return;
+  }
+  if (thisProperties.isParametric()) {
+    if (e.type() == ExpressionNode::Type::Dependency) {
+      e = e.childAtIndex(0);
+    }
+    if (e.type() != ExpressionNode::Type::Matrix) {
+      return;
+    }
+    Expression components[] = {e.childAtIndex(0), e.childAtIndex(1)};
+    m_approximationProgram.compile(components, 2, k_unknownName);
+    return;
+  }
+  int numberOfComponents = numberOfSubCurves(record);
+  if (numberOfComponents == 1) {
+    m_approximationProgram.compile(&e, 1, k_unknownName);
+    return;
+  }
+  if (numberOfComponents > ApproximationProgram::k_maxNumberOfComponents) {
+    return;
+  }
+  Expression components[ApproximationProgram::k_maxNumberOfComponents];
+  for (int i = 0; i < numberOfComponents; i++) {
+    components[i] = e.childAtIndex(i);
+  }
+  m_approximationProgram.compile(components, numberOfComponents,
+                                 k_unknownName);
+}
+
 template Coordinate2D<float>
 ContinuousFunction::templatedApproximateAtParameter<float>(float, Context *,
                                                            int) const;
@@ -10,6 +10,7 @@
  */
 
 #include <apps/i18n.h>
+#include <poincare/approximation_program.h>
 #include <poincare/comparison.h>
 #include <poincare/conic.h>
 #include <poincare/preferences.h>
@@ -133,6 +134,10 @@ class ContinuousFunction : public Function {
       double t, Poincare::Context *context, int curveIndex = 0) const override {
     return privateEvaluateXYAtParameter<double>(t, context, curveIndex);
   }
+  bool evaluateYAtParameters(const float *t, float *y, int numberOfValues,
+                             Poincare::Context *context) const {
+    return privateEvaluateYAtParameters(t, y, numberOfValues, context);
+  }
 
   double evaluateCurveParameter(int index, double cursorT, double cursorX,
                                 double cursorY,
@@ -154,6 +159,12 @@ class ContinuousFunction : public Function {
   double approximateDerivative(double x, Poincare::Context *context,
                                int subCurveIndex = 0,
                                bool useDomain = true) const;
+  /* Expression approximated by approximateDerivative and the complex format of
+   * its approximation. It is uninitialized if the derivative is always
+   * undefined. */
+  Poincare::Expression derivativeToApproximate(
+      Poincare::Context *context,
+      Poincare::Preferences::ComplexFormat *complexFormat) const;
   Poincare::Layout derivativeTitleLayout();
 
   /* tMin, tMax and tAuto */
@@ -244,6 +255,12 @@ class ContinuousFunction : public Function {
   template <typename T>
   Poincare::Coordinate2D<T> templatedApproximateAtParameter(
       T t, Poincare::Context *context, int subCurveIndex = 0) const;
+  /* Evaluate the ordinates of a cartesian curve at several abscissas at once.
+   * Return false without evaluating anything if the curve cannot be
+   * evaluated in batch. */
+  bool privateEvaluateYAtParameters(const float *t, float *y,
+                                    int numberOfValues,
+                                    Poincare::Context *context) const;
 
   /* Record */
 
@@ -306,6 +323,12 @@ class ContinuousFunction : public Function {
      * plot */
     Poincare::Expression expressionApproximated(
         const Ion::Storage::Record *record, Poincare::Context *context) const;
+    /* Return the program compiled from the expression approximated. It is
+     * memoized along with the expression approximated, and is empty if the
+     * expression could not be compiled. */
+    const Poincare::ApproximationProgram &approximationProgram() const {
+      return m_approximationProgram;
+    }
     // Return the expression reduced, and computes plotType
     Poincare::Expression expressionReducedForAnalysis(
         const Ion::Storage::Record *record, Poincare::Context *context) const;
@@ -349,6 +372,7 @@ class ContinuousFunction : public Function {
     size_t expressionSize(const Ion::Storage::Record *record) const override;
 
     void setStorageChangeFlag() const override;
+    void compileApproximationProgram(const Ion::Storage::Record *record) const;
 
     mutable ContinuousFunctionProperties m_properties;
     /* m_expression is used for values in table.
@@ -357,6 +381,9 @@ class ContinuousFunction : public Function {
      */
     mutable Poincare::Expression m_expressionApproximated;
     mutable Poincare::Expression m_expressionDerivate;
+    /* m_approximationProgram is compiled from m_expressionApproximated to
+     * evaluate it faster when plotting and filling the values table. */
+    mutable Poincare::ApproximationProgram m_approximationProgram;
   };
 
   // Return model pointer
@@ -18,10 +18,9 @@ void ContinuousFunctionCache::PrepareForCaching(void *fun,
   ContinuousFunction *function = static_cast<ContinuousFunction *>(fun);
 
   if (!cache) {
-    /* ContinuousFunctionStore::cacheAtIndex has returned a nullptr : the index
-     * of the function we are trying to draw is greater than the number of
-     * available caches, so we just tell the function to not lookup any cache.
-     */
+    /* ContinuousFunctionStore::cacheForRecord has returned a nullptr : all
+     * the caches are used by other functions, so we just tell the function to
+     * not lookup any cache. */
     function->setCache(nullptr);
     return;
   }
@@ -141,8 +140,7 @@ Poincare::Coordinate2D<float> ContinuousFunctionCache::valuesAtIndex(
   assert(curveIndex == 0);
   if (function->properties().isCartesian()) {
     if (OMG::IsSignalingNan(m_cache[i])) {
-      m_cache[i] =
-          function->privateEvaluateXYAtParameter(t, context, curveIndex).y();
+      fillCartesianValuesFromIndex(function, context, t, i);
     }
     return Poincare::Coordinate2D<float>(t, m_cache[i]);
   }
@@ -156,6 +154,32 @@ Poincare::Coordinate2D<float> ContinuousFunctionCache::valuesAtIndex(
   return Poincare::Coordinate2D<float>(m_cache[2 * i], m_cache[2 * i + 1]);
 }
 
+void ContinuousFunctionCache::fillCartesianValuesFromIndex(
+    const ContinuousFunction *function, Poincare::Context *context, float t,
+    int i) {
+  assert(function->properties().isCartesian());
+  // Index of t relative to m_tMin
+  int firstIndex = (i - m_startOfCache + k_sizeOfCache) % k_sizeOfCache;
+  float parameters[k_maxNumberOfValuesComputedAtOnce];
+  parameters[0] = t;
+  int n = 1;
+  while (n < k_maxNumberOfValuesComputedAtOnce &&
+         firstIndex + n < k_sizeOfCache &&
+         OMG::IsSignalingNan(m_cache[(i + n) % k_sizeOfCache])) {
+    parameters[n] = m_tMin + (firstIndex + n) * m_tStep;
+    n++;
+  }
+  float values[k_maxNumberOfValuesComputedAtOnce];
+  if (!function->privateEvaluateYAtParameters(parameters, values, n,
+                                              context)) {
+    m_cache[i] = function->privateEvaluateXYAtParameter(t, context, 0).y();
+    return;
+  }
+  for (int k = 0; k < n; k++) {
+    m_cache[(i + k) % k_sizeOfCache] = values[k];
+  }
+}
+
 void ContinuousFunctionCache::pan(ContinuousFunction *function, float newTMin) {
   assert(function->properties().isCartesian());
   if (newTMin == m_tMin) {
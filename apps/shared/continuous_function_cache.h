@@ -12,7 +12,13 @@ class ContinuousFunction;
 
 class ContinuousFunctionCache {
  public:
-  constexpr static int k_numberOfAvailableCaches = 2;
+  /* The caches are lent by the ContinuousFunctionStore to the functions it
+   * draws, see ContinuousFunctionStore::cacheForRecord. Each cache takes
+   * 4 * Ion::Display::Width bytes, so the 4 caches of the store take 5 KB of
+   * RAM. Beyond 4 functions drawn at once, the last drawn ones have no cache
+   * and are evaluated again on each redraw. A cache covers one value per
+   * column of pixels, so it cannot be split between more functions. */
+  constexpr static int k_numberOfAvailableCaches = 4;
 
   static void PrepareForCaching(void* fun, ContinuousFunctionCache* cache,
                                 float tMin, float tStep);
@@ -53,6 +59,10 @@ class ContinuousFunctionCache {
    * TODO: The drawCurve algorithm should use the derivative function to know
    * how fast the function moves... */
   constexpr static float k_graphStepDenominator = 80.0938275501223f;
+  /* Cartesian curves are drawn from left to right, so the missing values
+   * following a cache miss are computed along with it when the function can
+   * be evaluated in batch. */
+  constexpr static int k_maxNumberOfValuesComputedAtOnce = 16;
 
   void invalidateBetween(int iInf, int iSup);
   void setRange(float tMin, float tStep);
@@ -61,6 +71,9 @@ class ContinuousFunctionCache {
   Poincare::Coordinate2D<float> valuesAtIndex(
       const ContinuousFunction* function, Poincare::Context* context, float t,
       int i, int curveIndex);
+  void fillCartesianValuesFromIndex(const ContinuousFunction* function,
+                                    Poincare::Context* context, float t,
+                                    int i);
   void pan(ContinuousFunction* function, float newTMin);
 
   float m_tMin, m_tStep;
@@ -45,6 +45,37 @@ Ion::Storage::Record::ErrorStatus ContinuousFunctionStore::addEmptyModel() {
   return error;
 }
 
+ContinuousFunctionCache* ContinuousFunctionStore::cacheForRecord(
+    Ion::Storage::Record record) const {
+  int leastRecentlyUsed = -1;
+  for (int i = 0; i < k_numberOfCaches; i++) {
+    if (m_cacheRecords[i] == record) {
+      m_cacheLastDrawingPass[i] = m_drawingPass;
+      return m_functionCaches + i;
+    }
+    uint32_t lastDrawingPass = m_cacheLastDrawingPass[i];
+    if ((m_cacheRecords[i].isNull() || lastDrawingPass != m_drawingPass) &&
+        (leastRecentlyUsed < 0 ||
+         lastDrawingPass < m_cacheLastDrawingPass[leastRecentlyUsed])) {
+      leastRecentlyUsed = i;
+    }
+  }
+  if (leastRecentlyUsed < 0) {
+    // All caches are used by functions drawn during this pass
+    return nullptr;
+  }
+  ContinuousFunctionCache* cache = m_functionCaches + leastRecentlyUsed;
+  // The previous owner of the cache must not read it anymore
+  for (ContinuousFunction& function : m_functions) {
+    if (function.cache() == cache) {
+      function.setCache(nullptr);
+    }
+  }
+  m_cacheRecords[leastRecentlyUsed] = record;
+  m_cacheLastDrawingPass[leastRecentlyUsed] = m_drawingPass;
+  return cache;
+}
+
 ExpressionModelHandle* ContinuousFunctionStore::setMemoizedModelAtIndex(
     int cacheIndex, Ion::Storage::Record record) const {
   assert(cacheIndex >= 0 && cacheIndex < maxNumberOfMemoizedModels());
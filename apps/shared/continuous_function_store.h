@@ -1,6 +1,8 @@
 #ifndef SHARED_CONTINUOUS_FUNCTION_STORE_H
 #define SHARED_CONTINUOUS_FUNCTION_STORE_H
 
+#include <escher/palette.h>
+
 #include "continuous_function.h"
 #include "function_store.h"
 
@@ -21,7 +23,12 @@ class ContinuousFunctionStore : public FunctionStore {
            static_cast<ContinuousFunction *>(model)->canDisplayDerivative();
   }
 
-  ContinuousFunctionStore() : FunctionStore() {}
+  ContinuousFunctionStore()
+      : FunctionStore(), m_drawingPass(0), m_colorIndex(0) {
+    for (int i = 0; i < k_numberOfCaches; i++) {
+      m_cacheLastDrawingPass[i] = 0;
+    }
+  }
   int numberOfActiveFunctionsInTable() const {
     return numberOfModelsSatisfyingTest(&IsFunctionActiveInTable, nullptr);
   }
@@ -60,15 +67,23 @@ class ContinuousFunctionStore : public FunctionStore {
   KDColor colorForRecord(Ion::Storage::Record record) const override {
     return modelForRecord(record)->color();
   }
-  ContinuousFunctionCache *cacheAtIndex(int i) const {
-    return (i < ContinuousFunctionCache::k_numberOfAvailableCaches)
-               ? m_functionCaches + i
-               : nullptr;
-  }
+  /* Caches are lent to the functions as they are drawn. A cache used during
+   * the current drawing pass is never taken back, so that functions drawn in
+   * cycle do not evict each other's cache. Otherwise, the least recently used
+   * cache is lent to the function. */
+  void startDrawingPass() const { m_drawingPass++; }
+  ContinuousFunctionCache *cacheForRecord(Ion::Storage::Record record) const;
   Ion::Storage::Record::ErrorStatus addEmptyModel() override;
+  // New functions are given the colors of the palette in turn
+  KDColor nextFunctionColor() {
+    return Escher::Palette::nextDataColor(&m_colorIndex);
+  }
   int maxNumberOfModels() const override { return k_maxNumberOfModels; }
 
  private:
+  constexpr static int k_numberOfCaches =
+      ContinuousFunctionCache::k_numberOfAvailableCaches;
+
   static bool IsFunctionActiveInTable(ExpressionModelHandle *model,
                                       void *context) {
     // An active function must be defined
@@ -109,8 +124,11 @@ class ContinuousFunctionStore : public FunctionStore {
   mutable uint32_t m_storageCheckSum;
   mutable int m_memoizedNumberOfActiveFunctions;
   mutable ContinuousFunction m_functions[k_maxNumberOfMemoizedModels];
-  mutable ContinuousFunctionCache
-      m_functionCaches[ContinuousFunctionCache::k_numberOfAvailableCaches];
+  mutable ContinuousFunctionCache m_functionCaches[k_numberOfCaches];
+  mutable Ion::Storage::Record m_cacheRecords[k_numberOfCaches];
+  mutable uint32_t m_cacheLastDrawingPass[k_numberOfCaches];
+  mutable uint32_t m_drawingPass;
+  int m_colorIndex;
 };
 
 }  // namespace Shared
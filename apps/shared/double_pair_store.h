@@ -5,6 +5,7 @@
 #include <escher/palette.h>
 #include <kandinsky/color.h>
 #include <poincare/float_list.h>
+#include <poincare/helpers.h>
 #include <poincare/range.h>
 #include <stdint.h>
 
@@ -181,6 +182,9 @@ class DoublePairStore {
  private:
   static_assert(k_maxNumberOfPairs <= UINT8_MAX,
                 "k_maxNumberOfPairs is too large.");
+  static_assert(k_maxNumberOfPairs <=
+                    Poincare::Helpers::k_maxNumberOfIndexedElements,
+                "Columns could not be sorted with an index.");
   bool storeColumn(int series, int i) const;
   void deleteTrailingUndef(int series, int i);
   void deletePairsOfUndef(int series);
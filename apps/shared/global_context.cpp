@@ -288,6 +288,13 @@ void GlobalContext::tidyDownstreamPoolFrom(TreeNode *treePoolCursor) {
   continuousFunctionStore->tidyDownstreamPoolFrom(treePoolCursor);
 }
 
+bool GlobalContext::identifyDefinitions(uint32_t *identifier) {
+  /* All the definitions are records, and the values of the sequences are
+   * computed from them. */
+  *identifier = Ion::Storage::FileSystem::sharedFileSystem->checksum();
+  return true;
+}
+
 void GlobalContext::prepareForNewApp() {
   sequenceStore->setStorageChangeFlag(false);
   continuousFunctionStore->setStorageChangeFlag(false);
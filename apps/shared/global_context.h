@@ -50,6 +50,7 @@ class GlobalContext final : public Poincare::Context {
   SequenceContext *sequenceContext() { return &m_sequenceContext; }
   void tidyDownstreamPoolFrom(
       Poincare::TreeNode *treePoolCursor = nullptr) override;
+  bool identifyDefinitions(uint32_t *identifier) override;
   void prepareForNewApp();
   void reset();
 
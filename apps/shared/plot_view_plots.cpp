@@ -1,5 +1,7 @@
 #include "plot_view_plots.h"
 
+#include <omg/bit_helper.h>
+
 #include <algorithm>
 
 #include "float.h"
@@ -163,10 +165,16 @@ void WithCurves::CurveDrawing::draw(const AbstractPlotView *plotView,
                                                    : &Coordinate2D<float>::x;
   int i = 0;
   bool isLastSegment = false;
+  /* Skipping samples would leave holes in the pattern, which is drawn for
+   * each sample. */
+  bool canSkipSamples = !(m_patternStart < m_patternEnd);
+  // Number of steps between previousT and t
+  int stepFactor = 1;
+  Coordinate2D<float> previousPreviousXY;
 
   do {
     previousT = t;
-    t = m_tStart + (i++) * m_tStep;
+    t = m_tStart + i * m_tStep;
     if (t <= m_tStart) {
       t = m_tStart + FLT_EPSILON;
     }
@@ -176,8 +184,10 @@ void WithCurves::CurveDrawing::draw(const AbstractPlotView *plotView,
     }
     if (previousT == t) {
       // No need to draw segment. Happens when tStep << tStart .
+      i += stepFactor;
       continue;
     }
+    previousPreviousXY = previousXY;
     previousXY = xy;
     xy = m_curve.evaluate(t, m_context);
 
@@ -205,8 +215,19 @@ void WithCurves::CurveDrawing::draw(const AbstractPlotView *plotView,
                            (xy.*abscissa)(), patternMin, patternMax);
     }
 
+    /* A segment spanning several steps is given the iterations needed to refine
+     * it down to the resolution of a single step. Curves drawn with straight
+     * lines only at the end of the refinement, such as polar and parametric
+     * ones, are thus drawn as precisely as with every sample. */
     joinDots(plotView, ctx, rect, previousT, previousXY, t, xy,
-             k_maxNumberOfIterations, m_discontinuity);
+             k_maxNumberOfIterations +
+                 OMG::BitHelper::countTrailingZeros(stepFactor),
+             m_discontinuity);
+    if (canSkipSamples) {
+      stepFactor = nextStepFactor(plotView, stepFactor, previousPreviousXY,
+                                  previousT, previousXY, t, xy);
+    }
+    i += stepFactor;
   } while (!isLastSegment);
 
   plotView->setDashed(false);
@@ -220,6 +241,46 @@ static bool pointInBoundingBox(float x1, float y1, float x2, float y2, float xC,
           (y2 == yC && yC == y1));
 }
 
+int WithCurves::CurveDrawing::nextStepFactor(
+    const AbstractPlotView *plotView, int stepFactor, Coordinate2D<float> xy0,
+    float t1, Coordinate2D<float> xy1, float t2,
+    Coordinate2D<float> xy2) const {
+  if (std::isnan(t1) || !std::isfinite(xy0.x()) || !std::isfinite(xy0.y()) ||
+      !std::isfinite(xy1.x()) || !std::isfinite(xy1.y()) ||
+      !std::isfinite(xy2.x()) || !std::isfinite(xy2.y()) ||
+      m_discontinuity(t1, t2, m_curve.model(), m_context)) {
+    return 1;
+  }
+  /* The bend of the curve is estimated with the distance in pixels between
+   * the middle dot and the line joining the two others. */
+  Coordinate2D<float> p0 = plotView->floatToPixel2D(xy0);
+  Coordinate2D<float> p1 = plotView->floatToPixel2D(xy1);
+  Coordinate2D<float> p2 = plotView->floatToPixel2D(xy2);
+  float chordX = p2.x() - p0.x();
+  float chordY = p2.y() - p0.y();
+  float chordLength = std::sqrt(chordX * chordX + chordY * chordY);
+  float dx = p1.x() - p0.x();
+  float dy = p1.y() - p0.y();
+  float distance = chordLength == 0.f
+                       ? std::sqrt(dx * dx + dy * dy)
+                       : std::fabs(chordX * dy - chordY * dx) / chordLength;
+  if (!(distance < k_flatnessTolerance)) {
+    return 1;
+  }
+  /* Samples are kept at most a pixel apart, so that any feature of the curve
+   * wider than a pixel contains a sample. The length of a step is estimated
+   * from the last segment. */
+  float segmentX = p2.x() - p1.x();
+  float segmentY = p2.y() - p1.y();
+  float stepLength = std::sqrt(segmentX * segmentX + segmentY * segmentY) *
+                     m_tStep / (t2 - t1);
+  int factor = std::min(2 * stepFactor, k_maxStepFactor);
+  while (factor > 1 && factor * stepLength > 1.f) {
+    factor /= 2;
+  }
+  return factor;
+}
+
 void WithCurves::CurveDrawing::joinDots(const AbstractPlotView *plotView,
                                         KDContext *ctx, KDRect rect, float t1,
                                         Coordinate2D<float> xy1, float t2,
@@ -103,7 +103,19 @@ class WithCurves {
      * screen though.
      */
     constexpr static int k_maxNumberOfIterations = 8;
-
+    /* Where the curve is flat and m_tStep covers less than a pixel, it is
+     * sampled with a step up to k_maxStepFactor times larger, as long as the
+     * samples stay at most a pixel apart. The step is reset to m_tStep as
+     * soon as the curve bends by more than k_flatnessTolerance pixels, is
+     * discontinuous or undefined. joinDots still refines the larger steps if
+     * needed. */
+    constexpr static int k_maxStepFactor = 4;
+    constexpr static float k_flatnessTolerance = 0.5f;
+
+    int nextStepFactor(const AbstractPlotView *plotView, int stepFactor,
+                       Poincare::Coordinate2D<float> xy0, float t1,
+                       Poincare::Coordinate2D<float> xy1, float t2,
+                       Poincare::Coordinate2D<float> xy2) const;
     void joinDots(const AbstractPlotView *plotView, KDContext *ctx, KDRect rect,
                   float t1, Poincare::Coordinate2D<float> xy1, float t2,
                   Poincare::Coordinate2D<float> xy2, int remainingIterations,
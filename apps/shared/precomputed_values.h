@@ -0,0 +1,139 @@
+#ifndef SHARED_PRECOMPUTED_VALUES_H
+#define SHARED_PRECOMPUTED_VALUES_H
+
+#include <assert.h>
+#include <ion/workers.h>
+#include <poincare/approximation_program.h>
+#include <poincare/exception_checkpoint.h>
+#include <poincare/tree_pool.h>
+#include <stdint.h>
+
+namespace Shared {
+
+/* PrecomputedValues approximates the cells of a page of a values table before
+ * their layouts are created one at a time. All the cells of a table column
+ * approximate the same expression for different abscissas, so the expression
+ * is compiled once into an ApproximationProgram and the values are stored in a
+ * buffer per column.
+ * Running a program reads neither the expression tree nor the context, so
+ * Ion::Workers can approximate the columns on several threads. Each worker only
+ * builds the transient evaluations of the program in a pool of its own. */
+
+template <int MaxNumberOfColumns, int MaxNumberOfRows>
+class PrecomputedValues {
+ public:
+  PrecomputedValues() { reset(); }
+
+  void reset() {
+    m_numberOfColumns = 0;
+    for (int i = 0; i < k_maxNumberOfCells; i++) {
+      m_columnOfCell[i] = -1;
+    }
+  }
+
+  // Index of the table column among the columns added since the last reset
+  int indexOfColumn(int tableColumn) const {
+    for (int c = 0; c < m_numberOfColumns; c++) {
+      if (m_columns[c].tableColumn == tableColumn) {
+        return c;
+      }
+    }
+    return -1;
+  }
+
+  /* Compile the expression approximated by the cells of the table column.
+   * Return the index of the column, or -1 if there is no room left for it. If
+   * the expression cannot be compiled, the cells added to the column are
+   * ignored and must be approximated one at a time. */
+  int addColumn(int tableColumn, const Poincare::Expression e,
+                const char* symbol,
+                Poincare::Preferences::ComplexFormat complexFormat,
+                Poincare::Preferences::AngleUnit angleUnit) {
+    if (m_numberOfColumns == MaxNumberOfColumns) {
+      return -1;
+    }
+    Column* column = m_columns + m_numberOfColumns;
+    column->tableColumn = tableColumn;
+    column->complexFormat = complexFormat;
+    column->angleUnit = angleUnit;
+    column->numberOfCells = 0;
+    column->isComputed = false;
+    column->program.compile(&e, 1, symbol);
+    return m_numberOfColumns++;
+  }
+
+  void addCell(int columnIndex, double abscissa, int memoizedIndex) {
+    assert(0 <= memoizedIndex && memoizedIndex < k_maxNumberOfCells);
+    if (columnIndex < 0 || m_columns[columnIndex].program.isEmpty()) {
+      return;
+    }
+    Column* column = m_columns + columnIndex;
+    assert(column->numberOfCells < MaxNumberOfRows);
+    m_columnOfCell[memoizedIndex] = columnIndex;
+    m_rowOfCell[memoizedIndex] = column->numberOfCells;
+    column->abscissas[column->numberOfCells++] = abscissa;
+  }
+
+  // Approximate the cells added since the last reset, a column per task
+  void compute() {
+    Ion::Workers::Run(ComputeColumns, m_numberOfColumns, this);
+  }
+
+  // Return false if the cell was not precomputed
+  bool valueAtMemoizedIndex(int memoizedIndex, double* value) const {
+    assert(0 <= memoizedIndex && memoizedIndex < k_maxNumberOfCells);
+    int columnIndex = m_columnOfCell[memoizedIndex];
+    if (columnIndex < 0 || !m_columns[columnIndex].isComputed) {
+      return false;
+    }
+    *value = m_columns[columnIndex].values[m_rowOfCell[memoizedIndex]];
+    return true;
+  }
+
+ private:
+  constexpr static int k_maxNumberOfCells =
+      MaxNumberOfColumns * MaxNumberOfRows;
+
+  struct Column {
+    Poincare::ApproximationProgram program;
+    double abscissas[MaxNumberOfRows];
+    double values[MaxNumberOfRows];
+    int tableColumn;
+    int numberOfCells;
+    Poincare::Preferences::ComplexFormat complexFormat;
+    Poincare::Preferences::AngleUnit angleUnit;
+    bool isComputed;
+  };
+
+  static void ComputeColumns(int start, int end, void* context) {
+    PrecomputedValues* values = static_cast<PrecomputedValues*>(context);
+    Poincare::TreePool::WorkerScope workerScope;
+    for (int c = start; c < end; c++) {
+      values->computeColumn(values->m_columns + c);
+    }
+  }
+
+  void computeColumn(Column* column) {
+    if (column->program.isEmpty() || column->numberOfCells == 0) {
+      return;
+    }
+    /* If the pool of the thread is full, the cells are approximated again one
+     * at a time, which raises the exception where it can be handled. */
+    Poincare::ExceptionCheckpoint checkpoint;
+    if (ExceptionRun(checkpoint)) {
+      column->program.template approximateWithValuesForSymbol<double>(
+          0, column->abscissas, column->values, column->numberOfCells,
+          column->complexFormat, column->angleUnit);
+      column->isComputed = true;
+    }
+  }
+
+  Column m_columns[MaxNumberOfColumns];
+  int8_t m_columnOfCell[k_maxNumberOfCells];
+  uint8_t m_rowOfCell[k_maxNumberOfCells];
+  int m_numberOfColumns;
+};
+
+}  // namespace Shared
+
+#endif
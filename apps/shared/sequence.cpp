@@ -140,6 +140,112 @@ bool Sequence::isSuitableForCobweb(Context *context) const {
          !mainExpressionContainsForbiddenTerms(context, true, false, false);
 }
 
+static bool IsSequenceOrSystemSymbol(const Expression e, Context *context) {
+  return e.type() == ExpressionNode::Type::Sequence ||
+         (e.type() == ExpressionNode::Type::Symbol &&
+          static_cast<const Symbol &>(e).isSystemSymbol());
+}
+
+static bool DependsOnRank(const Expression e, Context *context) {
+  return e.recursivelyMatches(IsSequenceOrSystemSymbol, context,
+                              SymbolicComputation::DoNotReplaceAnySymbol);
+}
+
+/* Add factor*e to the coefficients {a, b, c} of an affine recurrence, e being
+ * a term of its simplified main expression. */
+static bool AddAffineTerm(const Expression e, double factor,
+                          Sequence::Type type, Context *context,
+                          Preferences *preferences, double *coefficients) {
+  if (!DependsOnRank(e, context)) {
+    double value = PoincareHelpers::ApproximateToScalar<double>(
+        e, context, preferences, false);
+    if (!std::isfinite(value)) {
+      return false;
+    }
+    coefficients[2] += factor * value;
+    return true;
+  }
+  switch (e.type()) {
+    case ExpressionNode::Type::Sequence: {
+      /* Other sequences and other ranks are forbidden terms, so the rank is n
+       * or n+1 if it depends on n. */
+      Expression rank = e.childAtIndex(0);
+      if (!DependsOnRank(rank, context)) {
+        // u(i) and u(i+1) are not handled
+        return false;
+      }
+      bool isUn = rank.type() == ExpressionNode::Type::Symbol;
+      assert(isUn || type == Sequence::Type::DoubleRecurrence);
+      // u(n) is the last term of simple recurrences, u(n+1) of double ones
+      int index = isUn && type == Sequence::Type::DoubleRecurrence ? 1 : 0;
+      coefficients[index] += factor;
+      return true;
+    }
+    case ExpressionNode::Type::Addition: {
+      int n = e.numberOfChildren();
+      for (int i = 0; i < n; i++) {
+        if (!AddAffineTerm(e.childAtIndex(i), factor, type, context,
+                           preferences, coefficients)) {
+          return false;
+        }
+      }
+      return true;
+    }
+    case ExpressionNode::Type::Subtraction:
+      return AddAffineTerm(e.childAtIndex(0), factor, type, context,
+                           preferences, coefficients) &&
+             AddAffineTerm(e.childAtIndex(1), -factor, type, context,
+                           preferences, coefficients);
+    case ExpressionNode::Type::Opposite:
+      return AddAffineTerm(e.childAtIndex(0), -factor, type, context,
+                           preferences, coefficients);
+    case ExpressionNode::Type::Parenthesis:
+      return AddAffineTerm(e.childAtIndex(0), factor, type, context,
+                           preferences, coefficients);
+    case ExpressionNode::Type::Division:
+    case ExpressionNode::Type::Multiplication: {
+      // Only one factor can depend on the sequence, and not a denominator
+      bool isDivision = e.type() == ExpressionNode::Type::Division;
+      int n = e.numberOfChildren();
+      int termIndex = -1;
+      for (int i = 0; i < n; i++) {
+        Expression child = e.childAtIndex(i);
+        if (DependsOnRank(child, context)) {
+          if (termIndex >= 0 || (isDivision && i == 1)) {
+            return false;
+          }
+          termIndex = i;
+          continue;
+        }
+        double value = PoincareHelpers::ApproximateToScalar<double>(
+            child, context, preferences, false);
+        factor = isDivision ? factor / value : factor * value;
+      }
+      assert(termIndex >= 0);
+      return std::isfinite(factor) &&
+             AddAffineTerm(e.childAtIndex(termIndex), factor, type, context,
+                           preferences, coefficients);
+    }
+    default:
+      return false;
+  }
+}
+
+bool Sequence::isAffineRecurrence(SequenceContext *sqctx,
+                                  double *coefficients) const {
+  if (type() == Type::Explicit ||
+      mainExpressionContainsForbiddenTerms(sqctx, true, false, false)) {
+    return false;
+  }
+  for (int i = 0; i < k_numberOfAffineCoefficients; i++) {
+    coefficients[i] = 0.;
+  }
+  Preferences preferences =
+      Preferences::ClonePreferencesWithNewComplexFormat(complexFormat(sqctx));
+  return AddAffineTerm(expressionReduced(sqctx), 1., type(), sqctx,
+                       &preferences, coefficients);
+}
+
 bool Sequence::mainExpressionContainsForbiddenTerms(
     Context *context, bool recursionIsAllowed, bool systemSymbolIsAllowed,
     bool otherSequencesAreAllowed) const {
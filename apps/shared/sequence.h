@@ -116,6 +116,14 @@ class Sequence : public Function {
   bool mainExpressionIsNotComputable(Poincare::Context *context) const {
     return mainExpressionContainsForbiddenTerms(context, true, true, true);
   }
+  /* Sequence u (with initial rank i) is an affine recurrence if its main
+   * expression only depends on u(n) and u(n+1), with constant coefficients:
+   * - simple recurrence: u(n+1) = a*u(n)+c
+   * - double recurrence: u(n+2) = a*u(n+1)+b*u(n)+c
+   * If so, coefficients is filled with {a, b, c} (b = 0 for simple
+   * recurrences). */
+  constexpr static int k_numberOfAffineCoefficients = 3;
+  bool isAffineRecurrence(SequenceContext *sqctx, double *coefficients) const;
   int order() const { return static_cast<int>(type()); }
   int firstNonInitialRank() const { return initialRank() + order(); }
 
@@ -1,6 +1,7 @@
 #include "sequence_context.h"
 
 #include <omg/signaling_nan.h>
+#include <string.h>
 
 #include <array>
 #include <cmath>
@@ -42,6 +43,139 @@ void SequenceContext::resetComputationStatus() {
   }
 }
 
+void SequenceContext::resetPreferencesDependentCache() {
+  for (int i = 0; i < k_numberOfSequences; i++) {
+    for (int j = 0; j < k_numberOfCheckpoints; j++) {
+      for (int depth = 0; depth < k_checkpointDepth; depth++) {
+        m_checkpoints[i][j][depth] = OMG::SignalingNan<double>();
+      }
+    }
+    m_sequenceIsAffineRecurrence[i] = TrinaryBoolean::Unknown;
+  }
+  m_cacheAngleUnit = Preferences::sharedPreferences->angleUnit();
+  m_cacheComplexFormat = Preferences::sharedPreferences->complexFormat();
+}
+
+void SequenceContext::resetOutdatedCache() {
+  if (m_cacheAngleUnit != Preferences::sharedPreferences->angleUnit() ||
+      m_cacheComplexFormat != Preferences::sharedPreferences->complexFormat()) {
+    resetPreferencesDependentCache();
+  }
+}
+
+void SequenceContext::storeCheckpoint(int sequenceIndex) {
+  assert(0 <= sequenceIndex && sequenceIndex < k_numberOfSequences);
+  int rank = *rankPointer(sequenceIndex, false);
+  if (rank % k_checkpointSpacing != 0) {
+    return;
+  }
+  int checkpointIndex = rank / k_checkpointSpacing;
+  assert(0 <= checkpointIndex && checkpointIndex < k_numberOfCheckpoints);
+  double *values = valuesPointer(sequenceIndex, false);
+  for (int depth = 0; depth < k_checkpointDepth; depth++) {
+    if (OMG::IsSignalingNan(values[depth])) {
+      // The values were not all stepped through, the checkpoint is incomplete
+      return;
+    }
+  }
+  for (int depth = 0; depth < k_checkpointDepth; depth++) {
+    m_checkpoints[sequenceIndex][checkpointIndex][depth] = values[depth];
+  }
+}
+
+void SequenceContext::restoreClosestCheckpoint(int sequenceIndex,
+                                               bool intermediateComputation,
+                                               int rank) {
+  assert(0 <= sequenceIndex && sequenceIndex < k_numberOfSequences);
+  assert(0 <= rank && rank <= k_maxRecurrentRank);
+  int *currentRank = rankPointer(sequenceIndex, intermediateComputation);
+  for (int checkpointIndex = rank / k_checkpointSpacing; checkpointIndex > 0;
+       checkpointIndex--) {
+    int checkpointRank = checkpointIndex * k_checkpointSpacing;
+    if (checkpointRank <= *currentRank && *currentRank <= rank) {
+      // Stepping from the current rank is shorter
+      return;
+    }
+    const double *checkpoint = m_checkpoints[sequenceIndex][checkpointIndex];
+    if (OMG::IsSignalingNan(checkpoint[0])) {
+      continue;
+    }
+    resetValuesOfSequence(sequenceIndex, intermediateComputation);
+    double *values = valuesPointer(sequenceIndex, intermediateComputation);
+    for (int depth = 0; depth < k_checkpointDepth; depth++) {
+      values[depth] = checkpoint[depth];
+    }
+    *currentRank = checkpointRank;
+    return;
+  }
+}
+
+// result = a * b, result can be a or b
+static void MultiplyMatrices(const double a[3][3], const double b[3][3],
+                             double result[3][3]) {
+  double product[3][3];
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) {
+      product[i][j] = 0.;
+      for (int k = 0; k < 3; k++) {
+        product[i][j] += a[i][k] * b[k][j];
+      }
+    }
+  }
+  memcpy(result, product, sizeof(product));
+}
+
+bool SequenceContext::jumpToRankOfAffineRecurrence(int sequenceIndex,
+                                                   int rank) {
+  assert(0 <= sequenceIndex && sequenceIndex < k_numberOfSequences);
+  if (!sequenceIsAffineRecurrence(sequenceIndex)) {
+    return false;
+  }
+  bool intermediateComputation = m_isInsideComputation;
+  Sequence *s = sequenceAtNameIndex(sequenceIndex);
+  int lastInitialRank = s->firstNonInitialRank() - 1;
+  assert(rank > lastInitialRank);
+  stepUntilRank(sequenceIndex, lastInitialRank);
+  /* With k = lastInitialRank, the terms {u(n), u(n-1), 1} are
+   * M^(n-k) * {u(k), u(k-1), 1} where M is the matrix of the recurrence
+   * {{a, b, c}, {1, 0, 0}, {0, 0, 1}}. u(k-1) is not needed by simple
+   * recurrences, for which b = 0. */
+  double terms[3] = {
+      storedValueOfSequenceAtRank(sequenceIndex, lastInitialRank),
+      s->type() == Sequence::Type::DoubleRecurrence
+          ? storedValueOfSequenceAtRank(sequenceIndex, lastInitialRank - 1)
+          : 0.,
+      1.};
+  const double *coefficients = m_affineCoefficients[sequenceIndex];
+  double matrix[3][3] = {{coefficients[0], coefficients[1], coefficients[2]},
+                         {1., 0., 0.},
+                         {0., 0., 1.}};
+  double power[3][3] = {{1., 0., 0.}, {0., 1., 0.}, {0., 0., 1.}};
+  for (int exponent = rank - lastInitialRank; exponent > 0; exponent /= 2) {
+    if (exponent % 2 == 1) {
+      MultiplyMatrices(power, matrix, power);
+    }
+    MultiplyMatrices(matrix, matrix, matrix);
+  }
+  double values[k_checkpointDepth];
+  for (int i = 0; i < k_checkpointDepth; i++) {
+    values[i] = 0.;
+    for (int j = 0; j < 3; j++) {
+      values[i] += power[i][j] * terms[j];
+    }
+    /* Overflowing products may yield a non finite result where stepping
+     * would not, the terms are then stepped through. */
+    if (!std::isfinite(values[i])) {
+      return false;
+    }
+  }
+  resetValuesOfSequence(sequenceIndex, intermediateComputation);
+  memcpy(valuesPointer(sequenceIndex, intermediateComputation), values,
+         sizeof(values));
+  *rankPointer(sequenceIndex, intermediateComputation) = rank;
+  return true;
+}
+
 double SequenceContext::storedValueOfSequenceAtRank(int sequenceIndex,
                                                     int rank) {
   assert(0 <= sequenceIndex && sequenceIndex < k_numberOfSequences);
@@ -107,16 +241,23 @@ void SequenceContext::stepUntilRank(int sequenceIndex, int rank) {
   Sequence *s = sequenceAtNameIndex(sequenceIndex);
   assert(s->isDefined());
   assert(rank >= s->initialRank());
+  resetOutdatedCache();
   bool explicitComputation =
       rank >= s->firstNonInitialRank() && s->canBeHandledAsExplicit(this);
+  double cacheValue = storedValueOfSequenceAtRank(sequenceIndex, rank);
+  bool jumpToRank = explicitComputation || !OMG::IsSignalingNan(cacheValue);
+  if (!jumpToRank && rank >= s->firstNonInitialRank() &&
+      jumpToRankOfAffineRecurrence(sequenceIndex, rank)) {
+    return;
+  }
   if (!explicitComputation && rank > k_maxRecurrentRank) {
     return;
   }
 
-  double cacheValue = storedValueOfSequenceAtRank(sequenceIndex, rank);
-  bool jumpToRank = explicitComputation || !OMG::IsSignalingNan(cacheValue);
-
   int *currentRank = rankPointer(sequenceIndex, intermediateComputation);
+  if (!jumpToRank) {
+    restoreClosestCheckpoint(sequenceIndex, intermediateComputation, rank);
+  }
   if (*currentRank > rank) {
     resetRanksAndValuesOfSequence(sequenceIndex, intermediateComputation);
   }
@@ -166,6 +307,9 @@ void SequenceContext::stepRanks(int sequenceIndex, bool intermediateComputation,
     if (0 <= offset && offset < k_storageDepth) {
       m_initialValues[sequenceIndex][offset] = *values;
     }
+    if (!intermediateComputation) {
+      storeCheckpoint(sequenceIndex);
+    }
   }
 
   // Update computation state
@@ -222,6 +366,7 @@ void SequenceContext::resetCache() {
       m_initialValues[i][j] = OMG::SignalingNan<double>();
     }
   }
+  resetPreferencesDependentCache();
   resetComputationStatus();
   for (int i = 0; i < k_numberOfSequences; i++) {
     m_sequenceIsNotComputable[i] = TrinaryBoolean::Unknown;
@@ -265,6 +410,20 @@ bool SequenceContext::sequenceIsNotComputable(int sequenceIndex) {
   return m_sequenceIsNotComputable[sequenceIndex] == TrinaryBoolean::True;
 }
 
+bool SequenceContext::sequenceIsAffineRecurrence(int sequenceIndex) {
+  assert(0 <= sequenceIndex && sequenceIndex < k_numberOfSequences);
+  if (m_sequenceIsAffineRecurrence[sequenceIndex] == TrinaryBoolean::Unknown) {
+    m_sequenceIsAffineRecurrence[sequenceIndex] =
+        sequenceAtNameIndex(sequenceIndex)
+                ->isAffineRecurrence(this, m_affineCoefficients[sequenceIndex])
+            ? TrinaryBoolean::True
+            : TrinaryBoolean::False;
+  }
+  assert(m_sequenceIsAffineRecurrence[sequenceIndex] !=
+         TrinaryBoolean::Unknown);
+  return m_sequenceIsAffineRecurrence[sequenceIndex] == TrinaryBoolean::True;
+}
+
 int SequenceContext::rankForInitialValuesStorage(int sequenceIndex) const {
   return sequenceAtNameIndex(sequenceIndex)->initialRank() + k_storageDepth - 1;
 }
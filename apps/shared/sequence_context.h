@@ -3,6 +3,7 @@
 
 #include <poincare/context_with_parent.h>
 #include <poincare/expression.h>
+#include <poincare/preferences.h>
 #include <poincare/symbol.h>
 
 #include "sequence_store.h"
@@ -30,6 +31,7 @@ class SequenceContext : public Poincare::ContextWithParent {
   void tidyDownstreamPoolFrom(Poincare::TreeNode* treePoolCursor) override;
   SequenceStore* sequenceStore() { return m_sequenceStore; }
   bool sequenceIsNotComputable(int sequenceIndex);
+  bool sequenceIsAffineRecurrence(int sequenceIndex);
 
   void stepUntilRank(int sequenceIndex, int rank);
   int rank(int sequenceIndex, bool intermediateComputation) {
@@ -42,6 +44,18 @@ class SequenceContext : public Poincare::ContextWithParent {
   constexpr static int k_storageDepth = 6;
   constexpr static int k_numberOfSequences =
       SequenceStore::k_maxNumberOfSequences;
+  /* Recurrent sequences keep a checkpoint every k_checkpointSpacing ranks, so
+   * that any rank is reached after at most k_checkpointSpacing steps instead
+   * of stepping from the initial rank. A checkpoint holds the values at its
+   * rank and at the previous one, which is all a recurrence needs. */
+  constexpr static int k_numberOfCheckpoints = 64;
+  constexpr static int k_checkpointSpacing =
+      k_maxRecurrentRank / k_numberOfCheckpoints + 1;
+  constexpr static int k_checkpointDepth = 2;
+  constexpr static int k_numberOfAffineCoefficients =
+      Sequence::k_numberOfAffineCoefficients;
+  static_assert(k_checkpointDepth <= k_storageDepth,
+                "A checkpoint cannot be restored in the values storage");
 
   int* rankPointer(int sequenceIndex, bool intermediateComputation);
   double* valuesPointer(int sequenceIndex, bool intermediateComputation);
@@ -52,6 +66,12 @@ class SequenceContext : public Poincare::ContextWithParent {
   void resetRanksAndValuesOfSequence(int sequenceIndex,
                                      bool intermediateComputation);
   void resetComputationStatus();
+  void resetPreferencesDependentCache();
+  void resetOutdatedCache();
+  void storeCheckpoint(int sequenceIndex);
+  void restoreClosestCheckpoint(int sequenceIndex,
+                                bool intermediateComputation, int rank);
+  bool jumpToRankOfAffineRecurrence(int sequenceIndex, int rank);
   const Poincare::Expression protectedExpressionForSymbolAbstract(
       const Poincare::SymbolAbstract& symbol, bool clone,
       ContextWithParent* lastDescendantContext) override;
@@ -70,6 +90,19 @@ class SequenceContext : public Poincare::ContextWithParent {
    * always step to rank n and then step back to rank 0, replacing all values
    * stored in m_intermediateValues. */
   double m_initialValues[k_numberOfSequences][k_storageDepth];
+  // Checkpoints are only stored by main computations
+  double m_checkpoints[k_numberOfSequences][k_numberOfCheckpoints]
+                      [k_checkpointDepth];
+  /* Affine recurrences with constant coefficients are not stepped through:
+   * their terms are computed from their initial values with a power of the
+   * matrix of the recurrence, see Sequence::isAffineRecurrence. */
+  Poincare::TrinaryBoolean m_sequenceIsAffineRecurrence[k_numberOfSequences];
+  double m_affineCoefficients[k_numberOfSequences]
+                             [k_numberOfAffineCoefficients];
+  /* Checkpoints and affine coefficients depend on the angle unit and the
+   * complex format, which do not reset the cache when they change. */
+  Poincare::Preferences::AngleUnit m_cacheAngleUnit;
+  Poincare::Preferences::ComplexFormat m_cacheComplexFormat;
 
   SequenceStore* m_sequenceStore;
   bool m_isInsideComputation;
@@ -0,0 +1,112 @@
+#include <kandinsky/framebuffer.h>
+#include <quiz.h>
+
+#include <cmath>
+
+#include "../plot_view_policies.h"
+
+using namespace Poincare;
+
+namespace Shared {
+
+class FrameBufferContext : public KDContext {
+ public:
+  FrameBufferContext(KDColor* pixels, KDSize size)
+      : KDContext(KDPointZero, KDRect(KDPointZero, size)),
+        m_frameBuffer(pixels, size) {}
+
+ private:
+  void pushRect(KDRect rect, const KDColor* pixels) override {
+    m_frameBuffer.pushRect(rect, pixels);
+  }
+  void pushRectUniform(KDRect rect, KDColor color) override {
+    m_frameBuffer.pushRectUniform(rect, color);
+  }
+  void pullRect(KDRect rect, KDColor* pixels) override {
+    m_frameBuffer.pullRect(rect, pixels);
+  }
+
+  KDFrameBuffer m_frameBuffer;
+};
+
+class FixedRange : public CurveViewRange {
+ public:
+  FixedRange(float xMin, float xMax, float yMin, float yMax)
+      : m_xMin(xMin), m_xMax(xMax), m_yMin(yMin), m_yMax(yMax) {}
+  float xMin() const override { return m_xMin; }
+  float xMax() const override { return m_xMax; }
+  float yMin() const override { return m_yMin; }
+  float yMax() const override { return m_yMax; }
+
+ private:
+  float m_xMin, m_xMax, m_yMin, m_yMax;
+};
+
+class BumpPolicy : public PlotPolicy::WithCurves {
+ public:
+  void setBump(float center, float step) {
+    m_center = center;
+    m_step = step;
+  }
+
+ protected:
+  constexpr static float k_halfWidth = 0.8f;
+  constexpr static float k_height = 3.f;
+
+  static Coordinate2D<float> Bump(float t, void* model, void*) {
+    float center = *static_cast<float*>(model);
+    return Coordinate2D<float>(
+        t, std::fabs(t - center) < k_halfWidth ? k_height : 0.f);
+  }
+
+  void drawPlot(const AbstractPlotView* plotView, KDContext* ctx,
+                KDRect rect) const {
+    CurveDrawing plot(Curve2D(Bump, const_cast<float*>(&m_center)), nullptr,
+                      plotView->range()->xMin(), plotView->range()->xMax(),
+                      m_step, KDColorRed);
+    plot.draw(plotView, ctx, rect);
+  }
+
+ private:
+  float m_center;
+  float m_step;
+};
+
+class BumpView
+    : public PlotView<PlotPolicy::NoAxes, BumpPolicy, PlotPolicy::NoBanner,
+                      PlotPolicy::NoCursor> {
+ public:
+  using PlotView::PlotView;
+};
+
+QUIZ_CASE(shared_curve_drawing_narrow_bump) {
+  /* A flat curve with a bump 1.6 pixels wide is drawn with samples a pixel
+   * apart or closer. The bump must be drawn wherever it lies between the
+   * samples. */
+  constexpr KDCoordinate width = 101;
+  constexpr KDCoordinate height = 61;
+  static KDColor pixels[width * height];
+  FrameBufferContext ctx(pixels, KDSize(width, height));
+  // One unit per pixel, y = 0 on row 50 and the top of the bump on row 20
+  FixedRange range(0.f, width - 1, -1.f, 5.f);
+  BumpView view(&range);
+  KDRect bounds(0, 0, width, height);
+  // The view has no parent to set its frame
+  view.setChildFrame(&view, bounds, false);
+
+  for (float step : {1.f, 0.25f}) {
+    for (int k = 0; k < 16; k++) {
+      float center = 40.f + k / 8.f;
+      view.setBump(center, step);
+      view.drawRect(&ctx, bounds);
+      int column = std::round(center);
+      bool bumpIsDrawn = false;
+      for (int row = 0; row < 35; row++) {
+        bumpIsDrawn |= pixels[row * width + column] != KDColorWhite;
+      }
+      quiz_assert(bumpIsDrawn);
+    }
+  }
+}
+
+}  // namespace Shared
@@ -422,6 +422,8 @@ Layout ValuesController::memoizedLayoutForCell(int column, int row) {
      * sequences, the number of rows is the same for all column, and for
      * grapher, this would enable us to restore previous loops (avoid row >=
      * maxRow[col] etc). */
+    int newCells[numberOfMemoizedCell];
+    int numberOfNewCells = 0;
     for (int row = 0; row < maxOfMaxRow; row++) {
       for (int col = 0; col < maxCol; col++) {
         if (row >= maxRow[col]) {
@@ -433,18 +435,49 @@ Layout ValuesController::memoizedLayoutForCell(int column, int row) {
             row < -offsetRow + k_maxNumberOfDisplayableRows) {
           continue;
         }
-        createMemoizedLayout(
-            absoluteColumnForValuesColumn(m_firstMemoizedColumn + col),
-            absoluteRowForValuesRow(m_firstMemoizedRow + row),
-            row * nbOfMemoizedColumns + col);
+        newCells[numberOfNewCells++] = row * nbOfMemoizedColumns + col;
       }
     }
+#if ION_WORKER_THREADS
+    for (int i = 0; i < numberOfNewCells; i++) {
+      int index = newCells[i];
+      precomputeMemoizedValue(
+          absoluteColumnForValuesColumn(m_firstMemoizedColumn +
+                                        index % nbOfMemoizedColumns),
+          absoluteRowForValuesRow(m_firstMemoizedRow +
+                                  index / nbOfMemoizedColumns),
+          index, &m_precomputedValues);
+    }
+    m_precomputedValues.compute();
+#endif
+    for (int i = 0; i < numberOfNewCells; i++) {
+      int index = newCells[i];
+      createMemoizedLayout(
+          absoluteColumnForValuesColumn(m_firstMemoizedColumn +
+                                        index % nbOfMemoizedColumns),
+          absoluteRowForValuesRow(m_firstMemoizedRow +
+                                  index / nbOfMemoizedColumns),
+          index);
+    }
+#if ION_WORKER_THREADS
+    // Other calls to createMemoizedLayout must not find stale values
+    m_precomputedValues.reset();
+#endif
   }
   return *memoizedLayoutAtIndex((valuesRow - m_firstMemoizedRow) *
                                     nbOfMemoizedColumns +
                                 (valuesCol - m_firstMemoizedColumn));
 }
 
+bool ValuesController::precomputedValueAtMemoizedIndex(int index,
+                                                       double *value) const {
+#if ION_WORKER_THREADS
+  return m_precomputedValues.valueAtMemoizedIndex(index, value);
+#else
+  return false;
+#endif
+}
+
 void ValuesController::clearSelectedColumn() {
   intervalAtColumn(selectedColumn())->clear();
   selectCellAtLocation(selectedColumn(), 1);
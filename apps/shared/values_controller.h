@@ -14,6 +14,7 @@
 #include "function_store.h"
 #include "interval.h"
 #include "interval_parameter_controller.h"
+#include "precomputed_values.h"
 #include "prefaced_twice_table_view.h"
 #include "values_parameter_controller.h"
 
@@ -112,6 +113,12 @@ class ValuesController : public EditableCellTableViewController,
   virtual Poincare::Layout* memoizedLayoutAtIndex(int i) = 0;
   // Coordinates of memoizedLayoutForCell refer to the absolute table
   Poincare::Layout memoizedLayoutForCell(int i, int j);
+  typedef PrecomputedValues<k_maxNumberOfDisplayableColumns,
+                            k_maxNumberOfDisplayableRows>
+      PageValues;
+  /* Return false if the value of the cell was not approximated with the rest
+   * of the page. Only valid in createMemoizedLayout. */
+  bool precomputedValueAtMemoizedIndex(int index, double* value) const;
 
   Escher::SelectableViewController* columnParameterController() override;
   Shared::ColumnParameters* columnParameters() override;
@@ -160,6 +167,11 @@ class ValuesController : public EditableCellTableViewController,
   /* Coordinates of createMemoizedLayout refer to the absolute table but the
    * index refers to the memoized table */
   virtual void createMemoizedLayout(int i, int j, int index) = 0;
+  /* When the host has worker threads, the values of the cells created for a
+   * page are approximated together beforehand. precomputeMemoizedValue adds
+   * the cell to values if its value is such an approximation. */
+  virtual void precomputeMemoizedValue(int i, int j, int index,
+                                       PageValues* values) {}
   /* m_firstMemoizedColumn and m_firstMemoizedRow are coordinates of the table
    * of values cells.*/
   virtual int numberOfColumnsForAbscissaColumn(int column) {
@@ -168,6 +180,9 @@ class ValuesController : public EditableCellTableViewController,
   }
   mutable int m_firstMemoizedColumn;
   mutable int m_firstMemoizedRow;
+#if ION_WORKER_THREADS
+  PageValues m_precomputedValues;
+#endif
 
   virtual void updateSizeMemoizationForColumnAfterIndexChanged(
       int column, KDCoordinate columnPreviousWidth, int changedRow) {}
@@ -10,6 +10,10 @@ class SolverContext : public Poincare::ContextWithParent {
   SolverContext(Context* parentContext)
       : Poincare::ContextWithParent(parentContext) {}
   bool canRemoveUnderscoreToUnits() const override { return false; }
+  // The solver context defines nothing on top of its parent
+  bool identifyDefinitions(uint32_t* identifier) override {
+    return parentContext()->identifyDefinitions(identifier);
+  }
 };
 
 }  // namespace Solver
@@ -0,0 +1,140 @@
+#!/usr/bin/env python3
+
+import argparse
+import json
+import statistics
+import subprocess
+import sys
+
+# benchmark.py run output/release/simulator/linux/epsilon.bin -n 5 -o new.json
+# benchmark.py compare base.json new.json
+# benchmark.py run epsilon.bin -n 5 -o new.json --baseline base.json
+
+METRICS = ['time_us', 'redraw_us', 'pixels', 'peak_nodes']
+# Timings vary between runs, so only their regressions above the threshold are
+# reported. Pixels and nodes are deterministic.
+TIMING_METRICS = {'time_us', 'redraw_us'}
+
+def list_scenarios(binary):
+  output = subprocess.run([binary, '--list-benchmarks'], check=True,
+                          capture_output=True, text=True).stdout
+  return [line for line in output.splitlines() if line]
+
+def run_scenario(binary, scenario):
+  command = [binary, '--headless', '--language', 'en', '--benchmark', scenario]
+  output = subprocess.run(command, check=True, capture_output=True,
+                          text=True).stdout
+  events = []
+  for line in output.splitlines():
+    if line.startswith('#') or not line:
+      continue
+    fields = line.split('\t')
+    if len(fields) != 6:
+      continue
+    event = {'id': int(fields[1])}
+    for name, value in zip(METRICS, fields[2:]):
+      event[name] = int(value) if value else None
+    events.append(event)
+  return events
+
+def aggregate(runs):
+  # Median of each metric over the runs, event by event
+  events = []
+  for samples in zip(*runs):
+    event = {'id': samples[0]['id']}
+    for metric in METRICS:
+      values = [s[metric] for s in samples if s[metric] is not None]
+      event[metric] = statistics.median(values) if values else None
+    events.append(event)
+  result = {'events': events}
+  for metric in METRICS:
+    values = [e[metric] for e in events if e[metric] is not None]
+    if not values:
+      result[metric] = None
+    elif metric == 'peak_nodes':
+      result[metric] = max(values)
+    else:
+      result[metric] = sum(values)
+  return result
+
+def run(args):
+  results = {'iterations': args.iterations, 'scenarios': {}}
+  for scenario in list_scenarios(args.binary):
+    runs = [run_scenario(args.binary, scenario)
+            for _ in range(args.iterations)]
+    results['scenarios'][scenario] = aggregate(runs)
+    print_results(scenario, results['scenarios'][scenario])
+  if args.output:
+    with open(args.output, 'w') as f:
+      json.dump(results, f, indent=2)
+  if args.baseline:
+    return compare_files(args.baseline, results, args.threshold)
+  return 0
+
+def format_value(value):
+  return '-' if value is None else '{:_}'.format(round(value))
+
+def print_results(scenario, result):
+  print('{:<16}'.format(scenario) + ''.join(
+      '{:>14}'.format(format_value(result[metric])) for metric in METRICS))
+
+def is_regression(metric, base, head, threshold):
+  if base is None or head is None:
+    return False
+  if metric in TIMING_METRICS:
+    return head > base * (1 + threshold / 100)
+  return head > base
+
+def compare_files(baseline, results, threshold):
+  with open(baseline) as f:
+    base = json.load(f)
+  regressions = 0
+  print('{:<16}'.format('') + ''.join('{:>22}'.format(m) for m in METRICS))
+  for scenario, head in results['scenarios'].items():
+    if scenario not in base['scenarios']:
+      print('{:<16} not in baseline'.format(scenario))
+      continue
+    row = '{:<16}'.format(scenario)
+    for metric in METRICS:
+      b = base['scenarios'][scenario][metric]
+      h = head[metric]
+      change = ''
+      if b and h is not None:
+        change = '{:+.1f}%'.format(100 * (h - b) / b)
+      regressed = is_regression(metric, b, h, threshold)
+      regressions += regressed
+      row += '{:>14}{:>8}'.format(format_value(h),
+                                  change + ('!' if regressed else ''))
+    print(row)
+  if regressions:
+    print('{} regression(s) compared to {}'.format(regressions, baseline))
+    return 1
+  return 0
+
+def compare(args):
+  with open(args.results) as f:
+    results = json.load(f)
+  return compare_files(args.baseline, results, args.threshold)
+
+parser = argparse.ArgumentParser(
+    description='Replay the events scenarios on the simulator and measure '
+                'the time, redraws, pixels and pool usage of each event')
+subparsers = parser.add_subparsers(dest='command', required=True)
+run_parser = subparsers.add_parser('run', help='Run the benchmark')
+run_parser.add_argument('binary', help='Headless-capable simulator binary')
+run_parser.add_argument('-n', '--iterations', type=int, default=5,
+                        help='Number of replays of each scenario')
+run_parser.add_argument('-o', '--output', help='JSON file for the results')
+run_parser.add_argument('--baseline', help='JSON results to compare with')
+run_parser.set_defaults(function=run)
+compare_parser = subparsers.add_parser('compare',
+                                       help='Compare two JSON results')
+compare_parser.add_argument('baseline')
+compare_parser.add_argument('results')
+compare_parser.set_defaults(function=compare)
+for p in (run_parser, compare_parser):
+  p.add_argument('-t', '--threshold', type=float, default=10,
+                 help='Tolerated slowdown of the timings, in percent')
+
+args = parser.parse_args()
+sys.exit(args.function(args))
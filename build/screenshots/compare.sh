@@ -58,6 +58,13 @@ if [[ $# -eq 2 ]]; then
 
   echo "Generating screenshots"
 
+  if [[ ${arg1_mode} != "d" ]]
+  then
+    imgs_for_executable "${exe1}" "${output_folder}"
+    print_report
+    exit
+  fi
+
   for state_file in "${scenari_folder}"/*.nws
   do
     filestem=$(stem "${state_file}")
@@ -83,6 +90,41 @@ log args ${arg1_mode} ${arg1} ${arg2_mode} ${arg2}
 
 echo -e "Comparing screenshots"
 
+if [[ ${arg1_mode} == "d" ]] && [[ ${arg2_mode} != "d" ]]
+then
+  # Compare in memory, only the mismatching screenshots are saved
+  replay_folder="${output_folder}/replay"
+  mkdir -p "${replay_folder}"
+  while IFS=$'\t' read -r state_file result
+  do
+    if [[ -z ${result} ]]
+    then
+      # Not a result, debug builds also log the events they replay
+      continue
+    fi
+    if [[ ${result} == "OK" ]]
+    then
+      echo -e "\033[1m${state_file}\t \033[32mOK\033[0m"
+      continue
+    fi
+    filestem=$(stem "${state_file}")
+    out_file1="${output_folder}/${filestem}-1.png"
+    out_file2="${output_folder}/${filestem}-2.png"
+    create_img 1 "${out_file1}"
+    mv "${replay_folder}/${filestem}.png" "${out_file2}" || true
+    out_diff="${out_file1%-1.png}-diff.png"
+    compare_images "${out_file1}" "${out_file2}" "${out_diff}"
+  done < <(imgs_for_executable "${exe2}" "${replay_folder}" "${arg1}")
+  rmdir "${replay_folder}"
+
+  print_report
+  if [[ "$count" == 0 ]] && [[ "$debug" == 0 ]]
+  then
+    rm -r "$output_folder"
+  fi
+  exit $count
+fi
+
 for state_file in "${scenari_folder}"/*.nws
 do
   filestem=$(stem "${state_file}")
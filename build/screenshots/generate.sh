@@ -51,6 +51,13 @@ log args ${arg1_mode} ${arg1}
 
 echo "Generating screenshots"
 
+if [[ ${arg1_mode} != "d" ]]
+then
+  imgs_for_executable "${exe1}" "${output_folder}"
+  print_report
+  exit
+fi
+
 for state_file in "${scenari_folder}"/*.nws
 do
   filestem=$(stem "${state_file}")
@@ -47,6 +47,21 @@ function img_for_executable() {
   fi
 }
 
+# imgs_for_executable <executable> <output_folder> [<reference_folder>]
+# Replay all the state files of the scenari folder in a single process. With a
+# reference folder, only the screenshots that differ from it are saved, and the
+# executable prints the result of each state file.
+function imgs_for_executable() {
+  log "imgs_for_exe $1 $2 $3"
+  args="--headless --replay-state-files - --screenshots-folder $2"
+  if [[ -n "$3" ]]
+  then
+    args="${args} --reference-screenshots $3"
+  fi
+  log "./$1 ${args}"
+  ls "${scenari_folder}"/*.nws | ./$1 ${args} || true
+}
+
 function executable_built_path() {
   BUILD_TYPE=debug
   host=$(uname -s)
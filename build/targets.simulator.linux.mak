@@ -11,3 +11,9 @@ reload: default
 # If MICROPY_NLR_SETJMP is 0, the MicroPython NLR done by
 # python/src/py/nlrx64.c crashes on linux.
 SFLAGS += -DMICROPY_NLR_SETJMP=1
+
+# Replay the events scenarios headlessly, see build/metrics/benchmark.py
+BENCHMARK_ITERATIONS ?= 5
+.PHONY: benchmark
+benchmark: $(BUILD_DIR)/epsilon.$(EXE)
+	$(Q) $(PYTHON) build/metrics/benchmark.py run $< -n $(BENCHMARK_ITERATIONS) -o $(BUILD_DIR)/benchmark.json $(if $(BENCHMARK_BASELINE),--baseline $(BENCHMARK_BASELINE))
@@ -103,6 +103,14 @@ class ScrollView : public View {
   void setContentOffset(KDPoint offset);
   KDPoint contentOffset() const { return m_dataSource->offset(); }
 
+  /* When scrolling by copy, the pixels of the content still visible after a
+   * scroll are moved on screen and only the uncovered strip is redrawn. Since
+   * the moved pixels are read back from the screen, only enable it for scroll
+   * views that no other view is drawn over, and whose content changes mark it
+   * dirty before scrolling. Scrolling falls back to a full redraw when the
+   * indicators overlap the content. */
+  void setScrollByCopy(bool scrollByCopy) { m_scrollByCopy = scrollByCopy; }
+
   void scrollToContentPoint(KDPoint point);
   // Minimal scrolling to make this rect visible
   void scrollToContentRect(KDRect rect);
@@ -136,19 +144,34 @@ class ScrollView : public View {
  private:
   class InnerView : public View {
    public:
-    InnerView(ScrollView *scrollView) : View(), m_scrollView(scrollView) {}
+    InnerView(ScrollView *scrollView)
+        : View(),
+          m_scrollView(scrollView),
+          m_pendingShift(KDPointZero),
+          m_shiftFrame(KDRectZero) {}
     void drawRect(KDContext *ctx, KDRect rect) const override;
+    using View::dirtyRectOfHierarchy;
+    /* Replace the dirtiness of the hierarchy with a shift of the pixels on
+     * screen. dirtyRect is the dirty rect of the hierarchy before the content
+     * moved by shift. */
+    void shiftDrawnPixels(KDPoint shift, KDRect dirtyRect);
 
    private:
+    KDRect movePixelsBeforeRedraw(KDRect visibleRect,
+                                  KDRect forceRedrawRect) override;
     int numberOfSubviews() const override { return 1; }
     View *subviewAtIndex(int index) override {
       assert(index == 0);
       return m_scrollView->m_contentView;
     }
     const ScrollView *m_scrollView;
+    // Shift of the pixels on screen not applied yet
+    KDPoint m_pendingShift;
+    KDRect m_shiftFrame;
   };
 
   KDRect layoutDecorator(bool force);
+  bool indicatorsOverlapContent();
 
   ScrollViewDataSource *m_dataSource;
   View *m_contentView;
@@ -162,6 +185,7 @@ class ScrollView : public View {
   mutable KDCoordinate m_excessHeight;
 
   KDColor m_backgroundColor;
+  bool m_scrollByCopy;
 };
 
 }  // namespace Escher
@@ -15,6 +15,7 @@ class TextCursorView : public View {
  public:
   constexpr static KDCoordinate k_width = 1;
   static void InitSharedCursor() { sharedTextCursor.init(); }
+  static void DeinitSharedCursor() { sharedTextCursor.deinit(); }
 
   TextCursorView() : m_visible(false) {}
 
@@ -72,7 +72,8 @@ class View {
    * bound to a view, it's really absolute pixels that count.
    *
    * That being said, what are the case of dirtyness that we know of?
-   *  - Scrolling -> well, everything has to be redrawn anyway
+   *  - Scrolling -> the pixels still visible can be moved instead of being
+   *    redrawn, cf ScrollView::setScrollByCopy
    *  - Moving a cursor -> In that case, there's really a much more efficient
    * way
    *  - ... and that's all I can think of.
@@ -81,6 +82,9 @@ class View {
   void markAbsoluteRectAsDirty(KDRect rect);
   // Doing this is equivalent to markAbsoluteRectAsDirty(m_frame) but faster
   void markWholeFrameAsDirty() { m_dirtyRect = m_frame; }
+  // Union of the dirty rects of the view and of all its subviews
+  KDRect dirtyRectOfHierarchy();
+  void markHierarchyAsClean();
 
 #if ESCHER_VIEW_LOGGING
   virtual const char *className() const;
@@ -94,6 +98,14 @@ class View {
   virtual void layoutSubviews(bool force = false) {}
   void translate(KDPoint origin);
   KDRect redraw(KDRect rect, KDRect forceRedrawRect = KDRectZero);
+  /* Called by redraw before drawing the view, it lets a view move pixels that
+   * are already on screen instead of redrawing them. It returns the absolute
+   * rect of the moved pixels, so that views drawn later over it are redrawn
+   * too. */
+  virtual KDRect movePixelsBeforeRedraw(KDRect visibleRect,
+                                        KDRect forceRedrawRect) {
+    return KDRectZero;
+  }
 
   /* At destruction, subviews aren't notified that their own pointer
    * 'm_superview' is outdated. This is not an issue since all view hierarchy
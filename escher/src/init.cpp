@@ -1,12 +1,23 @@
+#include <escher/clipboard.h>
 #include <escher/init.h>
 #include <escher/text_cursor_view.h>
+#include <kandinsky/glyph_cache.h>
 #include <kandinsky/ion_context.h>
 
 namespace Escher {
 
 void Init() {
   KDIonContext::SharedContext.init();
+  KDGlyphCache::SharedCache.init();
+  KDIonContext::SharedContext->setGlyphCache(KDGlyphCache::SharedCache);
   TextCursorView::InitSharedCursor();
 }
 
+void Deinit() {
+  Clipboard::SharedClipboard()->reset();
+  TextCursorView::DeinitSharedCursor();
+  KDGlyphCache::SharedCache.deinit();
+  KDIonContext::SharedContext.deinit();
+}
+
 }  // namespace Escher
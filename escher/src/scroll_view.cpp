@@ -1,5 +1,6 @@
 #include <escher/palette.h>
 #include <escher/scroll_view.h>
+#include <ion/display.h>
 
 #include <new>
 extern "C" {
@@ -20,7 +21,8 @@ ScrollView::ScrollView(View *contentView, ScrollViewDataSource *dataSource)
       m_leftMargin(0),
       m_excessWidth(0),
       m_excessHeight(0),
-      m_backgroundColor(Palette::WallScreen) {
+      m_backgroundColor(Palette::WallScreen),
+      m_scrollByCopy(false) {
   assert(m_dataSource != nullptr);
 }
 
@@ -183,9 +185,36 @@ void ScrollView::layoutSubviews(bool force) {
 }
 
 void ScrollView::setContentOffset(KDPoint offset) {
-  if (m_dataSource->setOffset(offset)) {
-    layoutSubviews();
+  KDRect previousInnerFrame = m_innerView.absoluteFrame();
+  KDRect previousContentFrame = m_contentView->absoluteFrame();
+  KDRect dirtyRect =
+      m_scrollByCopy ? m_innerView.dirtyRectOfHierarchy() : KDRectZero;
+  if (!m_dataSource->setOffset(offset)) {
+    return;
+  }
+  layoutSubviews();
+  /* The pixels can only be moved if the content was translated within an
+   * unchanged inner view. */
+  if (m_scrollByCopy && !previousInnerFrame.isEmpty() &&
+      m_innerView.absoluteFrame() == previousInnerFrame &&
+      m_contentView->absoluteFrame().size() == previousContentFrame.size() &&
+      !indicatorsOverlapContent()) {
+    m_innerView.shiftDrawnPixels(
+        m_contentView->absoluteOrigin().relativeTo(
+            previousContentFrame.origin()),
+        dirtyRect);
+  }
+}
+
+bool ScrollView::indicatorsOverlapContent() {
+  int numberOfIndicators = decorator()->numberOfIndicators();
+  for (int i = 1; i <= numberOfIndicators; i++) {
+    if (decorator()->indicatorAtIndex(i)->absoluteFrame().intersects(
+            m_innerView.absoluteFrame())) {
+      return true;
+    }
   }
+  return false;
 }
 
 KDRect ScrollView::layoutDecorator(bool force) {
@@ -222,6 +251,67 @@ void ScrollView::InnerView::drawRect(KDContext *ctx, KDRect rect) const {
   ctx->fillRect(KDRect(contentRight, 0, width - contentRight, height), color);
 }
 
+void ScrollView::InnerView::shiftDrawnPixels(KDPoint shift,
+                                             KDRect dirtyRect) {
+  if (m_pendingShift != KDPointZero && m_shiftFrame != absoluteFrame()) {
+    // The view moved since the previous shift, the pixels cannot be reused
+    m_pendingShift = KDPointZero;
+    markWholeFrameAsDirty();
+    return;
+  }
+  /* The layout of the content after the scroll dirtied the views that were
+   * moved or refilled, but their pixels only need to be shifted. What was
+   * dirty before the scroll is still dirty, at its previous and new places. */
+  markHierarchyAsClean();
+  m_pendingShift = m_pendingShift.translatedBy(shift);
+  m_shiftFrame = absoluteFrame();
+  markAbsoluteRectAsDirty(dirtyRect.unionedWith(dirtyRect.translatedBy(shift)));
+}
+
+KDRect ScrollView::InnerView::movePixelsBeforeRedraw(KDRect visibleRect,
+                                                     KDRect forceRedrawRect) {
+  KDPoint shift = m_pendingShift;
+  if (shift == KDPointZero) {
+    return KDRectZero;
+  }
+  m_pendingShift = KDPointZero;
+  if (absoluteFrame() != m_shiftFrame) {
+    markWholeFrameAsDirty();
+    return KDRectZero;
+  }
+  KDRect destination =
+      visibleRect.intersectedWith(visibleRect.translatedBy(shift));
+  /* The uncovered strip has no pixels to be moved from, and the pixels forced
+   * to be redrawn are not valid where they are moved to. */
+  markAbsoluteRectAsDirty(visibleRect.differencedWith(destination));
+  markAbsoluteRectAsDirty(
+      forceRedrawRect.intersectedWith(visibleRect).translatedBy(shift));
+  // Pixels about to be redrawn do not need to be moved
+  destination = destination.differencedWith(dirtyRect());
+  if (destination.isEmpty()) {
+    return KDRectZero;
+  }
+  /* Copy groups of rows, starting from the side the pixels move to, so that
+   * no pixel is overwritten before being copied. */
+  constexpr static int k_bufferSize = 4 * Ion::Display::Width;
+  KDColor buffer[k_bufferSize];
+  KDCoordinate width = destination.width();
+  KDCoordinate height = destination.height();
+  KDCoordinate rowsPerCopy = k_bufferSize / width;
+  for (KDCoordinate copiedRows = 0; copiedRows < height;) {
+    KDCoordinate rows =
+        std::min<KDCoordinate>(rowsPerCopy, height - copiedRows);
+    KDCoordinate y = shift.y() > 0
+                         ? destination.bottom() + 1 - copiedRows - rows
+                         : destination.top() + copiedRows;
+    KDRect rowsRect(destination.left(), y, width, rows);
+    Ion::Display::pullRect(rowsRect.translatedBy(shift.opposite()), buffer);
+    Ion::Display::pushRect(rowsRect, buffer);
+    copiedRows += rows;
+  }
+  return destination;
+}
+
 View *ScrollView::BarDecorator::indicatorAtIndex(int index) {
   if (index == 1) {
     return &m_verticalBar;
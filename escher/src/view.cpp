@@ -38,6 +38,7 @@ KDRect View::redraw(KDRect rect, KDRect forceRedrawRect) {
     return KDRectZero;
   }
   KDRect visibleRect = rect.intersectedWith(m_frame);
+  KDRect movedArea = movePixelsBeforeRedraw(visibleRect, forceRedrawRect);
   KDRect rectNeedingRedraw =
       visibleRect.intersectedWith(m_dirtyRect)
           .unionedWith(forceRedrawRect.intersectedWith(m_frame));
@@ -71,8 +72,35 @@ KDRect View::redraw(KDRect rect, KDRect forceRedrawRect) {
   // Eventually, mark that we don't need to be redrawn
   m_dirtyRect = KDRectZero;
 
-  // The function returns the total area that have been redrawn.
-  return redrawnArea;
+  /* The function returns the total area that have been redrawn. Moved pixels
+   * are accounted for after the subviews, which do not need to be redrawn
+   * over them. */
+  return redrawnArea.unionedWith(movedArea);
+}
+
+KDRect View::dirtyRectOfHierarchy() {
+  KDRect dirtyRect = m_dirtyRect;
+  uint8_t subviewsNumber = numberOfSubviews();
+  for (uint8_t i = 0; i < subviewsNumber; i++) {
+    View *subview = subviewAtIndex(i);
+    if (subview == nullptr) {
+      continue;
+    }
+    dirtyRect = dirtyRect.unionedWith(subview->dirtyRectOfHierarchy());
+  }
+  return dirtyRect;
+}
+
+void View::markHierarchyAsClean() {
+  m_dirtyRect = KDRectZero;
+  uint8_t subviewsNumber = numberOfSubviews();
+  for (uint8_t i = 0; i < subviewsNumber; i++) {
+    View *subview = subviewAtIndex(i);
+    if (subview == nullptr) {
+      continue;
+    }
+    subview->markHierarchyAsClean();
+  }
 }
 
 void View::setSize(KDSize size) {
@@ -21,6 +21,7 @@
 #include <ion/unicode/utf8_decoder.h>
 #include <ion/unicode/utf8_helper.h>
 #include <ion/usb.h>
+#include <ion/workers.h>
 #include <setjmp.h>
 #include <stdint.h>
 #include <string.h>
@@ -22,6 +22,18 @@ class RingBuffer {
     }
   }
 
+  /* Push an element left as is in the buffer and return it, so that large
+   * elements do not have to be built on the stack. */
+  T* pushElement() {
+    T* element = &m_stack[nextElementIndex()];
+    if (length() < N) {
+      m_length++;
+    } else {
+      m_start = (m_start + 1) % N;
+    }
+    return element;
+  }
+
   T stackPop() {
     assert(length() > 0);
     m_length--;
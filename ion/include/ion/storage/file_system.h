@@ -41,6 +41,8 @@ class FileSystem {
   size_t availableSize();
   size_t putAvailableSpaceAtEndOfRecord(Record r);
   void getAvailableSpaceFromEndOfRecord(Record r, size_t recordAvailableSpace);
+  /* If the buffer has been written outside of the FileSystem (by DFU for
+   * instance) since the previous call, the records index is rebuilt. */
   uint32_t checksum();
 
   // Storage delegate
@@ -141,6 +143,46 @@ class FileSystem {
                                  RecordFilter filter,
                                  const void *auxiliary = nullptr);
 
+  /* Filter cursor
+   * Lists iterate on recordWithExtensionAtIndex(i) for increasing i, so the
+   * last record found and the number of records matching the last filter are
+   * remembered to resume the walk instead of restarting from the first record.
+   * The auxiliary of the filters is at most one char. */
+  constexpr static size_t k_cursorExtensionSize = 8;
+  struct FilterCursor {
+    char extension[k_cursorExtensionSize];
+    RecordFilter filter;
+    char auxiliary;
+    int index;
+    char *record;
+    int numberOfRecords;
+  };
+  bool moveCursorToFilter(const char *extension, RecordFilter filter,
+                          const void *auxiliary) const;
+  void invalidateCursor() const;
+
+  /* Records index
+   * Walking the buffer computes the CRC32 of the name of each record. The
+   * index keeps the Record and the offset of the records in storage order so
+   * that lookups only compare CRC32s. It is updated by the methods modifying
+   * the buffer and lazily rebuilt after checksum detects an external change.
+   * Beyond k_maxNumberOfIndexedRecords records, lookups walk the buffer. */
+  constexpr static int k_maxNumberOfIndexedRecords = 128;
+  constexpr static int k_unbuiltIndex = -1;
+  constexpr static int k_overflowedIndex = -2;
+  bool indexIsAvailable() const;
+  void buildIndex() const;
+  int indexOfRecord(const Record record) const;
+  int indexOfRecordStarting(const char *start) const;
+  char *recordAtIndex(int i) const {
+    return const_cast<char *>(m_buffer) + m_indexedRecordsOffsets[i];
+  }
+  void invalidateIndex();
+  void indexAppendedRecord(char *start);
+  void indexResizedRecord(char *start, int delta);
+  void indexDestroyedRecord(char *start, int size);
+  void willChangeIndex();
+
   FileSystem();
 
   /* Getters/Setters on recordID */
@@ -164,6 +206,7 @@ class FileSystem {
 
   bool isNameOfRecordTaken(Record r, const Record *recordToExclude = nullptr);
   char *endBuffer();
+  char *endBufferWithoutIndex();
   size_t sizeOfRecordWithName(Record::Name name, size_t dataSize);
   bool slideBuffer(char *position, int delta);
   class RecordIterator {
@@ -201,6 +244,12 @@ class FileSystem {
   RecordNameVerifier m_recordNameVerifier;
   mutable Record m_lastRecordRetrieved;
   mutable char *m_lastRecordRetrievedPointer;
+  mutable FilterCursor m_filterCursor;
+  mutable Record m_indexedRecords[k_maxNumberOfIndexedRecords];
+  mutable record_size_t m_indexedRecordsOffsets[k_maxNumberOfIndexedRecords];
+  mutable int m_numberOfIndexedRecords;
+  uint32_t m_indexChecksum;
+  bool m_indexChecksumIsUpToDate;
 };
 
 }  // namespace Storage
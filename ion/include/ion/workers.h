@@ -0,0 +1,28 @@
+#ifndef ION_WORKERS_H
+#define ION_WORKERS_H
+
+namespace Ion {
+namespace Workers {
+
+/* Workers spread independent computations across the cores of the host on
+ * simulators built with ION_WORKER_THREADS. Everywhere else, including on the
+ * device, the tasks run one after the other on the calling thread.
+ *
+ * The calling thread is blocked until all the tasks are done, so tasks can
+ * read its state, but they must only write to their own part of the results.
+ * Anything global that a task mutates must be thread local (see
+ * OMG_THREAD_LOCAL). */
+
+typedef void (*Task)(int start, int end, void* context);
+
+// Maximal number of tasks run at the same time by Run
+int NumberOfWorkers();
+
+/* Split [0, numberOfItems) into at most NumberOfWorkers() contiguous ranges
+ * and call task(start, end, context) on each of them. */
+void Run(Task task, int numberOfItems, void* context);
+
+}  // namespace Workers
+}  // namespace Ion
+
+#endif
@@ -9,7 +9,5 @@ int displayUniformTilingSize10(KDColor c) { return 0; }
 
 int displayColoredTilingSize10() { return 0; }
 
-bool waitForVBlank() { return true; }
-
 }  // namespace Display
 }  // namespace Ion
@@ -0,0 +1,15 @@
+#include <ion/workers.h>
+
+namespace Ion {
+namespace Workers {
+
+int NumberOfWorkers() { return 1; }
+
+void Run(Task task, int numberOfItems, void* context) {
+  if (numberOfItems > 0) {
+    task(0, numberOfItems, context);
+  }
+}
+
+}  // namespace Workers
+}  // namespace Ion
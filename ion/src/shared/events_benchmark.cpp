@@ -3,73 +3,12 @@
 #include <ion/events.h>
 #include <ion/timing.h>
 
-#include <array>
-
 #include "../../../poincare/include/poincare/print_int.h"
+#include "events_scenarios.h"
 
 namespace Ion {
 namespace Events {
 
-class Scenario {
- public:
-  template <int N>
-  constexpr static Scenario build(const char* name, const Event (&events)[N]) {
-    return Scenario(name, events, N);
-  }
-  const char* name() const { return m_name; }
-  const int numberOfEvents() const { return m_numberOfEvents; }
-  const Event eventAtIndex(int index) const { return m_events[index]; }
-
- private:
-  constexpr Scenario(const char* name, const Event* events, int numberOfEvents)
-      : m_name(name), m_events(events), m_numberOfEvents(numberOfEvents) {}
-  const char* m_name;
-  const Event* m_events;
-  int m_numberOfEvents;
-};
-
-constexpr static Event scenarioCalculation[] = {
-    OK, Pi, Plus, One, Division, Two, OK,   OK,   Sqrt, Zero, Dot,  Two,
-    OK, OK, Up,   Up,  Up,       Up,  Down, Down, Down, Down, Home, Home};
-
-constexpr static Event scenarioFunctionCosSin[] = {
-    Right, OK,   OK,   Cosine, XNT,  OK,   Down, OK,   Sine, XNT,  OK,
-    Down,  Down, OK,   Left,   Left, Left, Left, Left, Left, Left, Left,
-    Left,  Left, Left, Left,   Left, Left, Left, Left, Left, Left, Left,
-    Left,  Left, Left, Left,   Left, Left, Left, Left, Left, Left, Left,
-    Left,  Left, Left, Left,   Left, Left, Left, Left, Left, Left, Left,
-    Left,  Left, Left, Left,   Left, Left, Left, Left, Left, Home, Home};
-
-constexpr static Event scenarioPythonMandelbrot[] = {
-    Right, Right, OK, Down, Down, Down, Down, OK,
-    Var,   Down,  OK, One,  Five, OK,   Home, Home};
-
-constexpr static Event scenarioStatistics[] = {
-    Down, OK,   One,  OK,    Two,   OK,    Right, Five,  OK,   One,
-    Zero, OK,   Back, Right, OK,    Right, Right, Right, OK,   One,
-    OK,   Down, OK,   Back,  Right, OK,    Back,  Right, OK,   Down,
-    Down, Down, Down, Down,  Down,  Down,  Down,  Down,  Down, Up,
-    Up,   Up,   Up,   Up,    Up,    Up,    Up,    Up,    Home, Home};
-
-constexpr static Event scenarioProbability[] = {
-    Down,  Right, OK,    Down, Down, Down,  OK,   Two,  OK,
-    Zero,  Dot,   Three, OK,   OK,   Left,  Down, Down, OK,
-    Right, Right, Right, Zero, Dot,  Eight, OK,   Home, Home};
-
-constexpr static Event scenarioEquation[] = {
-    Down, Right, Right, OK,   OK,   Down, Down, OK,   Six,  OK,
-    Down, Down,  OK,    Left, Left, Left, Down, Down, Home, Home};
-
-constexpr static Scenario scenarios[] = {
-    Scenario::build("Calc scrolling", scenarioCalculation),
-    Scenario::build("Sin/Cos graph", scenarioFunctionCosSin),
-    Scenario::build("Mandelbrot(15)", scenarioPythonMandelbrot),
-    Scenario::build("Statistics", scenarioStatistics),
-    Scenario::build("Probability", scenarioProbability),
-    Scenario::build("Equation", scenarioEquation)};
-
-constexpr static int numberOfScenari = std::size(scenarios);
-
 Event getEvent(int* timeout) {
   static int scenarioIndex = 0;
   static int eventIndex = 0;
@@ -0,0 +1,91 @@
+#ifndef ION_SHARED_EVENTS_SCENARIOS_H
+#define ION_SHARED_EVENTS_SCENARIOS_H
+
+#include <ion/events.h>
+
+#include <array>
+
+namespace Ion {
+namespace Events {
+
+/* Scenarios replayed to benchmark the firmware: by events_benchmark.cpp on
+ * the device, and by the --benchmark option of the simulator. */
+
+class Scenario {
+ public:
+  template <int N>
+  constexpr static Scenario build(const char* name, const Event (&events)[N]) {
+    return Scenario(name, events, N);
+  }
+  const char* name() const { return m_name; }
+  const int numberOfEvents() const { return m_numberOfEvents; }
+  const Event eventAtIndex(int index) const { return m_events[index]; }
+
+ private:
+  constexpr Scenario(const char* name, const Event* events, int numberOfEvents)
+      : m_name(name), m_events(events), m_numberOfEvents(numberOfEvents) {}
+  const char* m_name;
+  const Event* m_events;
+  int m_numberOfEvents;
+};
+
+constexpr static Event scenarioCalculation[] = {
+    OK, Pi, Plus, One, Division, Two, OK,   OK,   Sqrt, Zero, Dot,  Two,
+    OK, OK, Up,   Up,  Up,       Up,  Down, Down, Down, Down, Home, Home};
+
+constexpr static Event scenarioCalculationHistory[] = {
+    OK, One,  Plus, Two, OK, OK, OK, OK, OK, OK, OK, OK, OK, OK,
+    OK, OK,   Up,   Up,  Up, Up, Up, Up, Up, Up, Up, Up, Up, Up,
+    Up, Down, Down, Down, Down, Down, Down, Down, Down, Down, Home, Home};
+
+constexpr static Event scenarioFunctionCosSin[] = {
+    Right, OK,   OK,   Cosine, XNT,  OK,   Down, OK,   Sine, XNT,  OK,
+    Down,  Down, OK,   Left,   Left, Left, Left, Left, Left, Left, Left,
+    Left,  Left, Left, Left,   Left, Left, Left, Left, Left, Left, Left,
+    Left,  Left, Left, Left,   Left, Left, Left, Left, Left, Left, Left,
+    Left,  Left, Left, Left,   Left, Left, Left, Left, Left, Left, Left,
+    Left,  Left, Left, Left,   Left, Left, Left, Left, Left, Home, Home};
+
+constexpr static Event scenarioPythonMandelbrot[] = {
+    Right, Right, OK, Down, Down, Down, Down, OK,
+    Var,   Down,  OK, One,  Five, OK,   Home, Home};
+
+constexpr static Event scenarioStatistics[] = {
+    Down, OK,   One,  OK,    Two,   OK,    Right, Five,  OK,   One,
+    Zero, OK,   Back, Right, OK,    Right, Right, Right, OK,   One,
+    OK,   Down, OK,   Back,  Right, OK,    Back,  Right, OK,   Down,
+    Down, Down, Down, Down,  Down,  Down,  Down,  Down,  Down, Up,
+    Up,   Up,   Up,   Up,    Up,    Up,    Up,    Up,    Home, Home};
+
+constexpr static Event scenarioProbability[] = {
+    Down,  Right, OK,    Down, Down, Down,  OK,   Two,  OK,
+    Zero,  Dot,   Three, OK,   OK,   Left,  Down, Down, OK,
+    Right, Right, Right, Zero, Dot,  Eight, OK,   Home, Home};
+
+constexpr static Event scenarioEquation[] = {
+    Down, Right, Right, OK,   OK,   Down, Down, OK,   Six,  OK,
+    Down, Down,  OK,    Left, Left, Left, Down, Down, Home, Home};
+
+constexpr static Event scenarioSequenceValues[] = {
+    Down,   Right, Right,    OK,   OK,    OK,   XNT,  Square, Plus,  Sine,
+    XNT,    Right, Division, XNT,  Right, OK,   Down, OK,     OK,    XNT,
+    Cosine, XNT,   Right,    OK,   Up,    Up,   Up,   Right,  Right, OK,
+    Down,   Down,  Down,     Down, Down,  Down, Down, Down,   Down,  Down,
+    Down,   Down,  Down,     Down, Down,  Down, Down, Down,   Home,  Home};
+
+constexpr static Scenario scenarios[] = {
+    Scenario::build("Calc scrolling", scenarioCalculation),
+    Scenario::build("Calc history", scenarioCalculationHistory),
+    Scenario::build("Sin/Cos graph", scenarioFunctionCosSin),
+    Scenario::build("Mandelbrot(15)", scenarioPythonMandelbrot),
+    Scenario::build("Statistics", scenarioStatistics),
+    Scenario::build("Probability", scenarioProbability),
+    Scenario::build("Equation", scenarioEquation),
+    Scenario::build("Sequence values", scenarioSequenceValues)};
+
+constexpr static int numberOfScenari = std::size(scenarios);
+
+}  // namespace Events
+}  // namespace Ion
+
+#endif
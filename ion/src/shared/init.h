@@ -4,6 +4,9 @@
 namespace Ion {
 
 void Init();
+/* Destroy what Init built. Only the simulator calls it, to run ion_main
+ * several times in a row. */
+void Deinit();
 
 }
 
@@ -41,6 +41,7 @@ size_t FileSystem::putAvailableSpaceAtEndOfRecord(Record r) {
           (m_buffer + k_storageSize - availableStorageSize) - nextRecord);
   size_t newRecordSize = previousRecordSize + availableStorageSize;
   overrideSizeAtPosition(p, (record_size_t)newRecordSize);
+  indexResizedRecord(p, availableStorageSize);
   return newRecordSize;
 }
 
@@ -53,10 +54,19 @@ void FileSystem::getAvailableSpaceFromEndOfRecord(Record r,
           m_buffer + k_storageSize - nextRecord);
   overrideSizeAtPosition(
       p, (record_size_t)(previousRecordSize - recordAvailableSpace));
+  indexResizedRecord(p, -recordAvailableSpace);
 }
 
 uint32_t FileSystem::checksum() {
-  return Ion::crc32Byte((const uint8_t *)m_buffer, endBuffer() - m_buffer);
+  // The index cannot be trusted to find the end of the buffer yet
+  uint32_t checksum = Ion::crc32Byte((const uint8_t *)m_buffer,
+                                     endBufferWithoutIndex() - m_buffer);
+  if (m_indexChecksumIsUpToDate && checksum != m_indexChecksum) {
+    invalidateIndex();
+  }
+  m_indexChecksum = checksum;
+  m_indexChecksumIsUpToDate = true;
+  return checksum;
 }
 
 void FileSystem::notifyChangeToDelegate(const Record record) const {
@@ -174,6 +184,7 @@ Record::ErrorStatus FileSystem::createRecordWithDataChunks(
   }
   // Next Record is null-sized
   overrideSizeAtPosition(newRecord, 0);
+  indexAppendedRecord(newRecordAddress);
   Record r = Record(recordName);
   m_lastRecordRetrieved = r;
   m_lastRecordRetrievedPointer = newRecordAddress;
@@ -184,6 +195,10 @@ Record::ErrorStatus FileSystem::createRecordWithDataChunks(
 int FileSystem::numberOfRecordsWithFilter(const char *extension,
                                           RecordFilter filter,
                                           const void *auxiliary) {
+  bool hasCursor = moveCursorToFilter(extension, filter, auxiliary);
+  if (hasCursor && m_filterCursor.numberOfRecords >= 0) {
+    return m_filterCursor.numberOfRecords;
+  }
   int count = 0;
   for (char *p : *this) {
     Record::Name currentName = nameOfRecordStarting(p);
@@ -193,16 +208,27 @@ int FileSystem::numberOfRecordsWithFilter(const char *extension,
       count++;
     }
   }
+  if (hasCursor) {
+    m_filterCursor.numberOfRecords = count;
+  }
   return count;
 }
 
 Record FileSystem::recordWithFilterAtIndex(const char *extension, int index,
                                            RecordFilter filter,
                                            const void *auxiliary) {
+  bool hasCursor = moveCursorToFilter(extension, filter, auxiliary);
   int currentIndex = -1;
+  RecordIterator start = begin();
+  if (hasCursor && m_filterCursor.record && m_filterCursor.index <= index) {
+    // Resume from the last record found, which matches the filter
+    currentIndex = m_filterCursor.index - 1;
+    start = RecordIterator(m_filterCursor.record);
+  }
   Record::Name name = Record::EmptyName();
   char *recordAddress = nullptr;
-  for (char *p : *this) {
+  for (RecordIterator it = start; it != end(); ++it) {
+    char *p = *it;
     Record::Name currentName = nameOfRecordStarting(p);
     assert(currentName.extension);
     if (!Record::NameIsEmpty(currentName) && filter(currentName, auxiliary) &&
@@ -218,12 +244,39 @@ Record FileSystem::recordWithFilterAtIndex(const char *extension, int index,
   if (Record::NameIsEmpty(name)) {
     return Record();
   }
+  if (hasCursor) {
+    m_filterCursor.index = index;
+    m_filterCursor.record = recordAddress;
+  }
   Record r = Record(name);
   m_lastRecordRetrieved = r;
   m_lastRecordRetrievedPointer = recordAddress;
   return Record(name);
 }
 
+bool FileSystem::moveCursorToFilter(const char *extension, RecordFilter filter,
+                                    const void *auxiliary) const {
+  if (strlen(extension) >= k_cursorExtensionSize) {
+    return false;
+  }
+  char auxiliaryChar =
+      auxiliary ? *static_cast<const char *>(auxiliary) : 0;
+  if (m_filterCursor.filter != filter ||
+      m_filterCursor.auxiliary != auxiliaryChar ||
+      strcmp(m_filterCursor.extension, extension) != 0) {
+    strlcpy(m_filterCursor.extension, extension, k_cursorExtensionSize);
+    m_filterCursor.filter = filter;
+    m_filterCursor.auxiliary = auxiliaryChar;
+    invalidateCursor();
+  }
+  return true;
+}
+
+void FileSystem::invalidateCursor() const {
+  m_filterCursor.record = nullptr;
+  m_filterCursor.numberOfRecords = -1;
+}
+
 Record FileSystem::recordNamed(Record::Name name) {
   if (Record::NameIsEmpty(name)) {
     return Record();
@@ -250,6 +303,8 @@ const char *FileSystem::extensionOfRecordBaseNamedWithExtensions(
 
 void FileSystem::destroyAllRecords() {
   overrideSizeAtPosition(m_buffer, 0);
+  willChangeIndex();
+  m_numberOfIndexedRecords = 0;
   notifyChangeToDelegate();
 }
 
@@ -317,7 +372,11 @@ FileSystem::FileSystem()
       m_magicFooter(Magic),
       m_delegate(nullptr),
       m_lastRecordRetrieved(nullptr),
-      m_lastRecordRetrievedPointer(nullptr) {
+      m_lastRecordRetrievedPointer(nullptr),
+      m_filterCursor({"", nullptr, 0, -1, nullptr, -1}),
+      m_numberOfIndexedRecords(0),
+      m_indexChecksum(0),
+      m_indexChecksumIsUpToDate(false) {
   assert(m_magicHeader == Magic);
   assert(m_magicFooter == Magic);
   // Set the size of the first record to 0
@@ -363,6 +422,7 @@ Record::ErrorStatus FileSystem::setNameOfRecord(Record *record,
     overrideSizeAtPosition(p, newRecordSize);
     char *namePosition = p + sizeof(record_size_t);
     overrideNameAtPosition(namePosition, name);
+    indexResizedRecord(p, newRecordSize - previousRecordSize);
     // Recompute the CRC32
     *record = newRecord;
     notifyChangeToDelegate(newRecord);
@@ -408,6 +468,7 @@ Record::ErrorStatus FileSystem::setValueOfRecord(Record record,
     overrideSizeAtPosition(p, newRecordSize);
     overrideValueAtPosition(p + sizeof(record_size_t) + nameSize, data.buffer,
                             data.size);
+    indexResizedRecord(p, newRecordSize - previousRecordSize);
     notifyChangeToDelegate(record);
     m_lastRecordRetrieved = record;
     m_lastRecordRetrievedPointer = p;
@@ -427,6 +488,7 @@ bool FileSystem::destroyRecord(Record record, bool notifyDelegate) {
   if (p) {
     record_size_t previousRecordSize = sizeOfRecordStarting(p);
     slideBuffer(p + previousRecordSize, -previousRecordSize);
+    indexDestroyedRecord(p, previousRecordSize);
     if (notifyDelegate) {
       notifyChangeToDelegate();
     }
@@ -442,6 +504,15 @@ char *FileSystem::pointerOfRecord(const Record record) const {
     assert(m_lastRecordRetrievedPointer);
     return m_lastRecordRetrievedPointer;
   }
+  if (indexIsAvailable()) {
+    int i = indexOfRecord(record);
+    if (i < 0) {
+      return nullptr;
+    }
+    m_lastRecordRetrieved = record;
+    m_lastRecordRetrievedPointer = recordAtIndex(i);
+    return m_lastRecordRetrievedPointer;
+  }
   for (char *p : *this) {
     Record currentRecord(nameOfRecordStarting(p));
     if (record == currentRecord) {
@@ -503,6 +574,10 @@ bool FileSystem::isNameOfRecordTaken(Record r, const Record *recordToExclude) {
      * name is nullptr. */
     return true;
   }
+  if (indexIsAvailable()) {
+    return (!recordToExclude || r != *recordToExclude) &&
+           indexOfRecord(r) >= 0;
+  }
   for (char *p : *this) {
     Record s(nameOfRecordStarting(p));
     if (recordToExclude && s == *recordToExclude) {
@@ -516,6 +591,17 @@ bool FileSystem::isNameOfRecordTaken(Record r, const Record *recordToExclude) {
 }
 
 char *FileSystem::endBuffer() {
+  if (indexIsAvailable()) {
+    if (m_numberOfIndexedRecords == 0) {
+      return m_buffer;
+    }
+    char *lastRecord = recordAtIndex(m_numberOfIndexedRecords - 1);
+    return lastRecord + sizeOfRecordStarting(lastRecord);
+  }
+  return endBufferWithoutIndex();
+}
+
+char *FileSystem::endBufferWithoutIndex() {
   char *currentBuffer = m_buffer;
   for (char *p : *this) {
     currentBuffer += sizeOfRecordStarting(p);
@@ -547,6 +633,32 @@ Record FileSystem::privateRecordBasedNamedWithExtensions(
           numberOfExtensions, extensionResult)) {
     return m_lastRecordRetrieved;
   }
+  if (indexIsAvailable()) {
+    /* Look each extension up and keep the first record in storage order, as
+     * the walk would. */
+    int firstIndex = -1;
+    for (size_t i = 0; i < numberOfExtensions; i++) {
+      int index = indexOfRecord(Record(
+          Record::Name({baseName, static_cast<size_t>(baseNameLength),
+                        extensions[i]})));
+      if (index >= 0 && (firstIndex < 0 || index < firstIndex)) {
+        firstIndex = index;
+      }
+    }
+    if (firstIndex >= 0) {
+      // Different names can have the same CRC32
+      Record::Name name = nameOfRecordStarting(recordAtIndex(firstIndex));
+      if (recordNameHasBaseNameAndOneOfTheseExtensions(
+              name, baseName, baseNameLength, extensions, numberOfExtensions,
+              extensionResult)) {
+        return Record(name);
+      }
+    }
+    if (extensionResult) {
+      *extensionResult = nullptr;
+    }
+    return Record();
+  }
   for (char *p : *this) {
     Record::Name currentName = nameOfRecordStarting(p);
     if (recordNameHasBaseNameAndOneOfTheseExtensions(
@@ -581,6 +693,116 @@ bool FileSystem::recordNameHasBaseNameAndOneOfTheseExtensions(
   return false;
 }
 
+bool FileSystem::indexIsAvailable() const {
+  if (m_numberOfIndexedRecords == k_unbuiltIndex) {
+    buildIndex();
+  }
+  return m_numberOfIndexedRecords >= 0;
+}
+
+void FileSystem::buildIndex() const {
+  int numberOfRecords = 0;
+  for (char *p : *this) {
+    if (numberOfRecords == k_maxNumberOfIndexedRecords) {
+      m_numberOfIndexedRecords = k_overflowedIndex;
+      return;
+    }
+    m_indexedRecords[numberOfRecords] = Record(nameOfRecordStarting(p));
+    m_indexedRecordsOffsets[numberOfRecords] = p - m_buffer;
+    numberOfRecords++;
+  }
+  m_numberOfIndexedRecords = numberOfRecords;
+}
+
+int FileSystem::indexOfRecord(const Record record) const {
+  assert(m_numberOfIndexedRecords >= 0);
+  if (record.isNull()) {
+    return -1;
+  }
+  for (int i = 0; i < m_numberOfIndexedRecords; i++) {
+    if (m_indexedRecords[i] == record) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+int FileSystem::indexOfRecordStarting(const char *start) const {
+  assert(m_numberOfIndexedRecords >= 0);
+  record_size_t offset = start - m_buffer;
+  // Offsets are sorted
+  int min = 0;
+  int max = m_numberOfIndexedRecords;
+  while (min < max) {
+    int middle = (min + max) / 2;
+    if (m_indexedRecordsOffsets[middle] < offset) {
+      min = middle + 1;
+    } else {
+      max = middle;
+    }
+  }
+  assert(min < m_numberOfIndexedRecords &&
+         m_indexedRecordsOffsets[min] == offset);
+  return min;
+}
+
+void FileSystem::invalidateIndex() {
+  willChangeIndex();
+  m_numberOfIndexedRecords = k_unbuiltIndex;
+}
+
+void FileSystem::indexAppendedRecord(char *start) {
+  willChangeIndex();
+  if (m_numberOfIndexedRecords < 0) {
+    return;
+  }
+  if (m_numberOfIndexedRecords == k_maxNumberOfIndexedRecords) {
+    m_numberOfIndexedRecords = k_overflowedIndex;
+    return;
+  }
+  m_indexedRecords[m_numberOfIndexedRecords] =
+      Record(nameOfRecordStarting(start));
+  m_indexedRecordsOffsets[m_numberOfIndexedRecords] = start - m_buffer;
+  m_numberOfIndexedRecords++;
+}
+
+void FileSystem::indexResizedRecord(char *start, int delta) {
+  willChangeIndex();
+  if (m_numberOfIndexedRecords < 0) {
+    return;
+  }
+  int i = indexOfRecordStarting(start);
+  // The record may have been renamed
+  m_indexedRecords[i] = Record(nameOfRecordStarting(start));
+  for (int j = i + 1; j < m_numberOfIndexedRecords; j++) {
+    m_indexedRecordsOffsets[j] += delta;
+  }
+}
+
+void FileSystem::indexDestroyedRecord(char *start, int size) {
+  willChangeIndex();
+  if (m_numberOfIndexedRecords == k_overflowedIndex) {
+    // There may now be few enough records to index them
+    m_numberOfIndexedRecords = k_unbuiltIndex;
+  }
+  if (m_numberOfIndexedRecords < 0) {
+    return;
+  }
+  int i = indexOfRecordStarting(start);
+  m_numberOfIndexedRecords--;
+  for (int j = i; j < m_numberOfIndexedRecords; j++) {
+    m_indexedRecords[j] = m_indexedRecords[j + 1];
+    m_indexedRecordsOffsets[j] = m_indexedRecordsOffsets[j + 1] - size;
+  }
+}
+
+void FileSystem::willChangeIndex() {
+  m_lastRecordRetrieved = Record(nullptr);
+  m_lastRecordRetrievedPointer = nullptr;
+  invalidateCursor();
+  m_indexChecksumIsUpToDate = false;
+}
+
 FileSystem::RecordIterator &FileSystem::RecordIterator::operator++() {
   assert(m_recordStart);
   record_size_t size = StorageHelper::unalignedShort(m_recordStart);
@@ -179,6 +179,7 @@ class RGB888Pixel {
   RGB888Pixel() {}
   RGB888Pixel(KDColor c)
       : m_red(c.red()), m_green(c.green()), m_blue(c.blue()) {}
+  KDColor toKDColor() const { return KDColor::RGB888(m_red, m_green, m_blue); }
 
  private:
   uint8_t m_red;
@@ -218,6 +219,32 @@ void saveImage(const KDColor *pixels, int width, int height, const char *path) {
   fclose(file);
 }
 
+bool readImage(KDColor *pixels, int width, int height, const char *path) {
+  png_image image;
+  memset(&image, 0, sizeof(image));
+  image.version = PNG_IMAGE_VERSION;
+  if (!png_image_begin_read_from_file(&image, path)) {
+    return false;
+  }
+  if (image.width != static_cast<png_uint_32>(width) ||
+      image.height != static_cast<png_uint_32>(height)) {
+    png_image_free(&image);
+    return false;
+  }
+  // Screenshots are opaque, so the alpha channel of references can be dropped
+  image.format = PNG_FORMAT_RGB;
+  RGB888Pixel *buffer = new RGB888Pixel[width * height];
+  bool result =
+      png_image_finish_read(&image, nullptr, buffer, 0, nullptr) != 0;
+  if (result) {
+    for (int i = 0; i < width * height; i++) {
+      pixels[i] = buffer[i].toKDColor();
+    }
+  }
+  delete[] buffer;
+  return result;
+}
+
 void copyImageToClipboard(const KDColor *pixels, int width, int height) {
   // Unsupported
 }
@@ -145,6 +145,35 @@ void saveImage(const KDColor * pixels, int width, int height, const char * path)
   CGImageRelease(image);
 }
 
+bool readImage(KDColor * pixels, int width, int height, const char * path) {
+  CFURLRef url = static_cast<CFURLRef>([NSURL fileURLWithPath:[NSString stringWithUTF8String:path]]);
+  CGImageSourceRef source = CGImageSourceCreateWithURL(url, NULL);
+  if (source == nullptr) {
+    return false;
+  }
+  CGImageRef image = CGImageSourceCreateImageAtIndex(source, 0, NULL);
+  CFRelease(source);
+  if (image == nullptr) {
+    return false;
+  }
+  bool result = false;
+  CGContextRef context = nullptr;
+  if (CGImageGetWidth(image) == static_cast<size_t>(width) && CGImageGetHeight(image) == static_cast<size_t>(height)) {
+    context = createABGR8888Context(width, height);
+  }
+  if (context) {
+    CGContextDrawImage(context, CGRectMake(0, 0, width, height), image);
+    const uint8_t * rgba8888Pixels = static_cast<const uint8_t *>(CGBitmapContextGetData(context));
+    for (int i=0; i<width*height; i++) {
+      const uint8_t * pixel = rgba8888Pixels + 4*i;
+      pixels[i] = KDColor::RGB888(pixel[0], pixel[1], pixel[2]);
+    }
+    CGContextRelease(context);
+    result = true;
+  }
+  CGImageRelease(image);
+  return result;
+}
 
 }
 }
@@ -0,0 +1,115 @@
+#include "benchmark.h"
+
+#include <ion/src/shared/events_scenarios.h>
+#include <string.h>
+
+#include <chrono>
+#include <cstdio>
+
+#include "framebuffer.h"
+#include "journal.h"
+
+#if POINCARE_TREE_STATS
+#include <poincare/tree_pool.h>
+#endif
+
+namespace Ion {
+namespace Simulator {
+
+static uint64_t micros() {
+  static auto start = std::chrono::steady_clock::now();
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration_cast<std::chrono::microseconds>(elapsed)
+      .count();
+}
+
+void Benchmark::PrintScenarios() {
+  for (int i = 0; i < Events::numberOfScenari; i++) {
+    printf("%s\n", Events::scenarios[i].name());
+  }
+}
+
+bool Benchmark::init(const char* scenarioName) {
+  m_scenarioIndex = -1;
+  for (int i = 0; i < Events::numberOfScenari; i++) {
+    if (strcmp(Events::scenarios[i].name(), scenarioName) == 0) {
+      m_scenarioIndex = i;
+      break;
+    }
+  }
+  if (m_scenarioIndex < 0) {
+    return false;
+  }
+  const Events::Scenario& scenario = Events::scenarios[m_scenarioIndex];
+  Events::Journal* journal = Journal::replayJournal();
+  for (int i = 0; i < scenario.numberOfEvents(); i++) {
+    journal->pushEvent(scenario.eventAtIndex(i));
+  }
+  Events::replayFrom(journal);
+  /* Pixels are only written to the framebuffer when it is active, which it is
+   * not when running headless. */
+  Framebuffer::setActive(true);
+  m_eventIndex = -1;
+  printf("# %s\n", scenario.name());
+  printf("# event\tid\ttime_us\tredraw_us\tpixels\tpeak_nodes\n");
+  return true;
+}
+
+void Benchmark::willHandleEvent(Events::Event event) {
+  if (!isActive()) {
+    return;
+  }
+  endEvent();
+  startEvent(event);
+}
+
+void Benchmark::willRedraw() {
+  if (isActive() && m_eventIndex >= 0 && m_redrawStart == 0) {
+    m_redrawStart = micros();
+  }
+}
+
+void Benchmark::didFinishReplay() {
+  if (!isActive()) {
+    return;
+  }
+  endEvent();
+  m_scenarioIndex = -1;
+  fflush(stdout);
+}
+
+void Benchmark::startEvent(Events::Event event) {
+  m_eventIndex++;
+  m_event = event;
+  m_numberOfPushedPixels = 0;
+  m_redrawStart = 0;
+#if POINCARE_TREE_STATS
+  Poincare::TreePool::sharedPool->resetStatistics();
+#endif
+  m_eventStart = micros();
+}
+
+void Benchmark::endEvent() {
+  if (m_eventIndex < 0) {
+    return;
+  }
+  uint64_t end = micros();
+  uint64_t redraw = m_redrawStart == 0 ? 0 : end - m_redrawStart;
+  printf("%d\t%d\t%llu\t%llu\t%u\t", m_eventIndex,
+         static_cast<uint8_t>(m_event),
+         static_cast<unsigned long long>(end - m_eventStart),
+         static_cast<unsigned long long>(redraw), m_numberOfPushedPixels);
+#if POINCARE_TREE_STATS
+  printf("%d\n", Poincare::TreePool::sharedPool->peakNumberOfNodes());
+#else
+  printf("\n");
+#endif
+}
+
+Benchmark* Benchmark::commandlineBenchmark() {
+  static Benchmark s_benchmark;
+  return &s_benchmark;
+}
+
+}  // namespace Simulator
+}  // namespace Ion
@@ -0,0 +1,52 @@
+#ifndef ION_SIMULATOR_BENCHMARK_H
+#define ION_SIMULATOR_BENCHMARK_H
+
+#include <ion/events.h>
+#include <stdint.h>
+
+namespace Ion {
+namespace Simulator {
+
+/* The Benchmark replays one of the scenarios of events_scenarios.h and prints,
+ * for each event, a line of tab-separated values on the standard output:
+ * - the index and the id of the event,
+ * - the time spent handling and drawing the event, in microseconds,
+ * - the time spent redrawing the window, in microseconds, measured from the
+ *   first wait for the vertical blank (which starts Window::redraw) to the end
+ *   of the event,
+ * - the number of pixels pushed to the display,
+ * - the peak number of nodes of the TreePool, when POINCARE_TREE_STATS is on.
+ * build/metrics/benchmark.py runs the scenarios and aggregates the results. */
+
+class Benchmark {
+ public:
+  Benchmark() : m_scenarioIndex(-1) {}
+  static void PrintScenarios();
+  // Return false if there is no scenario named scenarioName
+  bool init(const char* scenarioName);
+  bool isActive() const { return m_scenarioIndex >= 0; }
+
+  void willHandleEvent(Events::Event event);
+  void willRedraw();
+  void didPushPixels(uint32_t numberOfPixels) {
+    m_numberOfPushedPixels += numberOfPixels;
+  }
+  void didFinishReplay();
+  static Benchmark* commandlineBenchmark();
+
+ private:
+  void startEvent(Events::Event event);
+  void endEvent();
+
+  int m_scenarioIndex;
+  int m_eventIndex;
+  Events::Event m_event;
+  uint64_t m_eventStart;
+  uint64_t m_redrawStart;
+  uint32_t m_numberOfPushedPixels;
+};
+
+}  // namespace Simulator
+}  // namespace Ion
+
+#endif
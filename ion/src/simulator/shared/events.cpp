@@ -21,6 +21,7 @@
 #endif
 
 #if ION_SIMULATOR_FILES
+#include "benchmark.h"
 #include "screenshot.h"
 #endif
 
@@ -92,6 +93,7 @@ Event getEvent(int *timeout) {
 #if ION_SIMULATOR_FILES
       // Save screenshot
       Simulator::Screenshot::commandlineScreenshot()->capture();
+      Simulator::Benchmark::commandlineBenchmark()->didFinishReplay();
 #endif
     } else {
       res = sSourceJournal->popEvent();
@@ -101,6 +103,7 @@ Event getEvent(int *timeout) {
 #if ION_SIMULATOR_FILES
       // Save step screenshot
       Simulator::Screenshot::commandlineScreenshot()->captureStep(res);
+      Simulator::Benchmark::commandlineBenchmark()->willHandleEvent(res);
 #endif
     }
   }
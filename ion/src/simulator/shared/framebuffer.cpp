@@ -5,6 +5,9 @@
 #include <kandinsky/framebuffer.h>
 
 #include "window.h"
+#if ION_SIMULATOR_FILES
+#include "benchmark.h"
+#endif
 
 /* Drawing on an SDL texture
  * In SDL2, drawing bitmap data happens through textures, whose data lives in
@@ -29,6 +32,10 @@ static KDFrameBuffer sFrameBuffer =
 void pushRect(KDRect r, const KDColor* pixels) {
   if (sFrameBufferActive) {
     Simulator::Window::setNeedsRefresh();
+#if ION_SIMULATOR_FILES
+    Simulator::Benchmark::commandlineBenchmark()->didPushPixels(
+        r.width() * r.height());
+#endif
     sFrameBuffer.pushRect(r, pixels);
   }
 }
@@ -36,6 +43,10 @@ void pushRect(KDRect r, const KDColor* pixels) {
 void pushRectUniform(KDRect r, KDColor c) {
   if (sFrameBufferActive) {
     Simulator::Window::setNeedsRefresh();
+#if ION_SIMULATOR_FILES
+    Simulator::Benchmark::commandlineBenchmark()->didPushPixels(
+        r.width() * r.height());
+#endif
     sFrameBuffer.pushRectUniform(r, c);
   }
 }
@@ -46,6 +57,14 @@ void pullRect(KDRect r, KDColor* pixels) {
   }
 }
 
+bool waitForVBlank() {
+#if ION_SIMULATOR_FILES
+  // Escher waits for the vertical blank before redrawing the window
+  Simulator::Benchmark::commandlineBenchmark()->willRedraw();
+#endif
+  return true;
+}
+
 }  // namespace Display
 }  // namespace Ion
 
@@ -1,3 +1,4 @@
+#include <ion/persisting_bytes.h>
 #include <ion/src/shared/events.h>
 #include <ion/src/shared/events_modifier.h>
 #include <ion/storage/file_system.h>
@@ -10,4 +11,12 @@ void Init() {
   Storage::FileSystem::sharedFileSystem.init();
 }
 
+void Deinit() {
+  Storage::FileSystem::sharedFileSystem.deinit();
+  Events::SharedState.deinit();
+  Events::SharedModifierState.deinit();
+  // The next run starts as if the calculator had been reset
+  PersistingBytes::write(0);
+}
+
 }  // namespace Ion
@@ -22,6 +22,8 @@
 #include <stdio.h>
 
 #include "actions.h"
+#include "benchmark.h"
+#include "framebuffer.h"
 #include "screenshot.h"
 extern "C" {
 extern char *eadk_external_data;
@@ -152,6 +154,91 @@ static inline int load_eadk_external_data(const char *path) {
 
 using namespace Ion::Simulator;
 
+#if ION_SIMULATOR_FILES
+static const char *stateFileLanguage() {
+  const char *replayJournalLanguage =
+      Journal::replayJournal()->startingLanguage();
+  if (replayJournalLanguage[0] == 0) {
+    /* If the state file contains the wildcard language, still set the
+     * language to none so that the initial country is WorldWide and the
+     * statefile stays consistent whatever the platform language. */
+    return "none";
+  }
+  return replayJournalLanguage;
+}
+
+/* Run ion_main once for each state file listed in listPath, one path per line
+ * ("-" reads the list from the standard input). The storage and the apps are
+ * built again before each run, which spares the startup of a process per state
+ * file. The final screen of each state file is saved as a PNG named after it in
+ * screenshotsFolder. If referencesFolder is set, the screen is compared to the
+ * image of the same name in it instead, and only the screenshots that differ
+ * are saved. Return the number of state files that could not be loaded or that
+ * do not match their reference, or -1 if the list cannot be read. */
+static int replayStateFiles(const Args &args, const char *listPath,
+                            const char *screenshotsFolder,
+                            const char *referencesFolder) {
+  FILE *list = strcmp(listPath, "-") == 0 ? stdin : fopen(listPath, "r");
+  if (list == nullptr) {
+    fprintf(stderr, "Error: cannot read %s\n", listPath);
+    return -1;
+  }
+  Screenshot *screenshot = Screenshot::commandlineScreenshot();
+  // The screen must be drawn even if no screenshot is saved
+  Framebuffer::setActive(true);
+  int numberOfFailures = 0;
+  constexpr size_t k_pathSize = 1024;
+  char stateFile[k_pathSize];
+  while (fgets(stateFile, k_pathSize, list) != nullptr) {
+    stateFile[strcspn(stateFile, "\r\n")] = 0;
+    if (stateFile[0] == 0) {
+      continue;
+    }
+    Journal::replayJournal()->setStartingLanguage("");
+    if (!StateFile::load(stateFile)) {
+      printf("%s\tERROR\n", stateFile);
+      numberOfFailures++;
+      continue;
+    }
+
+    const char *name = strrchr(stateFile, '/');
+    name = name != nullptr ? name + 1 : stateFile;
+    const char *extension = strrchr(name, '.');
+    int nameLength = extension != nullptr ? extension - name : strlen(name);
+    char screenshotPath[k_pathSize];
+    char referencePath[k_pathSize];
+    if (screenshotsFolder != nullptr) {
+      snprintf(screenshotPath, k_pathSize, "%s/%.*s.png", screenshotsFolder,
+               nameLength, name);
+    }
+    if (referencesFolder != nullptr) {
+      snprintf(referencePath, k_pathSize, "%s/%.*s.png", referencesFolder,
+               nameLength, name);
+    }
+    screenshot->init(screenshotsFolder != nullptr ? screenshotPath : nullptr);
+    screenshot->setReference(referencesFolder != nullptr ? referencePath
+                                                         : nullptr);
+
+    Args runArgs = args;
+    runArgs.pop(k_languageFlag);
+    runArgs.push(k_languageFlag, stateFileLanguage());
+    Ion::Init();
+    ion_main(runArgs.argc(), runArgs.argv());
+    Ion::Deinit();
+
+    if (referencesFolder != nullptr) {
+      bool matches = screenshot->matchesReference();
+      printf("%s\t%s\n", stateFile, matches ? "OK" : "FAILED");
+      numberOfFailures += !matches;
+    }
+  }
+  if (list != stdin) {
+    fclose(list);
+  }
+  return numberOfFailures;
+}
+#endif
+
 int main(int argc, char *argv[]) {
   Args args(argc, argv);
 
@@ -178,15 +265,7 @@ int main(int argc, char *argv[]) {
               "the language of the statefile will be used instead.\n");
       args.pop(k_languageFlag);
     }
-    const char *replayJournalLanguage =
-        Journal::replayJournal()->startingLanguage();
-    if (replayJournalLanguage[0] == 0) {
-      /* If the state file contains the wildcard language, still set the
-       * language to none so that the initial country is WorldWide and the
-       * statefile stays consistent whatever the platform language. */
-      replayJournalLanguage = "none";
-    }
-    args.push(k_languageFlag, replayJournalLanguage);
+    args.push(k_languageFlag, stateFileLanguage());
   }
 
   const char *screenshotPath = args.pop("--take-screenshot");
@@ -199,6 +278,33 @@ int main(int argc, char *argv[]) {
     Ion::Simulator::Screenshot::commandlineScreenshot()->initEachStep(
         allScreenshotsFolder);
   }
+
+  if (args.popFlag("--list-benchmarks")) {
+    Ion::Simulator::Benchmark::PrintScenarios();
+    return 0;
+  }
+
+  const char *replayList = args.pop("--replay-state-files");
+  const char *screenshotsFolder = args.pop("--screenshots-folder");
+  const char *referencesFolder = args.pop("--reference-screenshots");
+  if (replayList && stateFile) {
+    fprintf(stderr,
+            "Error: --replay-state-files replaces --load-state-file\n");
+    return -1;
+  }
+
+  const char *benchmarkScenario = args.pop("--benchmark");
+  if (benchmarkScenario) {
+    if (stateFile || replayList) {
+      fprintf(stderr, "Error: --benchmark replaces --load-state-file\n");
+      return -1;
+    }
+    if (!Ion::Simulator::Benchmark::commandlineBenchmark()->init(
+            benchmarkScenario)) {
+      fprintf(stderr, "Error: unknown benchmark %s\n", benchmarkScenario);
+      return -1;
+    }
+  }
 #if !defined(_WIN32)
   signal(SIGUSR1, Ion::Simulator::Actions::handleUSR1Sig);
 #endif
@@ -212,6 +318,17 @@ int main(int argc, char *argv[]) {
   bool headless = args.popFlags(k_headlessFlags, std::size(k_headlessFlags));
 
   Random::init();
+#if ION_SIMULATOR_FILES
+  if (replayList) {
+    if (!headless) {
+      fprintf(stderr, "Error: --replay-state-files requires --headless\n");
+      return -1;
+    }
+    int numberOfFailures = replayStateFiles(
+        args, replayList, screenshotsFolder, referencesFolder);
+    return numberOfFailures == 0 ? 0 : numberOfFailures < 0 ? -1 : 1;
+  }
+#endif
   if (!headless) {
     Journal::init();
     if (args.has(k_languageFlag) && Journal::logJournal()) {
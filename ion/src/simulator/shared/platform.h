@@ -15,6 +15,9 @@ void copyImageToClipboard(const KDColor* pixels, int width, int height);
 const char* filePathForReading(const char* extension);
 const char* filePathForWriting(const char* extension);
 void saveImage(const KDColor* pixels, int width, int height, const char* path);
+/* Return false if the image at path cannot be read or if its dimensions are
+ * not width x height. */
+bool readImage(KDColor* pixels, int width, int height, const char* path);
 const char* filePathInTempDir(const char* filename);
 const char* cacheWindowPositionFilePath();
 #endif
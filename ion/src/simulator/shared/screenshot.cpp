@@ -5,6 +5,7 @@
 #include <kandinsky/font.h>
 
 #include <cstdio>
+#include <cstring>
 
 #include "framebuffer.h"
 #include "platform.h"
@@ -23,7 +24,10 @@ constexpr static KDColor k_backgroundColor = KDColorBlack;
 constexpr static KDColor k_glyphColor = KDColorWhite;
 #endif
 
-Screenshot::Screenshot(const char* path) { init(path); }
+Screenshot::Screenshot(const char* path)
+    : m_path(nullptr), m_referencePath(nullptr), m_matchesReference(false) {
+  init(path);
+}
 
 void Screenshot::init(const char* path, bool eachStep) {
   if (path != m_path) {
@@ -93,6 +97,18 @@ void Screenshot::capture(Events::Event nextEvent) {
   }
 #endif
 
+  if (m_referencePath != nullptr) {
+    KDColor referenceBuffer[Display::Height * k_width];
+    m_matchesReference =
+        height == Display::Height &&
+        Simulator::Platform::readImage(referenceBuffer, k_width, height,
+                                       m_referencePath) &&
+        memcmp(pixelsBuffer, referenceBuffer, sizeof(referenceBuffer)) == 0;
+    if (m_matchesReference) {
+      return;
+    }
+  }
+
   if (m_path != nullptr) {
     constexpr size_t pathSize = 1024;
     char path[pathSize];
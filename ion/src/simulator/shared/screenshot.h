@@ -11,14 +11,23 @@ class Screenshot {
   Screenshot(const char* path = nullptr);
   void initEachStep(const char* path) { init(path, true); }
   void init(const char* path, bool eachStep = false);
+  /* Compare the next captures to the image at path, and only save those that
+   * differ from it. */
+  void setReference(const char* path) {
+    m_referencePath = path;
+    m_matchesReference = false;
+  }
+  bool matchesReference() const { return m_matchesReference; }
   void captureStep(Events::Event nextEvent = Events::None);
   void capture(Events::Event nextEvent = Events::None);
   static Screenshot* commandlineScreenshot();
 
  private:
   const char* m_path;
+  const char* m_referencePath;
   int m_stepNumber;
   bool m_eachStep;
+  bool m_matchesReference;
 };
 
 }  // namespace Simulator
@@ -91,7 +91,7 @@ static inline bool loadFile(FILE* f, bool headlessStateFile) {
   return true;
 }
 
-void load(const char* filename, bool headlessStateFile) {
+bool load(const char* filename, bool headlessStateFile) {
   FILE* f = nullptr;
   if (strcmp(filename, "-") == 0) {
     f = stdin;
@@ -99,12 +99,13 @@ void load(const char* filename, bool headlessStateFile) {
     f = fopen(filename, "rb");
   }
   if (f == nullptr) {
-    return;
+    return false;
   }
-  loadFile(f, headlessStateFile);
+  bool result = loadFile(f, headlessStateFile);
   if (f != stdin) {
     fclose(f);
   }
+  return result;
 }
 
 void loadMemory(const char* buffer, size_t length, bool headlessStateFile) {
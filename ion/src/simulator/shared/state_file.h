@@ -5,7 +5,8 @@ namespace Ion {
 namespace Simulator {
 namespace StateFile {
 
-void load(const char* filename, bool headlessStateFile = false);
+// Return false if the file cannot be read or has a wrong header
+bool load(const char* filename, bool headlessStateFile = false);
 bool loadMemory(const char* buffer, size_t length,
                 bool headlessStateFiles = false);
 void save(const char* filename);
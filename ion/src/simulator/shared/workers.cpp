@@ -0,0 +1,44 @@
+#include <ion/workers.h>
+
+#include <algorithm>
+#include <thread>
+
+namespace Ion {
+namespace Workers {
+
+/* Values tables and curves only provide a few dozen items at a time, which
+ * would not keep more threads busy. */
+constexpr static int k_maxNumberOfWorkers = 8;
+
+int NumberOfWorkers() {
+  static int s_numberOfWorkers = std::clamp(
+      static_cast<int>(std::thread::hardware_concurrency()), 1,
+      k_maxNumberOfWorkers);
+  return s_numberOfWorkers;
+}
+
+void Run(Task task, int numberOfItems, void* context) {
+  int numberOfRanges = std::min(NumberOfWorkers(), numberOfItems);
+  if (numberOfRanges <= 1) {
+    if (numberOfItems > 0) {
+      task(0, numberOfItems, context);
+    }
+    return;
+  }
+  // The calling thread takes the first range instead of waiting idle
+  std::thread threads[k_maxNumberOfWorkers - 1];
+  int start = numberOfItems / numberOfRanges;
+  for (int i = 1; i < numberOfRanges; i++) {
+    int end = static_cast<int>(static_cast<long>(numberOfItems) * (i + 1) /
+                               numberOfRanges);
+    threads[i - 1] = std::thread(task, start, end, context);
+    start = end;
+  }
+  task(0, numberOfItems / numberOfRanges, context);
+  for (int i = 1; i < numberOfRanges; i++) {
+    threads[i - 1].join();
+  }
+}
+
+}  // namespace Workers
+}  // namespace Ion
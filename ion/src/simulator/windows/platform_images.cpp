@@ -151,6 +151,30 @@ void saveImage(const KDColor *pixels, int width, int height, const char *path) {
   }
 }
 
+bool readImage(KDColor *pixels, int width, int height, const char *path) {
+  GdiplusSession session;
+  wchar_t *widePath = createWideCharArray(path);
+  bool result = false;
+  {
+    Gdiplus::Bitmap bitmap(widePath);
+    if (bitmap.GetLastStatus() == Gdiplus::Ok &&
+        bitmap.GetWidth() == static_cast<UINT>(width) &&
+        bitmap.GetHeight() == static_cast<UINT>(height)) {
+      for (int j = 0; j < height; j++) {
+        for (int i = 0; i < width; i++) {
+          Gdiplus::Color color;
+          bitmap.GetPixel(i, j, &color);
+          pixels[i + width * j] =
+              KDColor::RGB888(color.GetR(), color.GetG(), color.GetB());
+        }
+      }
+      result = true;
+    }
+  }
+  delete[] widePath;
+  return result;
+}
+
 void copyImageToClipboard(const KDColor *pixels, int width, int height) {
   // TODO
 }
@@ -1,6 +1,7 @@
 #include <assert.h>
 #include <ion/storage/file_system.h>
 #include <quiz.h>
+#include <stdio.h>
 #include <string.h>
 
 using namespace Ion;
@@ -748,3 +749,68 @@ QUIZ_CASE(ion_storage_record_name_verifier) {
   recordNameVerifier->unregisterAllRestrictiveExtensions();
   recordNameVerifier->unregisterAllReservedNames();
 }
+
+QUIZ_CASE(ion_storage_many_records) {
+  /* Create more records than the FileSystem indexes, interleaving two
+   * extensions, and check lookups while the records are modified. */
+  constexpr int k_numberOfRecords = 150;
+  Storage::FileSystem *fileSystem = Storage::FileSystem::sharedFileSystem;
+  int initialNumberOfTest1 = fileSystem->numberOfRecordsWithExtension("test1");
+  quiz_assert(initialNumberOfTest1 == 0);
+  char baseName[8];
+  for (int i = 0; i < k_numberOfRecords; i++) {
+    snprintf(baseName, sizeof(baseName), "r%d", i);
+    createTestRecordWithErrorStatus(baseName, i % 3 == 0 ? "test2" : "test1");
+  }
+  int numberOfTest2 = (k_numberOfRecords + 2) / 3;
+  int numberOfTest1 = k_numberOfRecords - numberOfTest2;
+  for (int step = 0; step < 2; step++) {
+    quiz_assert(fileSystem->numberOfRecordsWithExtension("test1") ==
+                numberOfTest1);
+    quiz_assert(fileSystem->numberOfRecordsWithExtension("test2") ==
+                numberOfTest2);
+    // Records with extension test1 are listed in creation order
+    int test1Index = 0;
+    for (int i = 0; i < k_numberOfRecords; i++) {
+      if (i % 3 == 0 || (step == 1 && i % 2 == 0)) {
+        continue;
+      }
+      snprintf(baseName, sizeof(baseName), "r%d", i);
+      Storage::Record record =
+          fileSystem->recordWithExtensionAtIndex("test1", test1Index++);
+      quiz_assert(record == getRecord(baseName, "test1"));
+      quiz_assert(record.hasExtension("test1"));
+      // Interleaved lookups of another extension do not break the listing
+      quiz_assert(fileSystem->recordWithExtensionAtIndex("test2", 0) ==
+                  getRecord("r0", "test2"));
+    }
+    quiz_assert(test1Index == numberOfTest1);
+    quiz_assert(fileSystem->recordWithExtensionAtIndex("test1", test1Index)
+                    .isNull());
+    if (step == 0) {
+      // Destroy half of the test1 records and grow the others
+      for (int i = 0; i < k_numberOfRecords; i++) {
+        if (i % 3 == 0) {
+          continue;
+        }
+        snprintf(baseName, sizeof(baseName), "r%d", i);
+        Storage::Record record = getRecord(baseName, "test1");
+        if (i % 2 == 0) {
+          record.destroy();
+          numberOfTest1--;
+        } else {
+          const char *data = "longer data";
+          record.setValue({.buffer = data, .size = strlen(data) + 1});
+        }
+      }
+      quiz_assert(isDataOfRecord("r1", "test1", "longer data"));
+      quiz_assert(getRecord("r2", "test1").isNull());
+    }
+  }
+  quiz_assert(isDataOfRecord("r149", "test1", "longer data"));
+  quiz_assert(isDataOfRecord("r147", "test2", "test"));
+  fileSystem->destroyRecordsWithExtension("test1");
+  fileSystem->destroyRecordsWithExtension("test2");
+  quiz_assert(fileSystem->numberOfRecordsWithExtension("test1") == 0);
+  quiz_assert(fileSystem->numberOfRecordsWithExtension("test2") == 0);
+}
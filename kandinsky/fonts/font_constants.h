@@ -6,4 +6,12 @@ constexpr
 #endif
     int k_grayscaleBitsPerPixel = 4;
 
+/* The glyph indexes of code points below this value are stored in a table
+ * indexed by the code point itself. It covers ASCII and Latin-1, which make
+ * up most of the drawn text. */
+#ifdef __cplusplus
+constexpr
+#endif
+    int k_numberOfDirectlyIndexedCodePoints = 0x100;
+
 #endif
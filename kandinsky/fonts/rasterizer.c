@@ -148,10 +148,12 @@ int writeCodePointToGlyphTableFiles(const char * cppFilename,
   fprintf(output, "/* This file is auto-generated by the rasterizer */\n\n");
   fprintf(output, "#include <kandinsky/font.h>\n\n");
   int numberOfCodePointsPairs = writeCodePointIndexPairTable(output);
+  writeDirectGlyphIndexTable(output);
 
   fprintf(output, "const KDFont::CodePointIndexPair * KDFont::s_CodePointToGlyphIndex = table;\n");
-  fprintf(output, "const size_t KDFont::s_codePointPairsTableLength = %d;\n\n",
+  fprintf(output, "const size_t KDFont::s_codePointPairsTableLength = %d;\n",
           numberOfCodePointsPairs);
+  fprintf(output, "const KDFont::GlyphIndex * KDFont::s_directGlyphIndex = directTable;\n\n");
   fclose(output);
   return numberOfCodePointsPairs;
 }
@@ -175,6 +177,28 @@ int writeCodePointIndexPairTable(FILE * output) {
   return numberOfPairs;
 }
 
+void writeDirectGlyphIndexTable(FILE * output) {
+  int replacementIndex = -1;
+  for (int i = 0; i < NumberOfCodePoints; i++) {
+    if (CodePoints[i] == 0xFFFD) {
+      replacementIndex = i;
+    }
+  }
+  ENSURE(replacementIndex >= 0, "Missing the replacement character code point");
+  fprintf(output, "constexpr static KDFont::GlyphIndex directTable[] = {");
+  int codePointIndex = 0;
+  for (uint32_t codePoint = 0; codePoint < k_numberOfDirectlyIndexedCodePoints; codePoint++) {
+    while (codePointIndex < NumberOfCodePoints && CodePoints[codePointIndex] < codePoint) {
+      codePointIndex++;
+    }
+    int glyphIndex = codePointIndex < NumberOfCodePoints && CodePoints[codePointIndex] == codePoint
+                         ? codePointIndex
+                         : replacementIndex;
+    fprintf(output, "%s%d,", codePoint % 16 == 0 ? "\n  " : " ", glyphIndex);
+  }
+  fprintf(output, "\n};\n\n");
+}
+
 void writeFontHeaderFile(const char * fontHeaderFilename, const char * fontName, int glyphWidth,
                          int glyphHeight) {
   FILE * fontFile = fopen(fontHeaderFilename, "w");
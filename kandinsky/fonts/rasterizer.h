@@ -67,6 +67,7 @@ int compressAndAppend(uint8_t* uncompressedGlyphBuffer,
                       int sizeOfUncompressedGlyphBuffer, uint8_t* glyphData,
                       int glyphDataOffset, int maxGlyphDataSize);
 int writeCodePointIndexPairTable(FILE* output);
+void writeDirectGlyphIndexTable(FILE* output);
 
 static void prettyPrintArray(FILE* stream, int maxWidth, int typeSize,
                              void* array, int numberOfElements);
@@ -4,12 +4,17 @@
 #include <kandinsky/glyph.h>
 #include <kandinsky/rect.h>
 
+class KDGlyphCache;
+
 class KDContext {
  public:
   KDPoint origin() const { return m_origin; }
   KDRect clippingRect() const { return m_clippingRect; }
   void setOrigin(KDPoint origin) { m_origin = origin; }
   void setClippingRect(KDRect clippingRect) { m_clippingRect = clippingRect; }
+  /* If a glyph cache is set, drawString takes the colorized glyphs from it
+   * instead of decompressing and colorizing them each time. */
+  void setGlyphCache(KDGlyphCache* glyphCache) { m_glyphCache = glyphCache; }
 
   // Pixel manipulation
   void setPixel(KDPoint p, KDColor c);
@@ -52,7 +57,9 @@ class KDContext {
 
  protected:
   KDContext(KDPoint origin, KDRect clippingRect)
-      : m_origin(origin), m_clippingRect(clippingRect) {}
+      : m_origin(origin),
+        m_clippingRect(clippingRect),
+        m_glyphCache(nullptr) {}
   virtual void pushRect(KDRect, const KDColor* pixels) = 0;
   virtual void pushRectUniform(KDRect rect, KDColor color) = 0;
   virtual void pullRect(KDRect rect, KDColor* pixels) = 0;
@@ -65,6 +72,7 @@ class KDContext {
   KDRect absoluteFillRect(KDRect rect);
   KDPoint m_origin;
   KDRect m_clippingRect;
+  KDGlyphCache* m_glyphCache;
 };
 
 #endif
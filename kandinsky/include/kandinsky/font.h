@@ -36,8 +36,10 @@ constexpr static int indexOf(const uint32_t* array, const int arraySize,
  * compressed glyph bitmaps (one per codepoint in CodePoints[]). We use the
  * s_codePointPairsTable[] to find the glyph index for a given codepoint: it
  * contains the CodePointIndexPairs of the first code point of each series of
- * consecutive code points in the CodePoints table. m_glyphDataOffset[] is used
- * to find the location of the buffer for a given glyph index. */
+ * consecutive code points in the CodePoints table, and is binary searched.
+ * The most common code points are looked up directly in
+ * s_directGlyphIndex[]. m_glyphDataOffset[] is used to find the location of
+ * the buffer for a given glyph index. */
 
 class KDFont {
  private:
@@ -108,6 +110,10 @@ class KDFont {
   void setGlyphGrayscalesForCodePoint(CodePoint codePoint,
                                       GlyphBuffer* glyphBuffer) const;
   void setGlyphGrayscalesForCharacter(char c, GlyphBuffer* glyphBuffer) const;
+  void setGlyphGrayscalesForGlyphIndex(GlyphIndex index,
+                                       GlyphBuffer* glyphBuffer) const {
+    fetchGrayscaleGlyphAtIndex(index, glyphBuffer->grayscaleBuffer());
+  }
   void accumulateGlyphGrayscalesForCodePoint(CodePoint codePoint,
                                              GlyphBuffer* glyphBuffer) const;
 
@@ -158,6 +164,8 @@ class KDFont {
 
   static const CodePointIndexPair* s_CodePointToGlyphIndex;
   static const size_t s_codePointPairsTableLength;
+  // Glyph indexes of the first k_numberOfDirectlyIndexedCodePoints code points
+  static const GlyphIndex* s_directGlyphIndex;
 };
 
 #endif
@@ -0,0 +1,55 @@
+#ifndef KANDINSKY_GLYPH_CACHE_H
+#define KANDINSKY_GLYPH_CACHE_H
+
+#include <kandinsky/color.h>
+#include <kandinsky/font.h>
+#include <omg/global_box.h>
+#include <stdint.h>
+
+/* Drawing a glyph requires decompressing its grayscales and colorizing them
+ * with the palette of the text and background colors. Since the same glyphs
+ * are drawn over and over (when scrolling a list or redrawing the console),
+ * the KDGlyphCache keeps the last colorized glyphs, ready to be pushed on the
+ * screen. When full, the least recently used glyph is evicted.
+ *
+ * Glyphs with combining code points are not cached. */
+
+class KDGlyphCache {
+  friend OMG::GlobalBox<KDGlyphCache>;
+
+ public:
+  static OMG::GlobalBox<KDGlyphCache> SharedCache;
+
+  constexpr static int k_numberOfGlyphs = 16;
+
+  /* Return the pixels of the glyph of index glyphIndex in font, colorized with
+   * the palette from glyphColor to backgroundColor. The pixels are valid until
+   * the next call. */
+  const KDColor* colorizedGlyph(KDFont::Size font,
+                                KDFont::GlyphIndex glyphIndex,
+                                KDColor glyphColor, KDColor backgroundColor);
+  void clear();
+
+  uint32_t numberOfHits() const { return m_numberOfHits; }
+  uint32_t numberOfMisses() const { return m_numberOfMisses; }
+
+ private:
+  struct Entry {
+    KDColor pixels[KDFont::k_maxGlyphPixelCount];
+    KDColor glyphColor;
+    KDColor backgroundColor;
+    // Value of m_clock when the entry was last used, 0 if the entry is empty
+    uint32_t lastUse;
+    KDFont::GlyphIndex glyphIndex;
+    KDFont::Size font;
+  };
+
+  KDGlyphCache() { clear(); }
+
+  Entry m_entries[k_numberOfGlyphs];
+  uint32_t m_clock;
+  uint32_t m_numberOfHits;
+  uint32_t m_numberOfMisses;
+};
+
+#endif
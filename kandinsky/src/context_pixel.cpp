@@ -20,12 +20,16 @@ void KDContext::getPixels(KDRect r, KDColor* pixels) {
     pullRect(rect, pixels);
     return;
   }
+  /* The bounds are computed as int since they can exceed KDCOORDINATE_MAX.
+   * Pixels past it are outside of any clipping rect and are left untouched. */
   int i = 0;
-  KDCoordinate yMax = r.y() + r.height();
-  KDCoordinate xMax = r.x() + r.width();
+  int yMax = r.y() + r.height();
+  int xMax = r.x() + r.width();
   for (int y = r.y(); y < yMax; y++) {
-    for (int x = r.x(); x < xMax; x++) {
-      getPixel(KDPoint(x, y), pixels + (i++));
+    for (int x = r.x(); x < xMax; x++, i++) {
+      if (x <= KDCOORDINATE_MAX && y <= KDCOORDINATE_MAX) {
+        getPixel(KDPoint(x, y), pixels + i);
+      }
     }
   }
 }
@@ -3,6 +3,7 @@
 #include <ion/unicode/utf8_decoder.h>
 #include <kandinsky/context.h>
 #include <kandinsky/font.h>
+#include <kandinsky/glyph_cache.h>
 
 #include <cmath>
 
@@ -93,20 +94,30 @@ KDPoint KDContext::drawString(const char* text, KDPoint p, KDGlyph::Style style,
       codePoint = decoder.nextCodePoint();
     } else {
       assert(!codePoint.isCombining());
-      KDFont::Font(style.font)
-          ->setGlyphGrayscalesForCodePoint(codePoint, &glyphBuffer);
+      CodePoint glyphCodePoint = codePoint;
       codePoint = decoder.nextCodePoint();
-      while (codePoint.isCombining()) {
+      const KDColor* glyphPixels;
+      if (m_glyphCache && !codePoint.isCombining()) {
+        glyphPixels = m_glyphCache->colorizedGlyph(
+            style.font,
+            KDFont::Font(style.font)->indexForCodePoint(glyphCodePoint),
+            style.glyphColor, style.backgroundColor);
+      } else {
         KDFont::Font(style.font)
-            ->accumulateGlyphGrayscalesForCodePoint(codePoint, &glyphBuffer);
-        codePointPointer = decoder.stringPosition();
-        codePoint = decoder.nextCodePoint();
+            ->setGlyphGrayscalesForCodePoint(glyphCodePoint, &glyphBuffer);
+        while (codePoint.isCombining()) {
+          KDFont::Font(style.font)
+              ->accumulateGlyphGrayscalesForCodePoint(codePoint, &glyphBuffer);
+          codePointPointer = decoder.stringPosition();
+          codePoint = decoder.nextCodePoint();
+        }
+        KDFont::Font(style.font)->colorizeGlyphBuffer(&palette, &glyphBuffer);
+        glyphPixels = glyphBuffer.colorBuffer();
       }
-      KDFont::Font(style.font)->colorizeGlyphBuffer(&palette, &glyphBuffer);
       /* Push the character on the screen
        * It's OK to trash the content of the color buffer since we'll re-fetch
        * it for the next char anyway */
-      fillRectWithPixels(KDRect(position, glyphSize), glyphBuffer.colorBuffer(),
+      fillRectWithPixels(KDRect(position, glyphSize), glyphPixels,
                          glyphBuffer.colorBuffer());
       position = position.translatedBy(KDPoint(glyphSize.width(), 0));
       if (origin().x() + position.x() >= Ion::Display::Width) {
@@ -103,29 +103,28 @@ void KDFont::colorizeGlyphBuffer(const RenderPalette* renderPalette,
 }
 
 KDFont::GlyphIndex KDFont::indexForCodePoint(CodePoint c) const {
-  const CodePointIndexPair* currentPair = s_CodePointToGlyphIndex;
-  const CodePointIndexPair* endPair =
-      &s_CodePointToGlyphIndex[s_codePointPairsTableLength - 1];
-  if (c < currentPair->codePoint()) {
-    goto NoMatchingGlyph;
+  if (c < static_cast<uint32_t>(k_numberOfDirectlyIndexedCodePoints)) {
+    return s_directGlyphIndex[c];
   }
-  while (currentPair < endPair) {
-    const CodePointIndexPair* nextPair = currentPair + 1;
-    if (c < nextPair->codePoint()) {
-      CodePoint lastCodePointOfCurrentPair =
-          currentPair->codePoint() +
-          (nextPair->glyphIndex() - currentPair->glyphIndex() - 1);
-      if (c > lastCodePointOfCurrentPair) {
-        goto NoMatchingGlyph;
-      }
+  /* Find the series of consecutive code points starting at the last pair
+   * whose code point is lower or equal to c. */
+  const CodePointIndexPair* firstPair = s_CodePointToGlyphIndex;
+  const CodePointIndexPair* endPair =
+      s_CodePointToGlyphIndex + s_codePointPairsTableLength;
+  const CodePointIndexPair* nextPair = std::upper_bound(
+      firstPair, endPair, c,
+      [](CodePoint codePoint, const CodePointIndexPair& pair) {
+        return codePoint < pair.codePoint();
+      });
+  if (nextPair != firstPair) {
+    const CodePointIndexPair* currentPair = nextPair - 1;
+    uint32_t lengthOfSeries =
+        (nextPair == endPair ? NumberOfCodePoints : nextPair->glyphIndex()) -
+        currentPair->glyphIndex();
+    if (c - currentPair->codePoint() < lengthOfSeries) {
       return currentPair->glyphIndex() + (c - currentPair->codePoint());
     }
-    currentPair = nextPair;
-  }
-  if (endPair->codePoint() == c) {
-    return endPair->glyphIndex();
   }
-NoMatchingGlyph:
   assert(CodePoints[k_indexForReplacementCharacterCodePoint] == 0xFFFD);
   return k_indexForReplacementCharacterCodePoint;
 }
@@ -134,10 +133,9 @@ bool KDFont::CanBeWrittenWithGlyphs(const char* text) {
   UTF8Decoder decoder(text);
   CodePoint cp = decoder.nextCodePoint();
   while (cp != UCodePointNull) {
+    // All fonts share the same code point to glyph index tables
     if (privateLargeFont.indexForCodePoint(cp) ==
-            k_indexForReplacementCharacterCodePoint ||
-        privateSmallFont.indexForCodePoint(cp) ==
-            k_indexForReplacementCharacterCodePoint) {
+        k_indexForReplacementCharacterCodePoint) {
       return false;
     }
     cp = decoder.nextCodePoint();
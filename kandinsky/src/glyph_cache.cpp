@@ -0,0 +1,50 @@
+#include <assert.h>
+#include <kandinsky/glyph_cache.h>
+#include <string.h>
+
+OMG::GlobalBox<KDGlyphCache> KDGlyphCache::SharedCache;
+
+const KDColor* KDGlyphCache::colorizedGlyph(KDFont::Size font,
+                                            KDFont::GlyphIndex glyphIndex,
+                                            KDColor glyphColor,
+                                            KDColor backgroundColor) {
+  m_clock++;
+  Entry* leastRecentlyUsed = m_entries;
+  for (Entry& entry : m_entries) {
+    if (entry.lastUse != 0 && entry.glyphIndex == glyphIndex &&
+        entry.font == font && entry.glyphColor == glyphColor &&
+        entry.backgroundColor == backgroundColor) {
+      m_numberOfHits++;
+      entry.lastUse = m_clock;
+      return entry.pixels;
+    }
+    if (entry.lastUse < leastRecentlyUsed->lastUse) {
+      leastRecentlyUsed = &entry;
+    }
+  }
+  m_numberOfMisses++;
+  const KDFont* kdFont = KDFont::Font(font);
+  KDFont::GlyphBuffer glyphBuffer;
+  kdFont->setGlyphGrayscalesForGlyphIndex(glyphIndex, &glyphBuffer);
+  KDFont::RenderPalette palette =
+      kdFont->renderPalette(glyphColor, backgroundColor);
+  kdFont->colorizeGlyphBuffer(&palette, &glyphBuffer);
+  KDSize glyphSize = KDFont::GlyphSize(font);
+  memcpy(leastRecentlyUsed->pixels, glyphBuffer.colorBuffer(),
+         glyphSize.width() * glyphSize.height() * sizeof(KDColor));
+  leastRecentlyUsed->glyphColor = glyphColor;
+  leastRecentlyUsed->backgroundColor = backgroundColor;
+  leastRecentlyUsed->glyphIndex = glyphIndex;
+  leastRecentlyUsed->font = font;
+  leastRecentlyUsed->lastUse = m_clock;
+  return leastRecentlyUsed->pixels;
+}
+
+void KDGlyphCache::clear() {
+  for (Entry& entry : m_entries) {
+    entry.lastUse = 0;
+  }
+  m_clock = 0;
+  m_numberOfHits = 0;
+  m_numberOfMisses = 0;
+}
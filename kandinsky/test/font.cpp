@@ -26,3 +26,41 @@ QUIZ_CASE(kandinsky_font_index_for_code_point) {
                  valueNotInArray(CodePoints, NumberOfCodePoints, codePoint)));
   }
 }
+
+static int linearIndexForCodePoint(uint32_t codePoint) {
+  for (int i = 0; i < NumberOfCodePoints; i++) {
+    if (CodePoints[i] == codePoint) {
+      return i;
+    }
+  }
+  return KDFont::k_indexForReplacementCharacterCodePoint;
+}
+
+static void assert_index_matches_linear_scan(uint32_t codePoint) {
+  quiz_assert(testFont.indexForCodePoint(codePoint) ==
+              linearIndexForCodePoint(codePoint));
+}
+
+QUIZ_CASE(kandinsky_font_index_for_code_point_lookups) {
+  /* Code points below k_numberOfDirectlyIndexedCodePoints are read from the
+   * direct table, the others are binary searched. Both must find the glyph a
+   * linear scan of the code points finds. */
+  bool hasDirectCodePoint = false;
+  bool hasSearchedCodePoint = false;
+  for (int i = 0; i < NumberOfCodePoints; i++) {
+    uint32_t codePoint = CodePoints[i];
+    hasDirectCodePoint |= codePoint < k_numberOfDirectlyIndexedCodePoints;
+    hasSearchedCodePoint |= codePoint >= k_numberOfDirectlyIndexedCodePoints;
+    // The edges of each series of consecutive code points
+    assert_index_matches_linear_scan(codePoint);
+    assert_index_matches_linear_scan(codePoint - 1);
+    assert_index_matches_linear_scan(codePoint + 1);
+  }
+  quiz_assert(hasDirectCodePoint && hasSearchedCodePoint);
+  for (uint32_t codePoint = 0; codePoint < 0x3000; codePoint++) {
+    assert_index_matches_linear_scan(codePoint);
+  }
+  // Past the last code point
+  assert_index_matches_linear_scan(0xFFFF);
+  assert_index_matches_linear_scan(0x10FFFF);
+}
@@ -0,0 +1,78 @@
+#include <assert.h>
+#include <kandinsky/glyph_cache.h>
+#include <quiz.h>
+
+static bool glyphIsCorrectlyColorized(const KDColor* pixels, KDFont::Size font,
+                                      CodePoint codePoint, KDColor glyphColor,
+                                      KDColor backgroundColor) {
+  const KDFont* kdFont = KDFont::Font(font);
+  KDFont::GlyphBuffer glyphBuffer;
+  kdFont->setGlyphGrayscalesForCodePoint(codePoint, &glyphBuffer);
+  KDFont::RenderPalette palette =
+      kdFont->renderPalette(glyphColor, backgroundColor);
+  kdFont->colorizeGlyphBuffer(&palette, &glyphBuffer);
+  KDSize glyphSize = KDFont::GlyphSize(font);
+  for (int i = 0; i < glyphSize.width() * glyphSize.height(); i++) {
+    if (pixels[i] != glyphBuffer.colorBuffer()[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static const KDColor* colorizedGlyph(KDGlyphCache* cache, KDFont::Size font,
+                                     CodePoint codePoint, KDColor glyphColor,
+                                     KDColor backgroundColor) {
+  return cache->colorizedGlyph(
+      font, KDFont::Font(font)->indexForCodePoint(codePoint), glyphColor,
+      backgroundColor);
+}
+
+QUIZ_CASE(kandinsky_glyph_cache) {
+  OMG::GlobalBox<KDGlyphCache> cache;
+  cache.init();
+  constexpr KDFont::Size small = KDFont::Size::Small;
+  constexpr KDFont::Size large = KDFont::Size::Large;
+
+  // Glyphs are colorized as if they were not cached
+  const KDColor* pixels =
+      colorizedGlyph(cache, large, 'a', KDColorBlack, KDColorWhite);
+  quiz_assert(glyphIsCorrectlyColorized(pixels, large, 'a', KDColorBlack,
+                                        KDColorWhite));
+  quiz_assert(cache->numberOfHits() == 0 && cache->numberOfMisses() == 1);
+  pixels = colorizedGlyph(cache, large, 'a', KDColorBlack, KDColorWhite);
+  quiz_assert(glyphIsCorrectlyColorized(pixels, large, 'a', KDColorBlack,
+                                        KDColorWhite));
+  quiz_assert(cache->numberOfHits() == 1 && cache->numberOfMisses() == 1);
+
+  // The font and the colors are part of the key
+  pixels = colorizedGlyph(cache, small, 'a', KDColorBlack, KDColorWhite);
+  quiz_assert(glyphIsCorrectlyColorized(pixels, small, 'a', KDColorBlack,
+                                        KDColorWhite));
+  pixels = colorizedGlyph(cache, large, 'a', KDColorRed, KDColorWhite);
+  quiz_assert(
+      glyphIsCorrectlyColorized(pixels, large, 'a', KDColorRed, KDColorWhite));
+  pixels = colorizedGlyph(cache, large, 'a', KDColorBlack, KDColorYellow);
+  quiz_assert(glyphIsCorrectlyColorized(pixels, large, 'a', KDColorBlack,
+                                        KDColorYellow));
+  quiz_assert(cache->numberOfHits() == 1 && cache->numberOfMisses() == 4);
+
+  // The least recently used glyph is evicted
+  cache->clear();
+  for (int i = 0; i < KDGlyphCache::k_numberOfGlyphs; i++) {
+    colorizedGlyph(cache, large, 'A' + i, KDColorBlack, KDColorWhite);
+  }
+  colorizedGlyph(cache, large, 'A', KDColorBlack, KDColorWhite);
+  quiz_assert(cache->numberOfHits() == 1);
+  // 'B' is the least recently used glyph
+  colorizedGlyph(cache, large, '0', KDColorBlack, KDColorWhite);
+  colorizedGlyph(cache, large, 'A', KDColorBlack, KDColorWhite);
+  quiz_assert(cache->numberOfHits() == 2);
+  pixels = colorizedGlyph(cache, large, 'B', KDColorBlack, KDColorWhite);
+  quiz_assert(cache->numberOfHits() == 2);
+  quiz_assert(glyphIsCorrectlyColorized(pixels, large, 'B', KDColorBlack,
+                                        KDColorWhite));
+  quiz_assert(cache->numberOfMisses() == KDGlyphCache::k_numberOfGlyphs + 2);
+
+  cache.deinit();
+}
@@ -0,0 +1,14 @@
+#ifndef OMG_THREAD_LOCAL_H
+#define OMG_THREAD_LOCAL_H
+
+/* Globals mutated by code that Ion::Workers can run on several threads are
+ * declared OMG_THREAD_LOCAL, so that each worker thread has its own copy.
+ * Builds without worker threads keep plain globals. */
+
+#if ION_WORKER_THREADS
+#define OMG_THREAD_LOCAL thread_local
+#else
+#define OMG_THREAD_LOCAL
+#endif
+
+#endif
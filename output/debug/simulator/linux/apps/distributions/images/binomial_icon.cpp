@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "binomial_icon.h"
+
+// Compressed 665 pixels into 150 bytes (7.52% compression ratio)/
+const uint8_t compressedPixelData[150] = {0x1f, 0xff, 0x01, 0x00, 0x0e, 0x3f, 0xc0, 0xfd, 0xff, 0x01, 0x00, 0x2c, 0x26, 0xc0, 0xfd, 0x04, 0x00, 0x0f, 0x46, 0x00, 0x69, 0x2e, 0xc0, 0xfd, 0x04, 0x00, 0x0f, 0x46, 0x00, 0xa7, 0x0e, 0x42, 0x00, 0x0e, 0x4a, 0x00, 0x0f, 0x46, 0x00, 0x97, 0x0e, 0x42, 0x00, 0x0e, 0x4a, 0x00, 0x0f, 0x46, 0x00, 0xdd, 0x2f, 0xc0, 0xfd, 0x04, 0x00, 0x17, 0x0f, 0x46, 0x00, 0x8f, 0x2f, 0xc0, 0xfd, 0x04, 0x00, 0x1f, 0x0f, 0x42, 0x00, 0x2f, 0x0a, 0x4a, 0x00, 0x2f, 0xc0, 0xfd, 0x04, 0x00, 0x2f, 0x1c, 0x00, 0x01, 0x00, 0x0e, 0x12, 0x00, 0x0d, 0x21, 0x00, 0x00, 0x02, 0x00, 0x0f, 0x23, 0x00, 0x2b, 0x15, 0xff, 0x02, 0x00, 0x0f, 0x23, 0x00, 0x4a, 0x19, 0xff, 0x02, 0x00, 0x0f, 0x23, 0x00, 0x46, 0x1d, 0xff, 0x02, 0x00, 0x0f, 0x23, 0x00, 0x65, 0x1f, 0xff, 0x02, 0x00, 0x02, 0x0f, 0x23, 0x00, 0x3e, 0x0e, 0x21, 0x00, 0x0b, 0x25, 0x00, 0x1f, 0xff, 0x02, 0x00, 0x0a, 0x0f, 0x21, 0x00, 0x0d, 0x50, 0x00, 0xff, 0x00, 0xff, 0x00, 
+};
+
+constexpr Escher::Image image = Escher::Image(35, 19, compressedPixelData, 150, true);
+
+const Escher::Image * const ImageStore::BinomialIcon = &image;
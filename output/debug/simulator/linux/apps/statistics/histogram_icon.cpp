@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "histogram_icon.h"
+
+// Compressed 496 pixels into 103 bytes (6.92% compression ratio)/
+const uint8_t compressedPixelData[103] = {0x1f, 0xff, 0x01, 0x00, 0x06, 0x24, 0x80, 0xfd, 0x02, 0x00, 0x0f, 0x24, 0x00, 0x07, 0x0f, 0x3e, 0x00, 0xb5, 0x08, 0x32, 0x00, 0x0e, 0x3e, 0x00, 0x0e, 0x56, 0x00, 0x0f, 0x3e, 0x00, 0x8f, 0x0e, 0x56, 0x00, 0x0f, 0x3e, 0x00, 0x33, 0x0e, 0x32, 0x00, 0x0f, 0x3e, 0x00, 0xff, 0x4e, 0x2f, 0x80, 0xfd, 0x02, 0x00, 0x29, 0x18, 0x00, 0x01, 0x00, 0x01, 0xf4, 0x01, 0x09, 0x12, 0x00, 0x0f, 0x1f, 0x00, 0x51, 0x02, 0x19, 0x00, 0x08, 0x1f, 0x00, 0x09, 0x2b, 0x00, 0x0f, 0x1f, 0x00, 0x37, 0x0e, 0x2b, 0x00, 0x0f, 0x1f, 0x00, 0x07, 0x0e, 0x19, 0x00, 0x0f, 0x1f, 0x00, 0x94, 0x0f, 0xc5, 0x04, 0x07, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 
+};
+
+constexpr Escher::Image image = Escher::Image(31, 16, compressedPixelData, 103, true);
+
+const Escher::Image * const ImageStore::HistogramIcon = &image;
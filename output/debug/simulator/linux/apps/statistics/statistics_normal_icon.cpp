@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "statistics_normal_icon.h"
+
+// Compressed 527 pixels into 347 bytes (21.95% compression ratio)/
+const uint8_t compressedPixelData[347] = {0x1f, 0xff, 0x01, 0x00, 0x20, 0x8f, 0x58, 0xff, 0xe8, 0xfd, 0xe8, 0xfd, 0x58, 0xff, 0x01, 0x00, 0x23, 0x8f, 0xe8, 0xfd, 0xa6, 0xfd, 0xa6, 0xfd, 0xe8, 0xfd, 0x3e, 0x00, 0x29, 0x4f, 0xc8, 0xfd, 0x6e, 0xfe, 0x3e, 0x00, 0x21, 0x9f, 0xd3, 0xfe, 0xc7, 0xfd, 0xa6, 0xfd, 0x4d, 0xfe, 0x9a, 0xec, 0x00, 0x1c, 0xbf, 0x37, 0xff, 0xf4, 0xfe, 0x0a, 0xfe, 0x0a, 0xfe, 0xf4, 0xfe, 0xde, 0xae, 0x00, 0x20, 0x5f, 0xa6, 0xfd, 0x6f, 0xfe, 0x79, 0xac, 0x00, 0x1e, 0x22, 0x37, 0xff, 0x3c, 0x00, 0x2f, 0xe9, 0xfd, 0xac, 0x00, 0x1b, 0xaf, 0x16, 0xff, 0xd2, 0xfe, 0xe8, 0xfd, 0x4d, 0xfe, 0xd2, 0xfe, 0xa6, 0x01, 0x1b, 0x04, 0xac, 0x00, 0x3f, 0xb1, 0xfe, 0x9b, 0x06, 0x02, 0x1c, 0x4f, 0xde, 0xff, 0xf4, 0xfe, 0xac, 0x00, 0x1d, 0x04, 0x06, 0x02, 0x7f, 0x90, 0xfe, 0xc8, 0xfd, 0x8f, 0xfe, 0xf3, 0xac, 0x00, 0x24, 0x3f, 0xf3, 0xfe, 0xdd, 0x56, 0x01, 0x1c, 0xbf, 0xbc, 0xff, 0xd2, 0xfe, 0xc8, 0xfd, 0xc7, 0xfd, 0xc7, 0xfd, 0x57, 0xf2, 0x02, 0x1c, 0x9f, 0xc7, 0xfd, 0x2b, 0xfe, 0xe8, 0xfd, 0xd2, 0xfe, 0xbc, 0xca, 0x01, 0x1e, 0x1f, 0xc7, 0xf2, 0x02, 0x2a, 0x1f, 0xc7, 0x5a, 0x01, 0x1c, 0x0a, 0x01, 0x00, 0x1f, 0x57, 0xac, 0x03, 0x2a, 0x1f, 0x00, 0x01, 0x00, 0x06, 0x5f, 0x4e, 0xe9, 0xea, 0x4e, 0x00, 0x01, 0x00, 0x07, 0x4f, 0xe7, 0xff, 0xff, 0xe6, 0x1f, 0x00, 0x08, 0x5f, 0xe8, 0xff, 0xff, 0xee, 0xac, 0x1f, 0x00, 0x07, 0x5f, 0x7b, 0xf8, 0xfe, 0xbb, 0x35, 0x76, 0x00, 0x04, 0x6f, 0x58, 0x6d, 0xd5, 0xd6, 0x6e, 0x10, 0x76, 0x00, 0x06, 0x3f, 0xfd, 0xa7, 0x40, 0x55, 0x00, 0x04, 0x6f, 0x06, 0x59, 0xfa, 0xff, 0xff, 0xe3, 0x56, 0x00, 0x04, 0x8f, 0x61, 0x84, 0xe7, 0xbb, 0x88, 0xeb, 0xea, 0x4f, 0x56, 0x00, 0x05, 0x2f, 0x91, 0x27, 0x03, 0x01, 0x04, 0x6f, 0x0f, 0x6d, 0xfb, 0xff, 0xff, 0xe1, 0x37, 0x00, 0x04, 0x5f, 0xeb, 0x98, 0xec, 0xa4, 0x78, 0x56, 0x00, 0x04, 0x6f, 0xe9, 0xff, 0xff, 0xfb, 0x77, 0x15, 0xac, 0x00, 0x04, 0x6f, 0x20, 0x86, 0xee, 0xf9, 0xf0, 0x50, 0x79, 0x01, 0x04, 0x5f, 0xf0, 0xcc, 0xe8, 0x86, 0x20, 0x3b, 0x01, 0x05, 0x5f, 0xf3, 0xff, 0xff, 0xef, 0x07, 0x5a, 0x01, 0x07, 0x4f, 0xf6, 0xff, 0xff, 0xe0, 0x98, 0x01, 0x08, 0x1e, 0x50, 0xad, 0x00, 0x03, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+constexpr Escher::Image image = Escher::Image(31, 17, compressedPixelData, 347, true);
+
+const Escher::Image * const ImageStore::StatisticsNormalIcon = &image;
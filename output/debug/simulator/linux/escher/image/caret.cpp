@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "caret.h"
+
+// Compressed 28 pixels into 81 bytes (96.43% compression ratio)/
+const uint8_t compressedPixelData[81] = {0x51, 0x38, 0xc6, 0x3c, 0xe7, 0xff, 0x01, 0x00, 0xf2, 0x0f, 0x3c, 0xe7, 0x38, 0xc6, 0x5d, 0xef, 0x75, 0xad, 0x1c, 0xe7, 0xff, 0xff, 0x1c, 0xe7, 0x75, 0xad, 0x5d, 0xef, 0xff, 0xff, 0x7d, 0xef, 0x96, 0xb5, 0x59, 0xce, 0x96, 0xb5, 0x7d, 0xef, 0x24, 0x00, 0x60, 0x9e, 0xf7, 0xf7, 0xbd, 0x9e, 0xf7, 0x0a, 0x00, 0xf0, 0x0d, 0xa8, 0x46, 0x00, 0x00, 0x00, 0x46, 0xa7, 0x38, 0xe8, 0x54, 0x00, 0x53, 0xe8, 0x39, 0x00, 0x2e, 0xe4, 0x9b, 0xe4, 0x2e, 0x00, 0x00, 0x00, 0x25, 0xbf, 0x25, 0x00, 0x00, 
+};
+
+constexpr Escher::Image image = Escher::Image(7, 4, compressedPixelData, 81, true);
+
+const Escher::Image * const ImageStore::Caret = &image;
@@ -0,0 +1,46 @@
+#ifndef ION_SIMULATOR_LINUX_IMAGES_H
+#define ION_SIMULATOR_LINUX_IMAGES_H
+
+// This file is auto-generated by incbin.py
+
+extern unsigned char _ion_simulator_background_with_shadow_start;
+extern unsigned char _ion_simulator_background_with_shadow_end;
+extern unsigned char _ion_simulator_horizontal_arrow_start;
+extern unsigned char _ion_simulator_horizontal_arrow_end;
+extern unsigned char _ion_simulator_vertical_arrow_start;
+extern unsigned char _ion_simulator_vertical_arrow_end;
+extern unsigned char _ion_simulator_round_start;
+extern unsigned char _ion_simulator_round_end;
+extern unsigned char _ion_simulator_small_squircle_start;
+extern unsigned char _ion_simulator_small_squircle_end;
+extern unsigned char _ion_simulator_large_squircle_start;
+extern unsigned char _ion_simulator_large_squircle_end;
+extern unsigned char _ion_simulator_background_start;
+extern unsigned char _ion_simulator_background_end;
+extern unsigned char _ion_simulator_background_no_shadow_start;
+extern unsigned char _ion_simulator_background_no_shadow_end;
+
+class ResourceMap {
+public:
+  constexpr ResourceMap(const char * identifier, unsigned char * start, unsigned char * end) : m_identifier(identifier), m_start(start), m_end(end) {}
+  const char * identifier() const { return m_identifier; }
+  unsigned char * start() const { return m_start; }
+  unsigned char * end() const { return m_end; }
+private:
+  const char * m_identifier;
+  unsigned char * m_start;
+  unsigned char * m_end;
+};
+
+constexpr static ResourceMap resources_addresses[] = {
+ResourceMap("background-with-shadow.webp", &_ion_simulator_background_with_shadow_start, &_ion_simulator_background_with_shadow_end),
+ResourceMap("horizontal_arrow.png", &_ion_simulator_horizontal_arrow_start, &_ion_simulator_horizontal_arrow_end),
+ResourceMap("vertical_arrow.png", &_ion_simulator_vertical_arrow_start, &_ion_simulator_vertical_arrow_end),
+ResourceMap("round.png", &_ion_simulator_round_start, &_ion_simulator_round_end),
+ResourceMap("small_squircle.png", &_ion_simulator_small_squircle_start, &_ion_simulator_small_squircle_end),
+ResourceMap("large_squircle.png", &_ion_simulator_large_squircle_start, &_ion_simulator_large_squircle_end),
+ResourceMap("background.jpg", &_ion_simulator_background_start, &_ion_simulator_background_end),
+ResourceMap("background-no-shadow.webp", &_ion_simulator_background_no_shadow_start, &_ion_simulator_background_no_shadow_end),
+};
+
+#endif
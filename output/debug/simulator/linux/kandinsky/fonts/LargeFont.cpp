@@ -0,0 +1,573 @@
+/* This file is auto-generated by the rasterizer */
+
+#include "LargeFont.h"
+#include <kandinsky/font.h>
+
+constexpr static KDCoordinate numberOfCodePoints = 145;
+constexpr static uint16_t glyphDataOffset[numberOfCodePoints + 1] = {
+  0x0000, 0x000b, 0x0020, 0x0034, 0x0077, 0x00bf, 0x0100, 0x0144, 0x0157,
+  0x01a5, 0x01eb, 0x0217, 0x0231, 0x024e, 0x0260, 0x026f, 0x02a5, 0x02e7,
+  0x0301, 0x0341, 0x0382, 0x03bc, 0x03f0, 0x0433, 0x046f, 0x04b2, 0x04f5,
+  0x0507, 0x052f, 0x0560, 0x0575, 0x05a6, 0x05df, 0x062f, 0x0672, 0x06af,
+  0x06eb, 0x0728, 0x074a, 0x076c, 0x07ad, 0x07cb, 0x07e8, 0x0811, 0x0854,
+  0x086a, 0x08a6, 0x08e5, 0x0924, 0x0951, 0x0999, 0x09dc, 0x0a19, 0x0a33,
+  0x0a58, 0x0a9c, 0x0ae1, 0x0b26, 0x0b5d, 0x0b9d, 0x0bb6, 0x0bef, 0x0c09,
+  0x0c34, 0x0c4a, 0x0c6a, 0x0ca0, 0x0cd7, 0x0d0a, 0x0d42, 0x0d78, 0x0da2,
+  0x0de0, 0x0e07, 0x0e23, 0x0e43, 0x0e7b, 0x0e9e, 0x0ec2, 0x0ee9, 0x0f1b,
+  0x0f55, 0x0f8d, 0x0fb2, 0x0fe5, 0x100a, 0x1031, 0x1066, 0x109c, 0x10cc,
+  0x110f, 0x1141, 0x1171, 0x1180, 0x11ad, 0x11ca, 0x11ec, 0x120a, 0x121a,
+  0x125d, 0x1294, 0x12c0, 0x1307, 0x1333, 0x137b, 0x13b2, 0x13fe, 0x141a,
+  0x144f, 0x1484, 0x14a4, 0x14c7, 0x14e9, 0x1500, 0x1514, 0x1526, 0x153e,
+  0x1554, 0x158b, 0x15a5, 0x15e9, 0x162a, 0x1660, 0x16b4, 0x16e6, 0x1728,
+  0x176f, 0x1798, 0x17b5, 0x17eb, 0x1820, 0x1863, 0x1885, 0x18b4, 0x18e6,
+  0x1918, 0x195a, 0x19b6, 0x19df, 0x1a08, 0x1a3a, 0x1a73, 0x1aa9, 0x1ae5,
+  0x1b21, 0x1b64
+};
+
+/* Rasterized  = 26100 bytes (145 glyphs x 180 pixels)
+ * Downsampled = 13050 bytes (1/2 of rasterized)
+ * Compressed  =  7012 bytes (26.87% of rasterized) */
+constexpr static uint8_t glyphData[7012] = {
+  0x1f, 0x00, 0x01, 0x00, 0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x01, 0x00, 0x1f, 0xf0, 0x05, 0x00, 0x14, 0x0b, 0x32, 0x00, 0x09, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0x2f, 0xf0, 0x0f,
+  0x05, 0x00, 0x04, 0x0f, 0x01, 0x00, 0x1d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x01, 0x00, 0xfc, 0x26, 0x01, 0xe0, 0x1e, 0x00, 0x00, 0x05, 0xb0,
+  0x5b, 0x00, 0x00, 0x08, 0x90, 0x89, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf0, 0x00,
+  0x0e, 0x20, 0xe2, 0x00, 0x00, 0x2e, 0x02, 0xe0, 0x00, 0x00, 0x5a, 0x05, 0xb0,
+  0x00, 0x0f, 0xff, 0xff, 0xff, 0x00, 0x00, 0xc4, 0x0c, 0x40, 0x00, 0x00, 0xf0,
+  0x0f, 0x00, 0x00, 0x03, 0xd0, 0x3d, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0x10, 0x08, 0x05, 0x00, 0x14, 0x0f, 0x05,
+  0x00, 0xb0, 0x2b, 0xef, 0xc3, 0x00, 0x00, 0xd5, 0x00, 0x4d, 0x00, 0x00, 0xf1,
+  0x13, 0x00, 0xd0, 0x9d, 0x30, 0x00, 0x00, 0x00, 0x0a, 0xf9, 0x10, 0x00, 0x00,
+  0x00, 0x3b, 0xe2, 0x11, 0x00, 0xf8, 0x01, 0x6c, 0x00, 0x00, 0x20, 0x00, 0x0f,
+  0x00, 0x01, 0xe8, 0x10, 0x6d, 0x00, 0x00, 0x19, 0xef, 0xd4, 0x3c, 0x00, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00,
+  0x20, 0x3e, 0xe3, 0x04, 0x00, 0xf2, 0x1c, 0x3e, 0x00, 0x02, 0xe4, 0xd3, 0x3d,
+  0x00, 0x1d, 0x50, 0x3d, 0xd3, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x0b, 0x80, 0x00,
+  0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x08, 0xb0, 0x00, 0x00, 0x00, 0x7c, 0x00,
+  0x3d, 0xd3, 0x05, 0xd1, 0x00, 0xd3, 0x3d, 0x4e, 0x20, 0x00, 0xe3, 0x31, 0x00,
+  0x0b, 0x46, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00,
+  0xfb, 0x27, 0x1b, 0xfc, 0x20, 0x00, 0x00, 0xc7, 0x05, 0xd0, 0x00, 0x00, 0xf0,
+  0x00, 0xf0, 0x00, 0x00, 0xc5, 0x09, 0xb0, 0x00, 0x00, 0x6d, 0xbe, 0x20, 0x00,
+  0x00, 0x5f, 0xe1, 0x00, 0x00, 0x05, 0xd5, 0xf8, 0x00, 0xd7, 0x0e, 0x20, 0x4f,
+  0x89, 0xd0, 0x0f, 0x00, 0x04, 0xff, 0x30, 0x09, 0x70, 0x04, 0xff, 0xc0, 0x00,
+  0x9e, 0xfb, 0x31, 0x90, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17,
+  0x00, 0x01, 0x00, 0x1f, 0x0f, 0x05, 0x00, 0x05, 0x0f, 0x01, 0x00, 0x1d, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x01, 0x00, 0xf0, 0x13, 0x09, 0x00,
+  0x00, 0x00, 0x01, 0xc5, 0x00, 0x00, 0x00, 0x1c, 0x30, 0x00, 0x00, 0x00, 0xb4,
+  0x00, 0x00, 0x00, 0x05, 0xa0, 0x00, 0x00, 0x00, 0x0b, 0x40, 0x00, 0x00, 0x00,
+  0x0e, 0x10, 0x00, 0x00, 0x00, 0x0f, 0x26, 0x00, 0x20, 0x0d, 0x20, 0x2b, 0x00,
+  0x60, 0x50, 0x00, 0x00, 0x00, 0x02, 0xc0, 0x10, 0x00, 0x20, 0x97, 0x00, 0x24,
+  0x00, 0x10, 0x50, 0x06, 0x00, 0xc0, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0x10, 0x09, 0x05, 0x00,
+  0x20, 0x06, 0xc1, 0x06, 0x00, 0x70, 0x4c, 0x10, 0x00, 0x00, 0x00, 0x04, 0xb0,
+  0x0b, 0x00, 0x10, 0xa5, 0x05, 0x00, 0x10, 0x4b, 0x05, 0x00, 0x10, 0x1e, 0x05,
+  0x00, 0x10, 0x0f, 0x05, 0x00, 0x10, 0x2d, 0x05, 0x00, 0x10, 0x59, 0x05, 0x00,
+  0xa0, 0xc3, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x5b, 0x3c, 0x00,
+  0x13, 0xb0, 0x46, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01,
+  0x00, 0x07, 0x14, 0x0f, 0x05, 0x00, 0xff, 0x09, 0xba, 0x3f, 0x39, 0xa0, 0x00,
+  0x07, 0xef, 0xe6, 0x00, 0x00, 0x01, 0xdd, 0xc1, 0x00, 0x00, 0x1d, 0x80, 0x8d,
+  0x10, 0x00, 0x98, 0x00, 0x08, 0x90, 0x3a, 0x00, 0x06, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x07, 0x19, 0x0f, 0x05, 0x00, 0x4c, 0xff,
+  0xff, 0xff, 0xf0, 0x14, 0x00, 0x0f, 0x01, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x2f, 0x10, 0x5e, 0x05, 0x00, 0xf0, 0x03,
+  0xd7, 0x00, 0x00, 0x00, 0x0b, 0xb0, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x15, 0x3f, 0xff, 0xff,
+  0xff, 0x2c, 0x00, 0x16, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01,
+  0x00, 0x2f, 0x1d, 0xff, 0x12, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+  0x00, 0x01, 0x00, 0x10, 0x3c, 0x05, 0x00, 0x10, 0x96, 0x05, 0x00, 0xf0, 0x00,
+  0xe0, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x0c, 0x30, 0x00, 0x00,
+  0x00, 0x3d, 0x13, 0x00, 0x10, 0x97, 0x05, 0x00, 0x10, 0xe1, 0x18, 0x00, 0x10,
+  0xa0, 0x18, 0x00, 0x1f, 0x40, 0x18, 0x00, 0x08, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1b, 0x00, 0x01, 0x00, 0xf2, 0x22, 0x2b, 0xff, 0xb2, 0x00, 0x00, 0xe8,
+  0x00, 0x7e, 0x10, 0x07, 0xb0, 0x00, 0x09, 0x80, 0x0c, 0x50, 0x00, 0x03, 0xd0,
+  0x0e, 0x10, 0x75, 0x01, 0xf0, 0x0f, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0x10, 0x79,
+  0x01, 0xf0, 0x0c, 0x30, 0x00, 0x03, 0xd0, 0x07, 0x80, 0x00, 0x08, 0x90, 0x01,
+  0xd5, 0x00, 0x5e, 0x10, 0x32, 0x00, 0x0a, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0x21, 0x0f, 0xff, 0x06, 0x00, 0x0f, 0x05,
+  0x00, 0x18, 0x4b, 0xff, 0xff, 0xff, 0xf0, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xd0, 0x4c, 0xfe, 0x80, 0x00, 0x04, 0xd4,
+  0x01, 0x99, 0x00, 0x00, 0x10, 0x00, 0x1e, 0x11, 0x00, 0x10, 0x0e, 0x05, 0x00,
+  0x10, 0x4b, 0x05, 0x00, 0xf0, 0x04, 0xc4, 0x00, 0x00, 0x00, 0x08, 0xa0, 0x00,
+  0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x00, 0x7c, 0x17,
+  0x00, 0x4b, 0xff, 0xff, 0xff, 0xf0, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1b, 0x00, 0x01, 0x00, 0x80, 0x3c, 0xfe, 0x90, 0x00, 0x03, 0xd5, 0x02,
+  0xca, 0x0c, 0x00, 0x10, 0x1e, 0x05, 0x00, 0xf0, 0x01, 0x2e, 0x00, 0x00, 0x00,
+  0x26, 0xe5, 0x00, 0x00, 0x07, 0xff, 0x70, 0x00, 0x00, 0x00, 0x03, 0xbc, 0x14,
+  0x00, 0xfc, 0x01, 0x0d, 0x60, 0x00, 0x00, 0x00, 0x0b, 0x60, 0x0b, 0xa2, 0x01,
+  0x7f, 0x10, 0x02, 0x9e, 0xfe, 0xc4, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1c, 0x00, 0x01, 0x00, 0x60, 0x05, 0xf0, 0x00, 0x00, 0x00, 0x2d, 0x05,
+  0x00, 0xf0, 0x0c, 0xc5, 0xf0, 0x00, 0x00, 0x07, 0xa0, 0xf0, 0x00, 0x00, 0x3d,
+  0x10, 0xf0, 0x00, 0x00, 0xd3, 0x00, 0xf0, 0x00, 0x0a, 0x60, 0x00, 0xf0, 0x00,
+  0x0f, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x29, 0xf0, 0x00, 0x05, 0x00, 0x08, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0x88, 0xff,
+  0xff, 0xff, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x05, 0x00, 0xe4, 0xff, 0xfe, 0xa2,
+  0x00, 0x00, 0x00, 0x01, 0x5d, 0x30, 0x00, 0x00, 0x00, 0x04, 0xc0, 0x17, 0x00,
+  0xbc, 0x02, 0xe0, 0x00, 0x00, 0x00, 0x4d, 0x70, 0x00, 0xff, 0xfe, 0xc5, 0x45,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xfc, 0x26,
+  0x04, 0xbf, 0xff, 0xf0, 0x00, 0x6c, 0x30, 0x00, 0x00, 0x02, 0xc0, 0x00, 0x00,
+  0x00, 0x09, 0x50, 0x00, 0x00, 0x00, 0x0d, 0x5b, 0xfe, 0xc6, 0x00, 0x0f, 0xf6,
+  0x00, 0x3c, 0x80, 0x0f, 0x50, 0x00, 0x02, 0xd0, 0x0d, 0x20, 0x00, 0x00, 0xf0,
+  0x08, 0x80, 0x00, 0x04, 0xe0, 0x00, 0xd7, 0x10, 0x3e, 0x60, 0x00, 0x19, 0xef,
+  0xc5, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00,
+  0xe0, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00,
+  0x00, 0x3b, 0x12, 0x00, 0xf0, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x07, 0x70, 0x00,
+  0x00, 0x00, 0x0d, 0x10, 0x00, 0x00, 0x00, 0x5a, 0x13, 0x00, 0x14, 0x95, 0x18,
+  0x00, 0x20, 0x00, 0xe1, 0x05, 0x00, 0x2c, 0xf0, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xfc, 0x26, 0x08, 0xee, 0xa1,
+  0x00, 0x00, 0x9a, 0x10, 0x8a, 0x00, 0x00, 0xe1, 0x00, 0x1e, 0x00, 0x00, 0xe3,
+  0x00, 0x1f, 0x00, 0x00, 0x6e, 0x50, 0x79, 0x00, 0x00, 0x0b, 0xee, 0xf1, 0x00,
+  0x02, 0xc3, 0x04, 0xae, 0x20, 0x0d, 0x20, 0x00, 0x04, 0xd0, 0x0f, 0x10, 0x00,
+  0x01, 0xf0, 0x08, 0xc4, 0x00, 0x3b, 0x80, 0x00, 0x6c, 0xff, 0xc5, 0x45, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xfc, 0x26, 0x3b,
+  0xff, 0xb3, 0x00, 0x03, 0xe4, 0x02, 0x7e, 0x20, 0x0c, 0x40, 0x00, 0x08, 0x90,
+  0x0f, 0x00, 0x00, 0x02, 0xd0, 0x0c, 0x30, 0x00, 0x01, 0xf0, 0x03, 0xc3, 0x01,
+  0x5e, 0xf0, 0x00, 0x2b, 0xff, 0xc5, 0xf0, 0x00, 0x00, 0x00, 0x01, 0xd0, 0x00,
+  0x00, 0x00, 0x05, 0xb0, 0x09, 0xa4, 0x00, 0x4e, 0x40, 0x00, 0x6b, 0xff, 0xc5,
+  0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0c,
+  0x3f, 0xff, 0x00, 0x00, 0x23, 0x00, 0x1f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x01, 0x00, 0x0c, 0x2f, 0xff, 0x10, 0x1e, 0x00, 0x09, 0x10, 0x18,
+  0x05, 0x00, 0xf0, 0x08, 0x8d, 0x00, 0x00, 0x00, 0x04, 0xf3, 0x00, 0x00, 0x00,
+  0x1f, 0x60, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x00, 0x01, 0x00, 0x03, 0xf0, 0x04, 0x1a, 0x00, 0x00, 0x00, 0x05,
+  0xe8, 0x00, 0x00, 0x01, 0xad, 0x30, 0x00, 0x00, 0x5e, 0x80, 0x00, 0x00, 0x00,
+  0xf5, 0x17, 0x00, 0x33, 0x5e, 0x70, 0x00, 0x14, 0x00, 0x34, 0x00, 0x05, 0xe9,
+  0x28, 0x00, 0x0e, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x01, 0x00, 0x10, 0x3e, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x0f, 0x01, 0x00, 0x09,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x01, 0x10, 0xa1,
+  0x05, 0x00, 0xd0, 0x8e, 0x50, 0x00, 0x00, 0x00, 0x03, 0xda, 0x10, 0x00, 0x00,
+  0x00, 0x09, 0xe5, 0x11, 0x00, 0x63, 0x6f, 0x00, 0x00, 0x00, 0x07, 0xe5, 0x14,
+  0x00, 0x24, 0x9e, 0x50, 0x28, 0x00, 0x1e, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0x80, 0x5c, 0xfe, 0x91, 0x00, 0x01,
+  0xe6, 0x01, 0xaa, 0x0c, 0x00, 0x10, 0x1f, 0x05, 0x00, 0xf0, 0x00, 0x4d, 0x00,
+  0x00, 0x00, 0x01, 0xd4, 0x00, 0x00, 0x00, 0x0d, 0x70, 0x00, 0x00, 0x00, 0x9b,
+  0x13, 0x00, 0x10, 0xf2, 0x05, 0x00, 0x15, 0x50, 0x33, 0x00, 0x2c, 0xf0, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xf0,
+  0x3b, 0x08, 0xef, 0xc4, 0x00, 0x00, 0xbd, 0x30, 0x4e, 0x30, 0x04, 0xf1, 0x00,
+  0x08, 0xa0, 0x09, 0x90, 0x00, 0x03, 0xe0, 0x0d, 0x40, 0x00, 0x00, 0xf0, 0x0f,
+  0x10, 0x3b, 0xef, 0xf0, 0x0f, 0x00, 0xe5, 0x10, 0xf0, 0x0f, 0x00, 0xf0, 0x00,
+  0xf0, 0x0d, 0x30, 0xb4, 0x1a, 0xf0, 0x09, 0x90, 0x3d, 0xe6, 0xf0, 0x03, 0xf3,
+  0x00, 0x00, 0xf0, 0x00, 0x9e, 0x50, 0x00, 0x00, 0x00, 0x06, 0xdf, 0xff, 0xf0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x01,
+  0x00, 0xfb, 0x26, 0xcb, 0x00, 0x00, 0x00, 0x01, 0xdd, 0x10, 0x00, 0x00, 0x05,
+  0x99, 0x50, 0x00, 0x00, 0x0a, 0x45, 0xa0, 0x00, 0x00, 0x0e, 0x00, 0xe0, 0x00,
+  0x00, 0x4b, 0x00, 0xb4, 0x00, 0x00, 0x9f, 0xff, 0xf9, 0x00, 0x00, 0xe3, 0x00,
+  0x1e, 0x00, 0x03, 0xd0, 0x00, 0x0c, 0x30, 0x08, 0x80, 0x00, 0x07, 0x80, 0x0d,
+  0x20, 0x00, 0x02, 0xd0, 0x44, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a,
+  0x00, 0x01, 0x00, 0xe0, 0x0f, 0xff, 0xfe, 0x91, 0x00, 0x0f, 0x00, 0x01, 0xaa,
+  0x00, 0x0f, 0x00, 0x00, 0x1e, 0x05, 0x00, 0xb0, 0x2e, 0x00, 0x0f, 0x00, 0x03,
+  0xc8, 0x00, 0x0f, 0xff, 0xff, 0xf4, 0x0f, 0x00, 0x74, 0x5d, 0x50, 0x0f, 0x00,
+  0x00, 0x02, 0xe0, 0x05, 0x00, 0x7b, 0x4c, 0x80, 0x0f, 0xff, 0xfe, 0xc5, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xf4,
+  0x0b, 0x05, 0xcf, 0xfc, 0x50, 0x00, 0x8d, 0x50, 0x17, 0x80, 0x04, 0xe1, 0x00,
+  0x00, 0x00, 0x0a, 0x60, 0x00, 0x00, 0x00, 0x0e, 0x10, 0x00, 0x00, 0x00, 0x0f,
+  0x00, 0x0a, 0x00, 0x01, 0x14, 0x00, 0x20, 0x04, 0xd1, 0x10, 0x00, 0x9b, 0x9d,
+  0x40, 0x08, 0x90, 0x00, 0x06, 0xcf, 0xea, 0x20, 0x45, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf0, 0x14, 0x0f, 0xff, 0xfd, 0x70,
+  0x00, 0x0f, 0x00, 0x02, 0xac, 0x00, 0x0f, 0x00, 0x00, 0x0c, 0x60, 0x0f, 0x00,
+  0x00, 0x05, 0xc0, 0x0f, 0x00, 0x00, 0x01, 0xe0, 0x0f, 0x00, 0x00, 0x00, 0xf0,
+  0x0f, 0x00, 0x00, 0x02, 0xe0, 0x14, 0x00, 0x13, 0xb0, 0x1e, 0x00, 0x22, 0x02,
+  0xab, 0x32, 0x00, 0x0b, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a,
+  0x00, 0x01, 0x00, 0x61, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0x0a, 0x00, 0x0a,
+  0x05, 0x00, 0x00, 0x19, 0x00, 0x0d, 0x14, 0x00, 0x05, 0x32, 0x00, 0x0b, 0x46,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x61, 0x0f,
+  0xff, 0xff, 0xff, 0xf0, 0x0f, 0x0a, 0x00, 0x0a, 0x05, 0x00, 0x00, 0x19, 0x00,
+  0x0d, 0x14, 0x00, 0x05, 0x05, 0x00, 0x0b, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xf2, 0x0b, 0x07, 0xdf, 0xfc, 0x50, 0x00,
+  0xbc, 0x30, 0x28, 0x70, 0x05, 0xd0, 0x00, 0x00, 0x00, 0x0b, 0x50, 0x00, 0x00,
+  0x00, 0x0e, 0x10, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0a, 0x00, 0x20, 0xff, 0xf0,
+  0x14, 0x00, 0xfb, 0x01, 0xf0, 0x06, 0xd0, 0x00, 0x00, 0xf0, 0x00, 0xbc, 0x30,
+  0x17, 0xc0, 0x00, 0x08, 0xdf, 0xfb, 0x10, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x5f, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x05,
+  0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xf0, 0x1e, 0x00, 0x06, 0x0b, 0x46, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0x9f, 0xff, 0xff,
+  0xff, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x05, 0x00, 0x16, 0x02, 0x32, 0x00,
+  0x09, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00,
+  0x40, 0xff, 0xff, 0xff, 0xf0, 0x08, 0x00, 0x0f, 0x05, 0x00, 0x0a, 0xfc, 0x01,
+  0x01, 0xf0, 0x01, 0x20, 0x00, 0x06, 0xe0, 0x05, 0xe4, 0x01, 0x7f, 0x70, 0x00,
+  0x5c, 0xfe, 0xb4, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x01, 0x00, 0xf0, 0x18, 0x0f, 0x00, 0x00, 0x7c, 0x00, 0x0f, 0x00, 0x05, 0xe1,
+  0x00, 0x0f, 0x00, 0x4e, 0x20, 0x00, 0x0f, 0x02, 0xe4, 0x00, 0x00, 0x0f, 0x1e,
+  0xf4, 0x00, 0x00, 0x0f, 0xd7, 0x7d, 0x00, 0x00, 0x0f, 0x90, 0x0c, 0x70, 0x00,
+  0x0f, 0x00, 0x03, 0xf2, 0x28, 0x00, 0x10, 0x9b, 0x05, 0x00, 0x40, 0x0e, 0x50,
+  0x0f, 0x00, 0x2e, 0x00, 0x0a, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x01, 0x00, 0x1f, 0x0f, 0x05, 0x00, 0x1f, 0x4b, 0xff, 0xff, 0xff,
+  0xf0, 0x46, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00,
+  0xf8, 0x1c, 0x0f, 0xa0, 0x00, 0x0a, 0xf0, 0x0f, 0xc1, 0x00, 0x1d, 0xf0, 0x0f,
+  0x76, 0x00, 0x68, 0xf0, 0x0f, 0x2b, 0x00, 0xc2, 0xf0, 0x0f, 0x0c, 0x11, 0xd0,
+  0xf0, 0x0f, 0x07, 0x77, 0x70, 0xf0, 0x0f, 0x01, 0xdd, 0x20, 0xf0, 0x0f, 0x00,
+  0xcc, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0x05, 0x00, 0x0b, 0x46, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x70, 0x0f, 0x90, 0x00, 0x00,
+  0xf0, 0x0f, 0xd3, 0x05, 0x00, 0x10, 0x4d, 0x05, 0x00, 0xc0, 0x0b, 0x70, 0x00,
+  0xf0, 0x0f, 0x02, 0xe1, 0x00, 0xf0, 0x0f, 0x00, 0x8a, 0x05, 0x00, 0xc0, 0x0e,
+  0x40, 0xf0, 0x0f, 0x00, 0x05, 0xd0, 0xf0, 0x0f, 0x00, 0x00, 0xc8, 0x05, 0x00,
+  0x10, 0x3f, 0x05, 0x00, 0x2b, 0x09, 0xf0, 0x46, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xf4, 0x09, 0x3c, 0xff, 0xc3, 0x00, 0x02,
+  0xe5, 0x00, 0x5e, 0x20, 0x09, 0x70, 0x00, 0x07, 0x90, 0x0d, 0x20, 0x00, 0x02,
+  0xd0, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x05, 0x00, 0xfc, 0x06, 0x01, 0xf0, 0x0d,
+  0x20, 0x00, 0x03, 0xd0, 0x09, 0x80, 0x00, 0x08, 0x90, 0x01, 0xe5, 0x11, 0x5e,
+  0x20, 0x00, 0x2b, 0xff, 0xb2, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x01, 0x00, 0xf3, 0x00, 0x0f, 0xff, 0xff, 0xd8, 0x00, 0x0f, 0x00,
+  0x00, 0x18, 0x90, 0x0f, 0x00, 0x00, 0x00, 0xe0, 0x05, 0x00, 0x00, 0x0f, 0x00,
+  0x40, 0xff, 0xfe, 0xd7, 0x00, 0x0f, 0x00, 0x0e, 0x05, 0x00, 0x0e, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xf0, 0x0e, 0x1a,
+  0xef, 0xb2, 0x00, 0x00, 0xd8, 0x11, 0x8e, 0x10, 0x07, 0xa0, 0x00, 0x0a, 0x80,
+  0x0c, 0x40, 0x00, 0x04, 0xc0, 0x0e, 0x10, 0x00, 0x01, 0xf0, 0x0f, 0x00, 0x00,
+  0x00, 0xf0, 0x0a, 0x00, 0x11, 0xe0, 0x14, 0x00, 0x00, 0x1e, 0x00, 0x10, 0x70,
+  0x28, 0x00, 0x03, 0x32, 0x00, 0xf0, 0x04, 0x00, 0x0c, 0x40, 0x00, 0x00, 0x00,
+  0x05, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x01, 0x00, 0xf0, 0x00, 0x0f, 0xff, 0xff, 0xd7, 0x00, 0x0f, 0x00,
+  0x00, 0x3b, 0x90, 0x0f, 0x00, 0x00, 0x01, 0xf0, 0x05, 0x00, 0xf0, 0x05, 0xe0,
+  0x0f, 0x00, 0x00, 0x2b, 0xa0, 0x0f, 0xff, 0xff, 0xe9, 0x10, 0x0f, 0x00, 0x0b,
+  0x70, 0x00, 0x0f, 0x00, 0x02, 0xe1, 0x23, 0x00, 0x10, 0x79, 0x05, 0x00, 0x7b,
+  0x0d, 0x20, 0x0f, 0x00, 0x00, 0x04, 0xb0, 0x46, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xb0, 0x1a, 0xef, 0xc4, 0x00, 0x00, 0xb9,
+  0x10, 0x3c, 0x30, 0x00, 0xf0, 0x0f, 0x00, 0x10, 0xc6, 0x05, 0x00, 0x20, 0x2d,
+  0xb4, 0x06, 0x00, 0x20, 0x5c, 0xd6, 0x06, 0x00, 0x80, 0x3c, 0x70, 0x00, 0x00,
+  0x00, 0x01, 0xe0, 0x02, 0x05, 0x00, 0x9c, 0x07, 0xe6, 0x10, 0x2c, 0x70, 0x00,
+  0x2a, 0xef, 0xd6, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x01, 0x00, 0x9f, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x05,
+  0x00, 0x1c, 0x09, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x01, 0x00, 0x5f, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x05, 0x00, 0x10, 0xeb, 0x0d,
+  0x40, 0x00, 0x04, 0xd0, 0x06, 0xe5, 0x00, 0x3d, 0x60, 0x00, 0x4c, 0xee, 0xc4,
+  0x45, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00,
+  0xfc, 0x27, 0x0d, 0x20, 0x00, 0x02, 0xd0, 0x08, 0x70, 0x00, 0x07, 0x80, 0x04,
+  0xb0, 0x00, 0x0c, 0x30, 0x00, 0xe1, 0x00, 0x1e, 0x00, 0x00, 0xa5, 0x00, 0x5a,
+  0x00, 0x00, 0x5a, 0x00, 0xa5, 0x00, 0x00, 0x1e, 0x00, 0xe1, 0x00, 0x00, 0x0c,
+  0x34, 0xc0, 0x00, 0x00, 0x07, 0x88, 0x70, 0x00, 0x00, 0x02, 0xdd, 0x20, 0x00,
+  0x00, 0x00, 0xdd, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a,
+  0x00, 0x01, 0x00, 0xfb, 0x28, 0xc0, 0x00, 0x00, 0x00, 0x0d, 0xb2, 0x00, 0x00,
+  0x00, 0x2c, 0x93, 0x00, 0x00, 0x00, 0x4b, 0x85, 0x00, 0xdd, 0x00, 0x59, 0x77,
+  0x03, 0xdd, 0x30, 0x78, 0x68, 0x08, 0x77, 0x80, 0x87, 0x5a, 0x0d, 0x11, 0xd0,
+  0xa5, 0x4b, 0x2b, 0x00, 0xc2, 0xc4, 0x2d, 0x86, 0x00, 0x68, 0xd3, 0x1f, 0xc1,
+  0x00, 0x1c, 0xf1, 0x0f, 0xa0, 0x00, 0x0a, 0xf0, 0x46, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xfb, 0x28, 0x0a, 0x80, 0x00, 0x08,
+  0xa0, 0x01, 0xe2, 0x00, 0x3e, 0x10, 0x00, 0x6b, 0x00, 0xc6, 0x00, 0x00, 0x0b,
+  0x56, 0xb0, 0x00, 0x00, 0x02, 0xee, 0x20, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00,
+  0x00, 0x05, 0xdd, 0x40, 0x00, 0x00, 0x0d, 0x44, 0xd0, 0x00, 0x00, 0x8b, 0x00,
+  0xa8, 0x00, 0x02, 0xe2, 0x00, 0x1e, 0x20, 0x0b, 0x80, 0x00, 0x06, 0xb0, 0x46,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xfe, 0x17,
+  0xc3, 0x00, 0x03, 0xd0, 0x00, 0x5a, 0x00, 0x0a, 0x60, 0x00, 0x0e, 0x20, 0x1e,
+  0x00, 0x00, 0x08, 0x90, 0x88, 0x00, 0x00, 0x01, 0xe2, 0xe1, 0x00, 0x00, 0x00,
+  0xad, 0xa0, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x05,
+  0x00, 0x09, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01,
+  0x00, 0xf7, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x0d, 0xa0,
+  0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x04, 0xf3, 0x00, 0x00, 0x00, 0x1e,
+  0x70, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x07, 0xe1, 0x00, 0x00, 0x00,
+  0x3f, 0x40, 0x00, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x0a, 0xd0, 0x32, 0x00,
+  0x08, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00,
+  0x8f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x05, 0x00, 0x2b, 0x80,
+  0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0x10,
+  0xe1, 0x05, 0x00, 0x10, 0x96, 0x05, 0x00, 0x10, 0x3c, 0x05, 0x00, 0xc5, 0x0e,
+  0x10, 0x00, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x1f, 0x00,
+  0x15, 0x87, 0x1f, 0x00, 0x75, 0x0d, 0x20, 0x00, 0x00, 0x00, 0x08, 0x70, 0x1f,
+  0x00, 0x15, 0xd2, 0x1f, 0x00, 0x70, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x01, 0x00, 0x30, 0x1f, 0xff, 0xff, 0x07, 0x00, 0x1f, 0x0f, 0x05,
+  0x00, 0x2b, 0xa0, 0x1f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x01, 0x00, 0xff, 0x0d, 0xee, 0x00, 0x00, 0x00, 0x04, 0xbb, 0x40,
+  0x00, 0x00, 0x0a, 0x55, 0xa0, 0x00, 0x00, 0x1e, 0x00, 0xe1, 0x00, 0x00, 0x69,
+  0x00, 0x96, 0x00, 0x00, 0xc3, 0x00, 0x3c, 0x00, 0x01, 0x00, 0x15, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x37, 0xf0, 0x00, 0x0f, 0xff,
+  0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x01, 0x00, 0x10, 0x04, 0x05, 0x00, 0x20, 0x2f, 0x70, 0x0a, 0x00,
+  0x10, 0xf5, 0x0b, 0x00, 0x24, 0x7f, 0x20, 0x15, 0x00, 0x0f, 0x01, 0x00, 0x22,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0b, 0xfb, 0x18,
+  0x3a, 0xef, 0xb4, 0x00, 0x01, 0xd5, 0x00, 0x5e, 0x50, 0x00, 0x00, 0x00, 0x02,
+  0xe0, 0x00, 0x39, 0xce, 0xee, 0xf0, 0x07, 0xb2, 0x00, 0x00, 0xf0, 0x0e, 0x10,
+  0x00, 0x00, 0xf0, 0x0d, 0x71, 0x01, 0x5d, 0xf0, 0x01, 0x9d, 0xfe, 0xa3, 0xf0,
+  0x36, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0x00, 0x1f,
+  0x0f, 0x05, 0x00, 0x01, 0xe0, 0x6c, 0xef, 0xb3, 0x00, 0x0f, 0xd4, 0x00, 0x6e,
+  0x30, 0x0f, 0x10, 0x00, 0x06, 0xb0, 0x14, 0x00, 0x60, 0xf0, 0x0f, 0x00, 0x00,
+  0x01, 0xf0, 0x0f, 0x00, 0xbb, 0xc0, 0x0f, 0xd4, 0x00, 0x5f, 0x40, 0x0f, 0x5b,
+  0xef, 0xd5, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x01, 0x00, 0x0b, 0xf1, 0x04, 0x3b, 0xfe, 0xb3, 0x00, 0x03, 0xd4, 0x00, 0x5e,
+  0x20, 0x0b, 0x50, 0x00, 0x01, 0x10, 0x0f, 0x10, 0x00, 0x00, 0x00, 0x05, 0x00,
+  0xec, 0x0b, 0x60, 0x00, 0x01, 0x10, 0x03, 0xe6, 0x00, 0x5e, 0x30, 0x00, 0x3b,
+  0xff, 0xb3, 0x36, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01,
+  0x00, 0x1c, 0xf0, 0x05, 0x00, 0xf0, 0x05, 0x3b, 0xff, 0xc6, 0xf0, 0x03, 0xe6,
+  0x00, 0x4d, 0xf0, 0x0b, 0x60, 0x00, 0x01, 0xf0, 0x0f, 0x10, 0x00, 0x00, 0xf0,
+  0x0f, 0x19, 0x00, 0x10, 0x0c, 0x0f, 0x00, 0xba, 0x04, 0xf5, 0x00, 0x4d, 0xf0,
+  0x00, 0x5d, 0xfe, 0xb5, 0xf0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x00, 0x01, 0x00, 0x0b, 0xfb, 0x18, 0x2a, 0xef, 0xd6, 0x00, 0x02,
+  0xd5, 0x10, 0x3d, 0x60, 0x0b, 0x50, 0x00, 0x03, 0xd0, 0x0f, 0xff, 0xff, 0xff,
+  0xf0, 0x0f, 0x10, 0x00, 0x00, 0x00, 0x0b, 0x60, 0x00, 0x00, 0x10, 0x02, 0xe6,
+  0x10, 0x29, 0xe1, 0x00, 0x2a, 0xef, 0xd9, 0x30, 0x36, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0xb0, 0x08, 0xef, 0xf0, 0x00, 0x00,
+  0x9a, 0x10, 0x00, 0x00, 0x00, 0xe1, 0x0f, 0x00, 0x82, 0xf0, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xf0, 0x0a, 0x00, 0x0f, 0x05, 0x00, 0x0c, 0x09, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0b, 0xf2, 0x03,
+  0x2a, 0xef, 0xd6, 0xf0, 0x02, 0xe6, 0x00, 0x4d, 0xf0, 0x0a, 0x60, 0x00, 0x01,
+  0xf0, 0x0f, 0x10, 0x00, 0x00, 0x05, 0x00, 0x01, 0x0f, 0x00, 0xf0, 0x0f, 0x02,
+  0xe6, 0x10, 0x4d, 0xf0, 0x00, 0x2a, 0xef, 0xc6, 0xf0, 0x00, 0x00, 0x00, 0x05,
+  0xc0, 0x00, 0x00, 0x03, 0x8f, 0x40, 0x00, 0xff, 0xed, 0x93, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0x2e, 0xf0, 0x00, 0x05, 0x00, 0xe0,
+  0xf9, 0xdf, 0xea, 0x10, 0x00, 0xf9, 0x20, 0x18, 0xb0, 0x00, 0xf0, 0x00, 0x01,
+  0xf0, 0x14, 0x00, 0x0f, 0x05, 0x00, 0x03, 0x0a, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1c, 0x00, 0x01, 0x00, 0x19, 0x0f, 0x0d, 0x00, 0x25, 0xff,
+  0xff, 0x14, 0x00, 0x0f, 0x05, 0x00, 0x07, 0x2b, 0xff, 0xf0, 0x44, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x01, 0x00, 0x18, 0x1e, 0x0d, 0x00,
+  0x30, 0xff, 0xff, 0xff, 0x07, 0x00, 0x1f, 0x0f, 0x05, 0x00, 0x14, 0xc0, 0x2d,
+  0x00, 0x00, 0x00, 0x06, 0xe5, 0x00, 0x0f, 0xff, 0xeb, 0x40, 0x00, 0x15, 0x00,
+  0x01, 0x00, 0x1f, 0x0f, 0x05, 0x00, 0x03, 0xf0, 0x11, 0x0b, 0xb0, 0x0f, 0x00,
+  0x01, 0xda, 0x00, 0x0f, 0x00, 0x3e, 0x80, 0x00, 0x0f, 0x04, 0xff, 0x40, 0x00,
+  0x0f, 0x6f, 0x56, 0xe2, 0x00, 0x0f, 0xd2, 0x00, 0x8d, 0x10, 0x0f, 0x00, 0x00,
+  0x09, 0xb0, 0x28, 0x00, 0x2a, 0xb9, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x01, 0x00, 0x30, 0x0f, 0xff, 0xf0, 0x07, 0x00, 0x0f,
+  0x05, 0x00, 0x15, 0x10, 0xe1, 0x05, 0x00, 0x10, 0x9a, 0x05, 0x00, 0x4a, 0x1a,
+  0xef, 0xf0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x01, 0x00, 0x0a, 0xff, 0x02, 0x0f, 0x8f, 0xe7, 0xee, 0x50, 0x0f, 0x80, 0x2f,
+  0x32, 0xe0, 0x0f, 0x10, 0x0f, 0x00, 0xf0, 0x0f, 0x00, 0x05, 0x00, 0x04, 0x0b,
+  0x37, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a,
+  0xff, 0x05, 0x0f, 0x1a, 0xff, 0xd7, 0x00, 0x0f, 0xd6, 0x00, 0x3c, 0x90, 0x0f,
+  0x40, 0x00, 0x01, 0xe0, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x05, 0x00, 0x01, 0x0b,
+  0x37, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0b,
+  0xf1, 0x04, 0x3b, 0xff, 0xb3, 0x00, 0x03, 0xd4, 0x01, 0x5e, 0x30, 0x0b, 0x50,
+  0x00, 0x05, 0xb0, 0x0f, 0x10, 0x00, 0x01, 0xf0, 0x05, 0x00, 0xa1, 0x0b, 0x60,
+  0x00, 0x05, 0xb0, 0x03, 0xe6, 0x01, 0x5e, 0x30, 0x23, 0x00, 0x0b, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a, 0xf0, 0x19,
+  0x0f, 0x5c, 0xff, 0xd6, 0x00, 0x0f, 0xd4, 0x10, 0x5e, 0x40, 0x0f, 0x10, 0x00,
+  0x05, 0xc0, 0x0f, 0x00, 0x00, 0x00, 0xe0, 0x0f, 0x00, 0x00, 0x01, 0xf0, 0x0f,
+  0x10, 0x00, 0x07, 0xb0, 0x0f, 0xd5, 0x01, 0x7f, 0x30, 0x0f, 0x4b, 0xef, 0xb3,
+  0x00, 0x19, 0x00, 0x07, 0x05, 0x00, 0x50, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0x00, 0x01, 0x00, 0x0b, 0xf0, 0x0a, 0x4c, 0xff, 0xd8, 0xf0, 0x04, 0xf5, 0x00,
+  0x5d, 0xf0, 0x0c, 0x60, 0x00, 0x01, 0xf0, 0x0f, 0x10, 0x00, 0x00, 0xf0, 0x0f,
+  0x00, 0x00, 0x00, 0xf0, 0x0b, 0x0f, 0x00, 0xa0, 0x03, 0xe6, 0x10, 0x4d, 0xf0,
+  0x00, 0x3b, 0xff, 0xd6, 0xf0, 0x2b, 0x00, 0x07, 0x05, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0xf0, 0x1f, 0x00, 0x01, 0x00, 0x0b, 0xf0, 0x01, 0xf1, 0x9e, 0xfd,
+  0x70, 0x00, 0xfe, 0x70, 0x04, 0xf0, 0x00, 0xf8, 0x00, 0x00, 0xf0, 0x00, 0xf0,
+  0x14, 0x00, 0x0e, 0x05, 0x00, 0x0c, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x00, 0x01, 0x00, 0x0b, 0xb0, 0x2a, 0xef, 0xd9, 0x00, 0x00, 0xd5,
+  0x00, 0x37, 0x00, 0x00, 0xd4, 0x0f, 0x00, 0x80, 0x2b, 0xc8, 0x40, 0x00, 0x00,
+  0x00, 0x15, 0xad, 0x06, 0x00, 0xcb, 0x02, 0xe0, 0x01, 0xd5, 0x10, 0x04, 0xd0,
+  0x00, 0x5b, 0xef, 0xea, 0x20, 0x36, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x01, 0x00, 0x19, 0x0f, 0x05, 0x00, 0x5b, 0x0f, 0xff, 0xff, 0xff,
+  0xf0, 0x14, 0x00, 0x07, 0x05, 0x00, 0x9b, 0x0e, 0x50, 0x00, 0x00, 0x00, 0x04,
+  0xcf, 0xff, 0xf0, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x01, 0x00, 0x0a, 0x5f, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x05, 0x00, 0x01, 0xfb,
+  0x00, 0x0d, 0x50, 0x00, 0x02, 0xf0, 0x04, 0xf6, 0x10, 0x5d, 0xf0, 0x00, 0x3b,
+  0xff, 0xb3, 0xf0, 0x37, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x01, 0x00, 0x0a, 0xfd, 0x17, 0x0c, 0x30, 0x00, 0x03, 0xc0, 0x05, 0xa0, 0x00,
+  0x09, 0x50, 0x00, 0xe1, 0x00, 0x1e, 0x00, 0x00, 0x87, 0x00, 0x78, 0x00, 0x00,
+  0x1e, 0x00, 0xe1, 0x00, 0x00, 0x0a, 0x55, 0xa0, 0x00, 0x00, 0x03, 0xcc, 0x30,
+  0x00, 0x00, 0x00, 0xcc, 0x37, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0x00, 0x01, 0x00, 0x0a, 0xfc, 0x18, 0x0e, 0x10, 0x00, 0x01, 0xe0, 0x0c, 0x30,
+  0x00, 0x03, 0xc0, 0x09, 0x50, 0x00, 0x05, 0x90, 0x06, 0x70, 0x66, 0x08, 0x60,
+  0x04, 0xa0, 0xee, 0x0a, 0x40, 0x01, 0xc6, 0x78, 0x6c, 0x10, 0x00, 0xdb, 0x11,
+  0xcd, 0x00, 0x00, 0xc8, 0x00, 0xac, 0x37, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a, 0xf3, 0x04, 0x09, 0xa0, 0x00, 0x0b, 0x90,
+  0x00, 0xb7, 0x00, 0x7b, 0x00, 0x00, 0x0c, 0x44, 0xc0, 0x00, 0x00, 0x01, 0xdd,
+  0x10, 0x05, 0x00, 0x01, 0x0f, 0x00, 0x00, 0x19, 0x00, 0x20, 0x09, 0xb0, 0x23,
+  0x00, 0x0a, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01,
+  0x00, 0x0a, 0xf0, 0x04, 0x0c, 0x30, 0x00, 0x03, 0xc0, 0x04, 0xb0, 0x00, 0x09,
+  0x70, 0x00, 0xc3, 0x00, 0x0e, 0x10, 0x00, 0x4b, 0x00, 0x6b, 0x15, 0x00, 0xf0,
+  0x16, 0xc5, 0x00, 0x00, 0x04, 0xb3, 0xe0, 0x00, 0x00, 0x00, 0xcc, 0x90, 0x00,
+  0x00, 0x00, 0x4f, 0x30, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x01, 0xe3,
+  0x00, 0x00, 0x00, 0x2d, 0x80, 0x00, 0x00, 0x0c, 0xe7, 0x00, 0x00, 0x00, 0x1f,
+  0x00, 0x01, 0x00, 0x0a, 0xf7, 0x11, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00,
+  0x00, 0x1d, 0x70, 0x00, 0x00, 0x02, 0xe6, 0x00, 0x00, 0x00, 0x3e, 0x50, 0x00,
+  0x00, 0x04, 0xe4, 0x00, 0x00, 0x00, 0x5e, 0x30, 0x00, 0x00, 0x07, 0xe2, 0x23,
+  0x00, 0x08, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01,
+  0x00, 0x60, 0x5d, 0xff, 0xf0, 0x00, 0x00, 0xe6, 0x0a, 0x00, 0x1e, 0xf0, 0x05,
+  0x00, 0xcf, 0x03, 0xd0, 0x00, 0x00, 0x00, 0xff, 0x50, 0x00, 0x00, 0x00, 0x02,
+  0xc0, 0x23, 0x00, 0x04, 0xe0, 0x00, 0xd8, 0x10, 0x00, 0x00, 0x00, 0x3b, 0xef,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0x1f, 0x0f, 0x05,
+  0x00, 0x35, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0x00, 0x81,
+  0x0f, 0xff, 0xc4, 0x00, 0x00, 0x00, 0x01, 0x7d, 0x0c, 0x00, 0x1e, 0x00, 0x05,
+  0x00, 0xcf, 0x0b, 0x30, 0x00, 0x00, 0x00, 0x05, 0xff, 0x00, 0x00, 0x00, 0x0d,
+  0x40, 0x23, 0x00, 0x04, 0x13, 0x6e, 0x46, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x00, 0x01, 0x00, 0x10, 0xef, 0xaf, 0xb0, 0x05, 0xe0, 0x0a, 0xb0,
+  0xbb, 0x1c, 0xb0, 0x0e, 0x50, 0x1b, 0xfc, 0x20, 0x31, 0x00, 0x10, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x01, 0x00, 0xff, 0x04, 0x05, 0xee, 0x60,
+  0x00, 0x00, 0x0e, 0x33, 0xe0, 0x00, 0x00, 0x0f, 0x22, 0xf0, 0x00, 0x00, 0x07,
+  0xee, 0x70, 0x00, 0x01, 0x00, 0x1e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0x00, 0x01, 0x00, 0x07, 0x19, 0x0f, 0x05, 0x00, 0x4c, 0xff, 0xff, 0xff, 0xf0,
+  0x14, 0x00, 0x25, 0x00, 0x00, 0x19, 0x00, 0x09, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x16, 0x1f, 0x0f, 0x2b, 0x00, 0x17,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x01, 0x00, 0xfb, 0x26, 0xef,
+  0xff, 0xf0, 0x00, 0x04, 0xcf, 0x00, 0x00, 0x00, 0x0a, 0x6f, 0x00, 0x00, 0x00,
+  0x1f, 0x1f, 0x00, 0x00, 0x00, 0x7a, 0x0f, 0x00, 0x00, 0x00, 0xd4, 0x0f, 0xff,
+  0xf0, 0x03, 0xe0, 0x0f, 0x00, 0x00, 0x0a, 0xff, 0xff, 0x00, 0x00, 0x0f, 0x10,
+  0x0f, 0x00, 0x00, 0x6a, 0x00, 0x0f, 0x00, 0x00, 0xc3, 0x00, 0x0f, 0xff, 0xf0,
+  0x44, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xe0,
+  0xff, 0xfe, 0xc6, 0x00, 0x00, 0xf0, 0x00, 0x4c, 0xa0, 0x00, 0xf0, 0x00, 0x00,
+  0xc5, 0x05, 0x00, 0x10, 0x5b, 0x05, 0x00, 0x61, 0x1e, 0x4f, 0xff, 0xfb, 0x00,
+  0x0f, 0x0a, 0x00, 0x05, 0x14, 0x00, 0x10, 0xd5, 0x28, 0x00, 0x5c, 0x90, 0x00,
+  0xff, 0xff, 0xc5, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x01, 0x00, 0x0b, 0xff, 0x0d, 0x88, 0x00, 0x78, 0x00, 0x00, 0x1d, 0x87, 0xd1,
+  0x00, 0x00, 0x01, 0xee, 0x10, 0x00, 0x00, 0x07, 0xdd, 0x80, 0x00, 0x00, 0x7d,
+  0x11, 0xd7, 0x00, 0x00, 0x21, 0x00, 0x12, 0x36, 0x00, 0x07, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xfa, 0x2a, 0x10, 0x00, 0x3c, 0xfe,
+  0xb4, 0x70, 0x02, 0xe5, 0x00, 0x5f, 0x30, 0x09, 0x70, 0x00, 0x4a, 0x90, 0x0d,
+  0x20, 0x01, 0x72, 0xd0, 0x0f, 0x00, 0x08, 0x00, 0xf0, 0x0f, 0x00, 0x43, 0x00,
+  0xf0, 0x0f, 0x11, 0x70, 0x01, 0xf0, 0x0d, 0x38, 0x00, 0x03, 0xd0, 0x09, 0xc3,
+  0x00, 0x08, 0x90, 0x03, 0xf5, 0x01, 0x5e, 0x10, 0x07, 0x3b, 0xef, 0xb2, 0x00,
+  0x01, 0x47, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00,
+  0x15, 0xf0, 0x05, 0x00, 0x30, 0xff, 0xff, 0xd8, 0x0a, 0x00, 0x74, 0x2a, 0xa0,
+  0x00, 0xf0, 0x00, 0x01, 0xe0, 0x05, 0x00, 0x68, 0x3b, 0x80, 0x00, 0xff, 0xff,
+  0xd7, 0x28, 0x00, 0x2d, 0xf0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x16, 0x00, 0x01, 0x00, 0xf0, 0x12, 0x3d, 0xfe, 0x70, 0x00, 0x00, 0xc5,
+  0x03, 0xd0, 0x00, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0x00, 0xf0, 0x04, 0x90, 0x00,
+  0x00, 0xf0, 0x0b, 0x40, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x0c,
+  0x40, 0x14, 0x00, 0x90, 0xe6, 0x00, 0x00, 0xf0, 0x00, 0x29, 0x90, 0x00, 0xf0,
+  0x26, 0x00, 0xaa, 0xf0, 0xd7, 0x01, 0xe0, 0x00, 0xf0, 0x3b, 0xff, 0x80, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a,
+  0xfb, 0x19, 0x2a, 0xee, 0x65, 0xdf, 0xc1, 0x15, 0x02, 0xdf, 0x80, 0x8a, 0x00,
+  0x00, 0x3f, 0x20, 0x1e, 0x04, 0xad, 0xff, 0xff, 0xff, 0x7c, 0x41, 0x0f, 0x00,
+  0x00, 0xe1, 0x00, 0x0f, 0x10, 0x00, 0xd3, 0x01, 0x9f, 0x80, 0x02, 0x2c, 0xfe,
+  0x62, 0x9e, 0xe6, 0x37, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x01, 0x00, 0xd0, 0x04, 0x20, 0x01, 0x00, 0x00, 0x00, 0x56, 0x66, 0x00, 0x00,
+  0x00, 0x57, 0x80, 0x0f, 0x00, 0x10, 0x47, 0x16, 0x00, 0xfb, 0x1b, 0x0b, 0x20,
+  0x00, 0x3b, 0xfe, 0x76, 0x80, 0x03, 0xe5, 0x00, 0x5a, 0xc0, 0x0b, 0x50, 0x00,
+  0x02, 0xe0, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x0e, 0x10, 0x00, 0x02, 0xe0, 0x0a,
+  0x70, 0x00, 0x07, 0x90, 0x02, 0xe7, 0x11, 0x6e, 0x20, 0x00, 0x2a, 0xef, 0xb2,
+  0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00,
+  0x07, 0x15, 0xff, 0x05, 0x00, 0x06, 0x13, 0x00, 0x2f, 0xff, 0xff, 0x23, 0x00,
+  0x0d, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x01, 0x00, 0x0b, 0xfc, 0x17, 0x4c, 0xfd, 0x52, 0xa0, 0x04, 0xf6, 0x01, 0x7b,
+  0x00, 0x0c, 0x60, 0x00, 0x77, 0x60, 0x0f, 0x10, 0x07, 0x01, 0xe0, 0x0e, 0x10,
+  0x70, 0x00, 0xf0, 0x06, 0x67, 0x00, 0x06, 0xc0, 0x00, 0xb7, 0x10, 0x6f, 0x40,
+  0x0a, 0x26, 0xdf, 0xc4, 0x36, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+  0x00, 0x01, 0x00, 0x1f, 0xf0, 0x05, 0x00, 0x01, 0xd0, 0x8e, 0xe8, 0x00, 0x00,
+  0xf7, 0x30, 0x3d, 0x60, 0x00, 0xf0, 0x00, 0x04, 0xd0, 0x14, 0x00, 0x50, 0xf0,
+  0x00, 0xf0, 0x00, 0x01, 0x05, 0x00, 0xbc, 0x06, 0xb0, 0x00, 0xf8, 0x20, 0x5e,
+  0x30, 0x00, 0xf1, 0xbf, 0xc4, 0x37, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x01, 0x00, 0x10, 0x04, 0x05, 0x00, 0x20, 0x2f, 0x70, 0x0a, 0x00,
+  0x10, 0xf5, 0x0b, 0x00, 0x24, 0x7f, 0x20, 0x15, 0x00, 0x0f, 0x01, 0x00, 0x22,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0xf0, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x07, 0xf3, 0x00, 0x00, 0x00, 0x5f, 0x50, 0x00, 0x00, 0x01,
+  0xf7, 0x13, 0x00, 0x2f, 0x20, 0x00, 0x01, 0x00, 0x25, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xff, 0x04, 0x01, 0xee, 0x20, 0x00, 0x00,
+  0x1e, 0x77, 0xe3, 0x00, 0x00, 0xd7, 0x00, 0x7e, 0x10, 0x00, 0x20, 0x00, 0x02,
+  0x00, 0x01, 0x00, 0x24, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01,
+  0x00, 0x9f, 0x3d, 0xd3, 0x2e, 0x00, 0x00, 0xc4, 0x2c, 0xe5, 0x00, 0x01, 0x00,
+  0x2e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x6f, 0x0f,
+  0xff, 0xff, 0xff, 0xf0, 0x00, 0x01, 0x00, 0x2d, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1b, 0x00, 0x01, 0x00, 0x4f, 0x0f, 0x00, 0xf0, 0x00, 0x01, 0x00, 0x2e,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0x74, 0x8f, 0x80,
+  0x00, 0x00, 0x00, 0xf4, 0xf0, 0x0a, 0x00, 0x0f, 0x01, 0x00, 0x27, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x34, 0x10, 0xf0, 0x05, 0x00,
+  0x10, 0xfa, 0x05, 0x00, 0x80, 0x1e, 0x00, 0x00, 0x00, 0x0f, 0xc4, 0x00, 0x00,
+  0x1f, 0x00, 0x01, 0x00, 0x03, 0xff, 0x18, 0x4f, 0x20, 0x00, 0x00, 0x00, 0xd9,
+  0x00, 0x00, 0x00, 0x06, 0xf1, 0x00, 0x00, 0x00, 0x0e, 0x70, 0x00, 0x00, 0x00,
+  0x8d, 0x00, 0x00, 0x00, 0x02, 0xf5, 0x00, 0x00, 0x00, 0x0a, 0xc0, 0x00, 0x00,
+  0x00, 0x3f, 0x30, 0x00, 0x00, 0x00, 0xca, 0x3e, 0x00, 0x04, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0x60, 0xff, 0xff, 0xff, 0xf0, 0x00,
+  0xf0, 0x0a, 0x00, 0x0f, 0x05, 0x00, 0x1a, 0x0a, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xfb, 0x27, 0x01, 0xff, 0x20, 0x00,
+  0x00, 0x05, 0xdd, 0x70, 0x00, 0x00, 0x0a, 0x78, 0xc0, 0x00, 0x00, 0x0f, 0x22,
+  0xf1, 0x00, 0x00, 0x4d, 0x00, 0xd5, 0x00, 0x00, 0x98, 0x00, 0x8a, 0x00, 0x00,
+  0xe2, 0x00, 0x2f, 0x00, 0x03, 0xd0, 0x00, 0x0d, 0x40, 0x08, 0x80, 0x00, 0x08,
+  0x90, 0x0d, 0x20, 0x00, 0x02, 0xd0, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0x45, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xf1, 0x09, 0x2b,
+  0xff, 0xa1, 0x00, 0x01, 0xd5, 0x01, 0x6d, 0x00, 0x09, 0x60, 0x00, 0x09, 0x70,
+  0x0e, 0x10, 0x00, 0x04, 0xb0, 0x1f, 0x00, 0x00, 0x02, 0xe0, 0x05, 0x00, 0x01,
+  0x0f, 0x00, 0xfb, 0x05, 0x08, 0x60, 0x00, 0x08, 0x50, 0x01, 0xd1, 0x00, 0x2d,
+  0x00, 0x00, 0x69, 0x00, 0xb4, 0x00, 0x0f, 0xfe, 0x01, 0xff, 0xd0, 0x45, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0b, 0xfb, 0x18,
+  0x1a, 0xfe, 0x90, 0xf3, 0x01, 0xc4, 0x03, 0xba, 0xd0, 0x09, 0x50, 0x00, 0x2f,
+  0x60, 0x0e, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x00, 0x0e, 0x00, 0x0d, 0x20,
+  0x00, 0x2f, 0x10, 0x06, 0xb2, 0x00, 0xad, 0x90, 0x00, 0x6d, 0xfe, 0x64, 0xf8,
+  0x36, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xf0,
+  0x30, 0x09, 0xef, 0x90, 0x00, 0x00, 0x8a, 0x32, 0x9a, 0x00, 0x00, 0xd2, 0x00,
+  0x0f, 0x00, 0x00, 0xf0, 0x00, 0x1e, 0x00, 0x00, 0xf0, 0x03, 0xb7, 0x00, 0x00,
+  0xf0, 0xef, 0x80, 0x00, 0x00, 0xf0, 0x35, 0xdb, 0x10, 0x00, 0xf0, 0x00, 0x0c,
+  0xa0, 0x00, 0xf0, 0x00, 0x04, 0xe0, 0x00, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0xf2,
+  0x00, 0x02, 0xd0, 0x00, 0xff, 0x61, 0x2b, 0x70, 0x00, 0xf6, 0xff, 0xfa, 0x2d,
+  0x00, 0xc0, 0x10, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x00, 0x01, 0x00, 0x0b, 0xb0, 0x3c, 0xff, 0xd8, 0x00, 0x00, 0xe9,
+  0x21, 0x37, 0x00, 0x00, 0xe2, 0x0f, 0x00, 0x60, 0x6f, 0xed, 0xa0, 0x00, 0x00,
+  0xc6, 0x0a, 0x00, 0x10, 0xf0, 0x05, 0x00, 0x9b, 0xd9, 0x10, 0x17, 0x40, 0x00,
+  0x2b, 0xff, 0xea, 0x20, 0x36, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b,
+  0x00, 0x01, 0x00, 0xf1, 0x22, 0x4c, 0xff, 0xb3, 0x00, 0x04, 0xf9, 0x22, 0x9f,
+  0x20, 0x0d, 0xb0, 0x00, 0x0b, 0xa0, 0x1f, 0x40, 0x00, 0x04, 0xe0, 0x3f, 0x10,
+  0x00, 0x02, 0xf0, 0x3f, 0xee, 0xee, 0xee, 0xf0, 0x2f, 0x31, 0x11, 0x14, 0xf0,
+  0x0f, 0x40, 0x00, 0x04, 0xd0, 0x0b, 0x90, 0x00, 0x09, 0x80, 0x04, 0xf9, 0x44,
+  0x9f, 0x10, 0x32, 0x00, 0x0b, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x01, 0x00, 0x80, 0x0b, 0xfc, 0x20, 0x00, 0x00, 0x01, 0x07, 0xd0,
+  0x0c, 0x00, 0x10, 0xb5, 0x05, 0x00, 0x10, 0x5b, 0x05, 0x00, 0x10, 0x9f, 0x15,
+  0x00, 0xfa, 0x13, 0xf9, 0x80, 0x00, 0x00, 0x08, 0xa2, 0xe0, 0x00, 0x00, 0x0e,
+  0x30, 0xc4, 0x00, 0x00, 0x6c, 0x00, 0x7a, 0x00, 0x00, 0xd5, 0x00, 0x1f, 0x10,
+  0x05, 0xe0, 0x00, 0x0b, 0x60, 0x0c, 0x80, 0x00, 0x06, 0xc0, 0x00, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a, 0x10, 0x0f,
+  0x03, 0x00, 0x0f, 0x05, 0x00, 0x02, 0xf3, 0x00, 0x30, 0x00, 0x4f, 0x20, 0x0f,
+  0xe4, 0x14, 0xdd, 0x70, 0x0f, 0x5d, 0xfd, 0x33, 0xe2, 0x0f, 0x2d, 0x00, 0x03,
+  0x05, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a,
+  0xaf, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x05, 0x00,
+  0x0a, 0x1b, 0xf0, 0x37, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x01, 0x00, 0x0b, 0xf2, 0x04, 0x08, 0xdf, 0xd6, 0x00, 0x00, 0x8b, 0x10, 0x2a,
+  0x50, 0x00, 0xd2, 0x00, 0x01, 0xc0, 0x00, 0xf0, 0x00, 0x00, 0xe0, 0x05, 0x00,
+  0xe0, 0xf2, 0x00, 0x05, 0xa0, 0x00, 0xf9, 0x10, 0x3e, 0x30, 0x00, 0xf8, 0xdf,
+  0xc4, 0x00, 0x14, 0x00, 0x07, 0x05, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x01, 0x00, 0x0b, 0xfc, 0x17, 0x5c, 0xef, 0xff, 0xfe, 0x06, 0xd3,
+  0x00, 0x5c, 0x20, 0x0d, 0x40, 0x00, 0x05, 0xb0, 0x0f, 0x00, 0x00, 0x00, 0xe0,
+  0x0f, 0x10, 0x00, 0x00, 0xe0, 0x0c, 0x40, 0x00, 0x04, 0xb0, 0x05, 0xd4, 0x01,
+  0x5e, 0x30, 0x00, 0x5c, 0xff, 0xb4, 0x36, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a, 0xf0, 0x2d, 0x07, 0xfe, 0x00, 0x09, 0x90,
+  0x0c, 0x3c, 0x40, 0x4e, 0x00, 0x01, 0x05, 0x90, 0xd4, 0x00, 0x00, 0x01, 0xe9,
+  0xa0, 0x00, 0x00, 0x00, 0xbe, 0x10, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00,
+  0x02, 0xde, 0x00, 0x00, 0x00, 0x0a, 0x6c, 0x20, 0x00, 0x00, 0x2e, 0x07, 0x70,
+  0x00, 0x00, 0x99, 0x02, 0xe5, 0xb0, 0x01, 0xf3, 0x00, 0x7e, 0x60, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0b, 0x60, 0xff, 0xff, 0xf0, 0x00,
+  0x00, 0xf0, 0x0a, 0x00, 0x12, 0xf0, 0x0f, 0x00, 0x04, 0x0a, 0x00, 0x08, 0x14,
+  0x00, 0x1c, 0xf0, 0x36, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x01, 0x00, 0x02, 0x70, 0x0e, 0x40, 0x00, 0x00, 0x00, 0x04, 0xe5, 0x0b, 0x00,
+  0xc1, 0x2d, 0x60, 0x00, 0x00, 0x00, 0x01, 0xc7, 0x0f, 0xff, 0xff, 0xff, 0xff,
+  0x0a, 0x00, 0x03, 0x14, 0x00, 0x24, 0x03, 0xe5, 0x28, 0x00, 0x0e, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0b, 0xff, 0x13,
+  0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x4c, 0xf0, 0x00, 0x00, 0x04, 0xe2,
+  0xf0, 0x00, 0x00, 0x5e, 0x30, 0xf0, 0x00, 0x05, 0xf3, 0x00, 0xf0, 0x00, 0x6f,
+  0x40, 0x00, 0xf0, 0x00, 0xf4, 0x00, 0x00, 0xf0, 0x36, 0x00, 0x01, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0b, 0xff, 0x13, 0xf6, 0x00,
+  0x00, 0xf0, 0x00, 0x4f, 0x50, 0x00, 0xf0, 0x00, 0x04, 0xf5, 0x00, 0xf0, 0x00,
+  0x00, 0x3e, 0x40, 0xf0, 0x00, 0x00, 0x03, 0xe4, 0xf0, 0x00, 0x00, 0x00, 0x2c,
+  0xf0, 0x00, 0xff, 0xff, 0xff, 0xf0, 0x36, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xc0, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0x0a,
+  0xa0, 0x00, 0x00, 0x00, 0x01, 0xe5, 0x10, 0x00, 0x70, 0x4f, 0x20, 0x00, 0x00,
+  0x00, 0x08, 0xc0, 0x0b, 0x00, 0x15, 0xd8, 0x10, 0x00, 0xa0, 0xba, 0x00, 0x00,
+  0x00, 0x07, 0xd0, 0x00, 0x00, 0x00, 0x3f, 0x0e, 0x00, 0x64, 0xd5, 0x00, 0x00,
+  0x00, 0x0a, 0x90, 0x3c, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xf0, 0x4b, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x00,
+  0x03, 0xf1, 0x00, 0x00, 0x00, 0x06, 0xd0, 0x00, 0x00, 0x00, 0x09, 0xa0, 0x00,
+  0x00, 0x00, 0x0c, 0x70, 0x00, 0x00, 0x00, 0x0e, 0x40, 0x00, 0x00, 0x00, 0x1f,
+  0x10, 0x00, 0x40, 0x00, 0x4e, 0x00, 0x09, 0xf4, 0x00, 0x7b, 0x00, 0x03, 0x9a,
+  0x00, 0xa8, 0x00, 0x00, 0x2f, 0x00, 0xd5, 0x00, 0x00, 0x0d, 0x50, 0xf2, 0x00,
+  0x00, 0x07, 0xb3, 0xf0, 0x00, 0x00, 0x01, 0xf7, 0xc0, 0x00, 0x00, 0x00, 0xbe,
+  0x90, 0x00, 0x00, 0x00, 0x6f, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a, 0xff, 0x0a, 0x2c, 0xfa,
+  0x11, 0xcf, 0xc2, 0xc5, 0x06, 0xcc, 0x60, 0x3c, 0xf0, 0x00, 0xab, 0x00, 0x0f,
+  0xd4, 0x15, 0xcc, 0x60, 0x5c, 0x4d, 0xfb, 0x21, 0xcf, 0xc2, 0x37, 0x00, 0x0b,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xb1, 0x5e, 0xfa,
+  0x00, 0x00, 0x00, 0xd5, 0x0f, 0xf0, 0x00, 0x00, 0xf0, 0x05, 0x00, 0x2f, 0x00,
+  0x00, 0x05, 0x00, 0x15, 0x24, 0x0f, 0xf0, 0x05, 0x00, 0x33, 0x00, 0xcf, 0xb0,
+  0x4e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x06,
+  0xff, 0x13, 0xaf, 0xa0, 0x05, 0xf0, 0x07, 0xc1, 0xd9, 0x0b, 0xc0, 0x0d, 0x70,
+  0x3f, 0xdf, 0x60, 0x09, 0x20, 0x04, 0x85, 0x00, 0x01, 0xbf, 0xb0, 0x06, 0xf0,
+  0x0a, 0xb1, 0xbb, 0x1c, 0xb0, 0x0f, 0x50, 0x1b, 0xfc, 0x20, 0x3b, 0x00, 0x06,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x01, 0x00, 0xf0, 0x04, 0x1a,
+  0x00, 0x00, 0x00, 0x05, 0xea, 0x00, 0x00, 0x01, 0xae, 0x40, 0x00, 0x00, 0x5e,
+  0xa1, 0x00, 0x00, 0x00, 0xf8, 0x17, 0x00, 0x80, 0x5e, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0xad, 0x30, 0x1e, 0x00, 0x14, 0xe8, 0x28, 0x00, 0x00, 0x01, 0x00, 0x3c,
+  0xff, 0xff, 0xff, 0x43, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x01, 0x00, 0x10, 0xa1, 0x05, 0x00, 0xd0, 0x9e, 0x50, 0x00, 0x00, 0x00, 0x04,
+  0xda, 0x10, 0x00, 0x00, 0x00, 0x08, 0xe5, 0x11, 0x00, 0xb3, 0x5f, 0x00, 0x00,
+  0x00, 0x07, 0xe5, 0x00, 0x00, 0x03, 0xda, 0x10, 0x1e, 0x00, 0x15, 0xa1, 0x32,
+  0x00, 0x3c, 0xff, 0xff, 0xff, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x01, 0x00, 0x10, 0x04, 0x05, 0x00, 0x10, 0x0c, 0x05, 0x00, 0x10,
+  0x59, 0x05, 0x00, 0xf0, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00,
+  0x00, 0x0d, 0x10, 0x00, 0x00, 0x00, 0x78, 0x13, 0x00, 0x24, 0xd2, 0x00, 0x0a,
+  0x00, 0x24, 0x0d, 0x10, 0x1e, 0x00, 0x25, 0x00, 0xd1, 0x32, 0x00, 0x13, 0x0c,
+  0x46, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0x10,
+  0x40, 0x05, 0x00, 0x10, 0xc0, 0x05, 0x00, 0x10, 0x95, 0x05, 0x00, 0x10, 0x1d,
+  0x05, 0x00, 0x70, 0x08, 0x60, 0x00, 0x00, 0x00, 0x01, 0xd0, 0x0b, 0x00, 0x10,
+  0x87, 0x05, 0x00, 0x14, 0x2d, 0x0a, 0x00, 0x24, 0x01, 0xd0, 0x1e, 0x00, 0x01,
+  0x28, 0x00, 0x15, 0x85, 0x3c, 0x00, 0x90, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf1, 0x23, 0x0f, 0xff, 0xff, 0xff,
+  0xf0, 0x0f, 0x80, 0x00, 0x18, 0xf0, 0x0f, 0x17, 0x00, 0x81, 0xf0, 0x0f, 0x06,
+  0x22, 0x60, 0xf0, 0x0f, 0x00, 0x99, 0x00, 0xf0, 0x0f, 0x00, 0x88, 0x00, 0xf0,
+  0x0f, 0x01, 0x78, 0x10, 0xf0, 0x0f, 0x08, 0x00, 0x90, 0xf0, 0x0f, 0x35, 0x00,
+  0x63, 0xf0, 0x0f, 0x90, 0x00, 0x09, 0xf0, 0x32, 0x00, 0x0b, 0x46, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+const KDFont KDFont::privateLargeFont(LargeFont::k_glyphWidth, LargeFont::k_glyphHeight, glyphDataOffset, glyphData);
@@ -0,0 +1,67 @@
+/* This file is auto-generated by the rasterizer */
+
+#include <kandinsky/font.h>
+
+constexpr static KDFont::CodePointIndexPair table[] = {
+  KDFont::CodePointIndexPair(0x20, 0),
+  KDFont::CodePointIndexPair(0xb0, 95),
+  KDFont::CodePointIndexPair(0xb7, 97),
+  KDFont::CodePointIndexPair(0xc6, 98),
+  KDFont::CodePointIndexPair(0xd0, 99),
+  KDFont::CodePointIndexPair(0xd7, 100),
+  KDFont::CodePointIndexPair(0xde, 102),
+  KDFont::CodePointIndexPair(0xe6, 104),
+  KDFont::CodePointIndexPair(0xf0, 105),
+  KDFont::CodePointIndexPair(0xf7, 106),
+  KDFont::CodePointIndexPair(0xfe, 108),
+  KDFont::CodePointIndexPair(0x300, 109),
+  KDFont::CodePointIndexPair(0x305, 113),
+  KDFont::CodePointIndexPair(0x308, 114),
+  KDFont::CodePointIndexPair(0x30a, 115),
+  KDFont::CodePointIndexPair(0x327, 116),
+  KDFont::CodePointIndexPair(0x338, 117),
+  KDFont::CodePointIndexPair(0x393, 118),
+  KDFont::CodePointIndexPair(0x3a9, 120),
+  KDFont::CodePointIndexPair(0x3b1, 121),
+  KDFont::CodePointIndexPair(0x3b5, 123),
+  KDFont::CodePointIndexPair(0x3b8, 124),
+  KDFont::CodePointIndexPair(0x3bb, 125),
+  KDFont::CodePointIndexPair(0x3c0, 127),
+  KDFont::CodePointIndexPair(0x3c3, 129),
+  KDFont::CodePointIndexPair(0x3c7, 130),
+  KDFont::CodePointIndexPair(0x1d07, 131),
+  KDFont::CodePointIndexPair(0x2192, 132),
+  KDFont::CodePointIndexPair(0x2197, 133),
+  KDFont::CodePointIndexPair(0x2211, 135),
+  KDFont::CodePointIndexPair(0x221a, 136),
+  KDFont::CodePointIndexPair(0x221e, 137),
+  KDFont::CodePointIndexPair(0x222b, 138),
+  KDFont::CodePointIndexPair(0x2248, 139),
+  KDFont::CodePointIndexPair(0x2264, 140),
+  KDFont::CodePointIndexPair(0x27e8, 142),
+  KDFont::CodePointIndexPair(0xfffd, 144),
+};
+
+constexpr static KDFont::GlyphIndex directTable[] = {
+  144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144,
+  144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144,
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+  32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+  64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+  80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 144,
+  144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144,
+  144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144,
+  144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144,
+  95, 96, 144, 144, 144, 144, 144, 97, 144, 144, 144, 144, 144, 144, 144, 144,
+  144, 144, 144, 144, 144, 144, 98, 144, 144, 144, 144, 144, 144, 144, 144, 144,
+  99, 144, 144, 144, 144, 144, 144, 100, 101, 144, 144, 144, 144, 144, 102, 103,
+  144, 144, 144, 144, 144, 144, 104, 144, 144, 144, 144, 144, 144, 144, 144, 144,
+  105, 144, 144, 144, 144, 144, 144, 106, 107, 144, 144, 144, 144, 144, 108, 144,
+};
+
+const KDFont::CodePointIndexPair * KDFont::s_CodePointToGlyphIndex = table;
+const size_t KDFont::s_codePointPairsTableLength = 37;
+const KDFont::GlyphIndex * KDFont::s_directGlyphIndex = directTable;
+
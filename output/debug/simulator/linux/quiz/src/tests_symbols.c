@@ -0,0 +1,1277 @@
+#include <string.h>
+#include "symbols.h"
+
+void quiz_case_ion_crc32();
+void quiz_case_ion_events_from_keyboard();
+void quiz_case_ion_exam_mode_uninitialized();
+void quiz_case_ion_exam_mode();
+void quiz_case_ion_keyboard();
+void quiz_case_ion_persisting_bytes();
+void quiz_case_escher_ring_buffer();
+void quiz_case_ion_storage_records_crc32();
+void quiz_case_ion_storage_store_and_destroy_record();
+void quiz_case_ion_storage_put_record_twice();
+void quiz_case_ion_storage_invalid_renaming();
+void quiz_case_ion_storage_valid_renaming();
+void quiz_case_ion_storage_available_space_moving();
+void quiz_case_ion_storage_record_name_verifier();
+void quiz_case_ion_storage_many_records();
+void quiz_case_ion_utf8_code_point_system_parentheses();
+void quiz_case_ion_utf8_decode_forward();
+void quiz_case_ion_utf8_decode_backwards();
+void quiz_case_ion_utf8_decoder_next_glyph();
+void quiz_case_ion_utf8_decoder_previous_glyph();
+void quiz_case_ion_utf8_decoder_code_point();
+void quiz_case_ion_utf8_helper_count_occurrences();
+void quiz_case_ion_utf8_helper_code_point_search();
+void quiz_case_ion_utf8_helper_not_code_point_search();
+void quiz_case_ion_utf8_copy_and_remove_code_point();
+void quiz_case_ion_utf8_remove_code_point();
+void quiz_case_ion_utf8_move_string_from_index_by_number_of_char();
+void quiz_case_ion_utf8_try_and_replace_pattern_in_string_by_pattern();
+void quiz_case_ion_utf8_helper_copy_until_code_point();
+void quiz_case_ion_utf8_helper_previous_code_point_is();
+void quiz_case_ion_utf8_helper_code_point_is();
+void quiz_case_ion_utf8_helper_remove_previous_glyph();
+void quiz_case_ion_utf8_code_point_at_glyph_offset();
+void quiz_case_ion_utf8_glyph_offset_at_code_point();
+void quiz_case_ion_utf8_helper_string_codepoint_length();
+void quiz_case_ion_utf8_helper_string_glyph_length();
+void quiz_case_ion_utf8_helper_beginning_of_word();
+void quiz_case_ion_utf8_helper_end_of_word();
+void quiz_case_ion_utf8_helper_is_prefix();
+void quiz_case_kandinsky_color_rgb();
+void quiz_case_kandinsky_color_blend();
+void quiz_case_kandinsky_color_hsv();
+void quiz_case_kandinsky_font_index_for_code_point();
+void quiz_case_kandinsky_glyph_cache();
+void quiz_case_kandinsky_rect_intersect();
+void quiz_case_kandinsky_rect_union();
+void quiz_case_kandinsky_rect_empty_union();
+void quiz_case_kandinsky_rect_difference();
+void quiz_case_tree_handle_are_discared_after_block();
+void quiz_case_tree_handle_are_discared_after_function_call();
+void quiz_case_tree_handle_can_be_copied();
+void quiz_case_tree_handle_can_be_moved();
+void quiz_case_tree_handle_can_be_returned();
+void quiz_case_tree_handle_memory_failure();
+void quiz_case_tree_handle_survive_memory_failure();
+void quiz_case_tree_handle_does_not_copy();
+void quiz_case_poincare_approximation_decimal();
+void quiz_case_poincare_approximation_based_integer();
+void quiz_case_poincare_approximation_rational();
+void quiz_case_poincare_approximation_float();
+void quiz_case_poincare_approximation_infinity();
+void quiz_case_poincare_approximation_addition();
+void quiz_case_poincare_approximation_multiplication();
+void quiz_case_poincare_approximation_power();
+void quiz_case_poincare_approximation_subtraction();
+void quiz_case_poincare_approximation_constant();
+void quiz_case_poincare_approximation_division();
+void quiz_case_poincare_approximation_logarithm();
+void quiz_case_poincare_approximation_function();
+void quiz_case_poincare_approximation_unique_random();
+void quiz_case_poincare_approximation_integral();
+void quiz_case_poincare_approximation_trigonometry_functions();
+void quiz_case_poincare_approximation_matrix();
+void quiz_case_poincare_approximation_list();
+void quiz_case_poincare_approximation_list_sequence();
+void quiz_case_poincare_approximation_map_on_list();
+void quiz_case_poincare_approximation_probability();
+void quiz_case_poincare_approximation_complex_format();
+void quiz_case_poincare_approximation_mix();
+void quiz_case_poincare_approximation_lists_access();
+void quiz_case_poincare_approximation_lists_functions();
+void quiz_case_poincare_approximation_mixed_fraction();
+void quiz_case_poincare_approximation_floor_ceil_integer();
+void quiz_case_poincare_approximation_booleans();
+void quiz_case_poincare_approximation_piecewise_operator();
+void quiz_case_poincare_approximation_point();
+void quiz_case_poincare_approximation_keeping_symbols();
+void quiz_case_poincare_approximation_program();
+void quiz_case_poincare_arithmetic_gcd();
+void quiz_case_poincare_arithmetic_lcm();
+void quiz_case_poincare_arithmetic_factorization();
+void quiz_case_poincare_arithmetic_divisors();
+void quiz_case_poincare_conics_canonic();
+void quiz_case_poincare_conics_invalid();
+void quiz_case_poincare_conics_general();
+void quiz_case_poincare_conics_reduction();
+void quiz_case_poincare_context_user_variable_simple();
+void quiz_case_poincare_context_user_variable_2_circular_variables();
+void quiz_case_poincare_context_user_variable_3_circular_variables();
+void quiz_case_poincare_context_user_variable_1_circular_function();
+void quiz_case_poincare_context_user_variable_2_circular_functions();
+void quiz_case_poincare_context_user_variable_3_circular_functions();
+void quiz_case_poincare_context_user_variable_circular_variables_and_functions();
+void quiz_case_poincare_context_user_variable_composed_functions();
+void quiz_case_poincare_context_user_variable_properties();
+void quiz_case_poincare_context_function_evaluate_at_undef();
+void quiz_case_erf_inv();
+void quiz_case_poincare_exam_modes();
+void quiz_case_poincare_no_dependency();
+void quiz_case_poincare_dependency_function();
+void quiz_case_poincare_dependency_derivative();
+void quiz_case_poincare_dependency_parametered_expression();
+void quiz_case_poincare_dependency_sequence();
+void quiz_case_poincare_dependency_power();
+void quiz_case_poincare_dependency_multiplication();
+void quiz_case_poincare_dependency_trigonometry();
+void quiz_case_poincare_derivative_formal();
+void quiz_case_poincare_derivative_formal_higher_order();
+void quiz_case_poincare_derivative_reduced_approximation();
+void quiz_case_poincare_derivative_approximation();
+void quiz_case_poincare_derivative_approximation_higher_order();
+void quiz_case_poincare_student_distribution();
+void quiz_case_probability_chi2_law();
+void quiz_case_poincare_normal_distribution_find_parameters();
+void quiz_case_poincare_discrete_distributions();
+void quiz_case_poincare_expression_can_start_uninitialized();
+void quiz_case_poincare_expression_can_be_copied_even_if_uninitialized();
+void quiz_case_poincare_expression_cast_does_not_copy();
+void quiz_case_poincare_expression_decimal_constructor();
+void quiz_case_poincare_expression_rational_constructor();
+void quiz_case_poincare_expression_constant_constructor();
+void quiz_case_poincare_expression_unit_constructor();
+void quiz_case_poincare_number_of_numerical_values();
+void quiz_case_poincare_expression_generalization();
+void quiz_case_poincare_expression_order_constant();
+void quiz_case_poincare_expression_order_decimal();
+void quiz_case_poincare_expression_order_rational();
+void quiz_case_poincare_expression_order_float();
+void quiz_case_poincare_expression_order_power();
+void quiz_case_poincare_expression_order_symbol();
+void quiz_case_poincare_expression_order_function();
+void quiz_case_poincare_expression_order_mix();
+void quiz_case_poincare_expression_order_addition_multiplication();
+void quiz_case_poincare_properties_is_number();
+void quiz_case_poincare_properties_is_number_zero();
+void quiz_case_poincare_properties_is_random();
+void quiz_case_poincare_properties_is_parametered_expression();
+void quiz_case_poincare_properties_is_rational_number();
+void quiz_case_poincare_properties_is_approximate();
+void quiz_case_poincare_properties_is_matrix();
+void quiz_case_poincare_properties_deep_is_matrix();
+void quiz_case_poincare_properties_is_infinity();
+void quiz_case_poincare_properties_decimal_sign();
+void quiz_case_poincare_properties_based_integer_sign();
+void quiz_case_poincare_properties_rational_sign();
+void quiz_case_poincare_properties_expression_sign();
+void quiz_case_poincare_properties_sign();
+void quiz_case_poincare_properties_set_sign_positive();
+void quiz_case_poincare_properties_is_real();
+void quiz_case_poincare_properties_polynomial_degree();
+void quiz_case_poincare_properties_get_variables();
+void quiz_case_poincare_properties_get_polynomial_coefficients();
+void quiz_case_poincare_properties_remove_unit();
+void quiz_case_poincare_expression_additional_results();
+void quiz_case_poincare_expression_children_list_length();
+void quiz_case_poincare_expression_list_of_points();
+void quiz_case_poincare_expression_continuous();
+void quiz_case_poincare_expression_is_linear_combination_of_pattern();
+void quiz_case_poincare_expression_deep_is_symbolic();
+void quiz_case_poincare_serialization_based_integer();
+void quiz_case_poincare_serialization_rational();
+void quiz_case_poincare_serialization_decimal();
+void quiz_case_poincare_serialization_float();
+void quiz_case_poincare_serialization_division();
+void quiz_case_poincare_serialization_factorial();
+void quiz_case_poincare_serialization_percent();
+void quiz_case_poincare_expression_to_layout();
+void quiz_case_poincare_expression_to_layout_multiplication_operator();
+void quiz_case_poincare_expression_to_layout_implicit_addition();
+void quiz_case_poincare_expression_to_layout_serializes_to_self();
+void quiz_case_poincare_expression_to_layout_mixed_fraction();
+void quiz_case_poincare_solver_roots();
+void quiz_case_poincare_solver_minima();
+void quiz_case_poincare_solver_maxima();
+void quiz_case_poincare_solver_intersections();
+void quiz_case_poincare_helpers_gcd();
+void quiz_case_poincare_helpers_insert_simple_swap();
+void quiz_case_poincare_helpers_rotate();
+void quiz_case_poincare_helpers_sort();
+void quiz_case_poincare_input_beautification_after_inserting_text();
+void quiz_case_poincare_input_beautification_after_inserting_layout();
+void quiz_case_poincare_input_beautification_derivative();
+void quiz_case_poincare_integer_constructor();
+void quiz_case_poincare_integer_compare();
+void quiz_case_poincare_integer_properties();
+void quiz_case_poincare_integer_addition();
+void quiz_case_poincare_integer_subtraction();
+void quiz_case_poincare_integer_multiplication();
+void quiz_case_poincare_integer_divide();
+void quiz_case_poincare_integer_pow();
+void quiz_case_poincare_integer_factorial();
+void quiz_case_poincare_integer_evaluate();
+void quiz_case_poincare_integer_serialize();
+void quiz_case_poincare_integer_euclidian_division();
+void quiz_case_poincare_integer_mixed_fraction();
+void quiz_case_poincare_layout_constructors();
+void quiz_case_poincare_layout_comparison();
+void quiz_case_poincare_layout_fraction_create();
+void quiz_case_poincare_layout_power();
+void quiz_case_poincare_layout_cursor_layout_to_point();
+void quiz_case_poincare_layout_cursor_delete();
+void quiz_case_poincare_layout_parentheses();
+void quiz_case_poincare_layout_cursor_sizes_invalidation();
+void quiz_case_poincare_layout_serialization();
+void quiz_case_poincare_layout_to_expression_unparsable();
+void quiz_case_poincare_layout_to_expression_parsable();
+void quiz_case_poincare_matrix_rank();
+void quiz_case_poincare_matrix_undef();
+void quiz_case_poincare_matrix_float_children();
+void quiz_case_poincare_parsing_tokenize_numbers();
+void quiz_case_poincare_parsing_memory_exhaustion();
+void quiz_case_poincare_parsing_parse_numbers();
+void quiz_case_poincare_parsing_parse();
+void quiz_case_poincare_parsing_matrices();
+void quiz_case_poincare_parsing_lists();
+void quiz_case_poincare_parsing_lists_access();
+void quiz_case_poincare_parsing_constants();
+void quiz_case_poincare_parsing_units();
+void quiz_case_poincare_parsing_identifiers();
+void quiz_case_poincare_parsing_parse_store();
+void quiz_case_poincare_parsing_parse_unit_convert();
+void quiz_case_poincare_parsing_implicit_multiplication();
+void quiz_case_poincare_parsing_adding_missing_parentheses();
+void quiz_case_poincare_parsing_mixed_fraction();
+void quiz_case_poincare_parsing_function_assignment();
+void quiz_case_poincare_parsing_east_arrows();
+void quiz_case_poincare_parsing_logic();
+void quiz_case_poincare_parsing_points();
+void quiz_case_poincare_points_of_interest_list();
+void quiz_case_poincare_polynomial_roots_quadratic();
+void quiz_case_poincare_polynomial_roots_cubic();
+void quiz_case_poincare_print_custom_print();
+void quiz_case_assert_print_floats();
+void quiz_case_poincare_print_int_left();
+void quiz_case_poincare_print_int_right();
+void quiz_case_poincare_range_1d_validity();
+void quiz_case_poincare_range_1d_geometry();
+void quiz_case_poincare_range_1d_extend();
+void quiz_case_poincare_range_1d_zoom();
+void quiz_case_poincare_rational_order();
+void quiz_case_poincare_rational_specific_properties();
+void quiz_case_poincare_rational_addition();
+void quiz_case_poincare_rational_power();
+void quiz_case_regularized_incomplete_beta_function();
+void quiz_case_probability_regularized_gamma();
+void quiz_case_poincare_simplification_based_integer();
+void quiz_case_poincare_simplification_decimal();
+void quiz_case_poincare_simplification_rational();
+void quiz_case_poincare_simplification_infinity();
+void quiz_case_poincare_simplification_addition();
+void quiz_case_poincare_simplification_multiplication();
+void quiz_case_poincare_simplification_constants();
+void quiz_case_poincare_simplification_units();
+void quiz_case_poincare_simplification_power();
+void quiz_case_poincare_simplification_factorial();
+void quiz_case_poincare_simplification_percent();
+void quiz_case_poincare_simplification_logarithm();
+void quiz_case_poincare_simplification_random();
+void quiz_case_poincare_simplification_randint();
+void quiz_case_poincare_simplification_function();
+void quiz_case_poincare_simplification_trigonometry_functions();
+void quiz_case_poincare_simplification_matrix();
+void quiz_case_poincare_simplification_functions_of_matrices();
+void quiz_case_poincare_simplification_store();
+void quiz_case_poincare_simplification_store_matrix();
+void quiz_case_poincare_simplification_store_correctly_parsed();
+void quiz_case_poincare_simplification_unit_convert();
+void quiz_case_poincare_simplification_complex_format();
+void quiz_case_poincare_simplification_reduction_target();
+void quiz_case_poincare_simplification_unit_conversion();
+void quiz_case_poincare_simplification_user_function();
+void quiz_case_poincare_simplification_mix();
+void quiz_case_poincare_hyperbolic_trigonometry();
+void quiz_case_poincare_advanced_trigonometry();
+void quiz_case_poincare_probability();
+void quiz_case_poincare_simplification_system_circuit_breaker_handled();
+void quiz_case_poincare_simplification_list();
+void quiz_case_poincare_simplification_functions_of_lists();
+void quiz_case_poincare_simplification_mix_lists();
+void quiz_case_poincare_simplification_mixed_fraction();
+void quiz_case_poincare_simplification_booleans();
+void quiz_case_poincare_simplification_comparison_operators();
+void quiz_case_poincare_simplification_logical_operators();
+void quiz_case_poincare_simplification_piecewise_operator();
+void quiz_case_poincare_simplification_integral();
+void quiz_case_poincare_simplification_point();
+void quiz_case_poincare_simplification_reduction_cache();
+void quiz_case_poincare_zoom_fit_points_of_interest();
+void quiz_case_poincare_zoom_fit_intersections();
+void quiz_case_poincare_zoom_fit_magnitude_in_batch();
+void quiz_case_poincare_zoom_sanitation();
+void quiz_case_python_basics();
+void quiz_case_python_built_in();
+void quiz_case_python_template();
+void quiz_case_python_fixes();
+void quiz_case_python_compiled_module_cache();
+void quiz_case_python_native_emitters();
+void quiz_case_python_ion_import();
+void quiz_case_python_ion_keydown();
+void quiz_case_python_kandinsky_import();
+void quiz_case_python_kandinsky_basics();
+void quiz_case_python_kandinsky_pixels();
+void quiz_case_python_math();
+void quiz_case_python_cmath();
+void quiz_case_python_numpy();
+void quiz_case_python_random();
+void quiz_case_python_time();
+void quiz_case_python_turtle();
+void quiz_case_python_turtle_circle();
+void quiz_case_python_matplotlib_pyplot_import();
+void quiz_case_python_matplotlib_pyplot_arrow();
+void quiz_case_python_matplotlib_pyplot_axis();
+void quiz_case_python_matplotlib_pyplot_bar();
+void quiz_case_python_matplotlib_pyplot_grid();
+void quiz_case_python_matplotlib_pyplot_hist();
+void quiz_case_python_matplotlib_pyplot_plot();
+void quiz_case_python_matplotlib_pyplot_scatter();
+void quiz_case_python_matplotlib_pyplot_text();
+void quiz_case_escher_clipboard_stored_text_is_parseable();
+void quiz_case_escher_layout_field_select_left_right();
+void quiz_case_escher_layout_field_select_up_down();
+void quiz_case_escher_layout_field_unselect();
+void quiz_case_escher_layout_field_delete();
+void quiz_case_omg_bit_helper();
+void quiz_case_omg_print_integer();
+void quiz_case_omg_signaling_nan();
+void quiz_case_alignment_handling();
+void quiz_case_interval_values();
+void quiz_case_calculation_store();
+void quiz_case_calculation_ans();
+void quiz_case_calculation_significant_digits();
+void quiz_case_calculation_display_exact_approximate();
+void quiz_case_calculation_symbolic_computation();
+void quiz_case_calculation_symbolic_computation_and_parametered_expressions();
+void quiz_case_calculation_complex_format();
+void quiz_case_calculation_involving_sequence();
+void quiz_case_calculation_additional_results();
+void quiz_case_graph_caching();
+void quiz_case_graph_caches_lending();
+void quiz_case_graph_function_properties();
+void quiz_case_graph_function_properties_with_predefined_variables();
+void quiz_case_code_clipboard_enters_and_exits_python();
+void quiz_case_variable_box_controller();
+void quiz_case_data_statistics();
+void quiz_case_data_statistics_multiple_series();
+void quiz_case_data_statistics_histograms();
+void quiz_case_probability_binomial_distribution();
+void quiz_case_probability_uniform_distribution();
+void quiz_case_probability_exponential_distribution();
+void quiz_case_probability_poisson_distribution();
+void quiz_case_probability_chi_squared_distribution();
+void quiz_case_probability_student_distribution();
+void quiz_case_probability_geometric_distribution();
+void quiz_case_probability_normal_distribution();
+void quiz_case_probability_fisher_distribution();
+void quiz_case_probability_one_proportion_statistic();
+void quiz_case_probability_one_mean_t_statistic();
+void quiz_case_probability_one_mean_z_statistic();
+void quiz_case_probability_two_proportions_statistic();
+void quiz_case_probability_two_means_t_statistic();
+void quiz_case_probability_pooled_t_test();
+void quiz_case_probability_two_means_z_statistic();
+void quiz_case_probability_goodness_test();
+void quiz_case_probability_homogeneity_test();
+void quiz_case_probability_slope_t_statistic();
+void quiz_case_solver_error();
+void quiz_case_solver_linear_system();
+void quiz_case_solver_polynomial_system();
+void quiz_case_solver_approximate();
+void quiz_case_solver_complex_real();
+void quiz_case_solver_complex_cartesian();
+void quiz_case_solver_complex_polar();
+void quiz_case_solver_symbolic_computation();
+void quiz_case_sequence_evaluation();
+void quiz_case_sequence_context();
+void quiz_case_sequence_order();
+void quiz_case_sequence_sum_evaluation();
+void quiz_case_sequence_rank_checkpoints();
+void quiz_case_sequence_affine_recurrence();
+void quiz_case_sequence_suitable_for_cobweb();
+void quiz_case_regression_linear();
+void quiz_case_regression_linear_2();
+void quiz_case_regression_proportional();
+void quiz_case_regression_proportional_2();
+void quiz_case_regression_proportional_3();
+void quiz_case_regression_proportional_4();
+void quiz_case_regression_proportional_5();
+void quiz_case_regression_quadratic();
+void quiz_case_regression_cubic();
+void quiz_case_regression_quartic();
+void quiz_case_regression_logarithmic();
+void quiz_case_regression_exponential();
+void quiz_case_regression_exponential_2();
+void quiz_case_regression_exponential_3();
+void quiz_case_regression_exponential_4();
+void quiz_case_regression_exponential_5();
+void quiz_case_regression_exponential_abx();
+void quiz_case_regression_power();
+void quiz_case_regression_median_0();
+void quiz_case_regression_median_1();
+void quiz_case_regression_median_2();
+void quiz_case_regression_trigonometric_1();
+void quiz_case_regression_trigonometric_2();
+void quiz_case_regression_trigonometric_3();
+void quiz_case_regression_trigonometric_4();
+void quiz_case_regression_trigonometric_4_bis();
+void quiz_case_regression_logistic();
+void quiz_case_regression_column_calculation();
+void quiz_case_regression_constant_column_calculation();
+void quiz_case_regression_calculation();
+void quiz_case_finance_simple_interest();
+void quiz_case_finance_compound_interest();
+
+QuizCase quiz_cases[] = {
+  quiz_case_ion_crc32,
+  quiz_case_ion_events_from_keyboard,
+  quiz_case_ion_exam_mode_uninitialized,
+  quiz_case_ion_exam_mode,
+  quiz_case_ion_keyboard,
+  quiz_case_ion_persisting_bytes,
+  quiz_case_escher_ring_buffer,
+  quiz_case_ion_storage_records_crc32,
+  quiz_case_ion_storage_store_and_destroy_record,
+  quiz_case_ion_storage_put_record_twice,
+  quiz_case_ion_storage_invalid_renaming,
+  quiz_case_ion_storage_valid_renaming,
+  quiz_case_ion_storage_available_space_moving,
+  quiz_case_ion_storage_record_name_verifier,
+  quiz_case_ion_storage_many_records,
+  quiz_case_ion_utf8_code_point_system_parentheses,
+  quiz_case_ion_utf8_decode_forward,
+  quiz_case_ion_utf8_decode_backwards,
+  quiz_case_ion_utf8_decoder_next_glyph,
+  quiz_case_ion_utf8_decoder_previous_glyph,
+  quiz_case_ion_utf8_decoder_code_point,
+  quiz_case_ion_utf8_helper_count_occurrences,
+  quiz_case_ion_utf8_helper_code_point_search,
+  quiz_case_ion_utf8_helper_not_code_point_search,
+  quiz_case_ion_utf8_copy_and_remove_code_point,
+  quiz_case_ion_utf8_remove_code_point,
+  quiz_case_ion_utf8_move_string_from_index_by_number_of_char,
+  quiz_case_ion_utf8_try_and_replace_pattern_in_string_by_pattern,
+  quiz_case_ion_utf8_helper_copy_until_code_point,
+  quiz_case_ion_utf8_helper_previous_code_point_is,
+  quiz_case_ion_utf8_helper_code_point_is,
+  quiz_case_ion_utf8_helper_remove_previous_glyph,
+  quiz_case_ion_utf8_code_point_at_glyph_offset,
+  quiz_case_ion_utf8_glyph_offset_at_code_point,
+  quiz_case_ion_utf8_helper_string_codepoint_length,
+  quiz_case_ion_utf8_helper_string_glyph_length,
+  quiz_case_ion_utf8_helper_beginning_of_word,
+  quiz_case_ion_utf8_helper_end_of_word,
+  quiz_case_ion_utf8_helper_is_prefix,
+  quiz_case_kandinsky_color_rgb,
+  quiz_case_kandinsky_color_blend,
+  quiz_case_kandinsky_color_hsv,
+  quiz_case_kandinsky_font_index_for_code_point,
+  quiz_case_kandinsky_glyph_cache,
+  quiz_case_kandinsky_rect_intersect,
+  quiz_case_kandinsky_rect_union,
+  quiz_case_kandinsky_rect_empty_union,
+  quiz_case_kandinsky_rect_difference,
+  quiz_case_tree_handle_are_discared_after_block,
+  quiz_case_tree_handle_are_discared_after_function_call,
+  quiz_case_tree_handle_can_be_copied,
+  quiz_case_tree_handle_can_be_moved,
+  quiz_case_tree_handle_can_be_returned,
+  quiz_case_tree_handle_memory_failure,
+  quiz_case_tree_handle_survive_memory_failure,
+  quiz_case_tree_handle_does_not_copy,
+  quiz_case_poincare_approximation_decimal,
+  quiz_case_poincare_approximation_based_integer,
+  quiz_case_poincare_approximation_rational,
+  quiz_case_poincare_approximation_float,
+  quiz_case_poincare_approximation_infinity,
+  quiz_case_poincare_approximation_addition,
+  quiz_case_poincare_approximation_multiplication,
+  quiz_case_poincare_approximation_power,
+  quiz_case_poincare_approximation_subtraction,
+  quiz_case_poincare_approximation_constant,
+  quiz_case_poincare_approximation_division,
+  quiz_case_poincare_approximation_logarithm,
+  quiz_case_poincare_approximation_function,
+  quiz_case_poincare_approximation_unique_random,
+  quiz_case_poincare_approximation_integral,
+  quiz_case_poincare_approximation_trigonometry_functions,
+  quiz_case_poincare_approximation_matrix,
+  quiz_case_poincare_approximation_list,
+  quiz_case_poincare_approximation_list_sequence,
+  quiz_case_poincare_approximation_map_on_list,
+  quiz_case_poincare_approximation_probability,
+  quiz_case_poincare_approximation_complex_format,
+  quiz_case_poincare_approximation_mix,
+  quiz_case_poincare_approximation_lists_access,
+  quiz_case_poincare_approximation_lists_functions,
+  quiz_case_poincare_approximation_mixed_fraction,
+  quiz_case_poincare_approximation_floor_ceil_integer,
+  quiz_case_poincare_approximation_booleans,
+  quiz_case_poincare_approximation_piecewise_operator,
+  quiz_case_poincare_approximation_point,
+  quiz_case_poincare_approximation_keeping_symbols,
+  quiz_case_poincare_approximation_program,
+  quiz_case_poincare_arithmetic_gcd,
+  quiz_case_poincare_arithmetic_lcm,
+  quiz_case_poincare_arithmetic_factorization,
+  quiz_case_poincare_arithmetic_divisors,
+  quiz_case_poincare_conics_canonic,
+  quiz_case_poincare_conics_invalid,
+  quiz_case_poincare_conics_general,
+  quiz_case_poincare_conics_reduction,
+  quiz_case_poincare_context_user_variable_simple,
+  quiz_case_poincare_context_user_variable_2_circular_variables,
+  quiz_case_poincare_context_user_variable_3_circular_variables,
+  quiz_case_poincare_context_user_variable_1_circular_function,
+  quiz_case_poincare_context_user_variable_2_circular_functions,
+  quiz_case_poincare_context_user_variable_3_circular_functions,
+  quiz_case_poincare_context_user_variable_circular_variables_and_functions,
+  quiz_case_poincare_context_user_variable_composed_functions,
+  quiz_case_poincare_context_user_variable_properties,
+  quiz_case_poincare_context_function_evaluate_at_undef,
+  quiz_case_erf_inv,
+  quiz_case_poincare_exam_modes,
+  quiz_case_poincare_no_dependency,
+  quiz_case_poincare_dependency_function,
+  quiz_case_poincare_dependency_derivative,
+  quiz_case_poincare_dependency_parametered_expression,
+  quiz_case_poincare_dependency_sequence,
+  quiz_case_poincare_dependency_power,
+  quiz_case_poincare_dependency_multiplication,
+  quiz_case_poincare_dependency_trigonometry,
+  quiz_case_poincare_derivative_formal,
+  quiz_case_poincare_derivative_formal_higher_order,
+  quiz_case_poincare_derivative_reduced_approximation,
+  quiz_case_poincare_derivative_approximation,
+  quiz_case_poincare_derivative_approximation_higher_order,
+  quiz_case_poincare_student_distribution,
+  quiz_case_probability_chi2_law,
+  quiz_case_poincare_normal_distribution_find_parameters,
+  quiz_case_poincare_discrete_distributions,
+  quiz_case_poincare_expression_can_start_uninitialized,
+  quiz_case_poincare_expression_can_be_copied_even_if_uninitialized,
+  quiz_case_poincare_expression_cast_does_not_copy,
+  quiz_case_poincare_expression_decimal_constructor,
+  quiz_case_poincare_expression_rational_constructor,
+  quiz_case_poincare_expression_constant_constructor,
+  quiz_case_poincare_expression_unit_constructor,
+  quiz_case_poincare_number_of_numerical_values,
+  quiz_case_poincare_expression_generalization,
+  quiz_case_poincare_expression_order_constant,
+  quiz_case_poincare_expression_order_decimal,
+  quiz_case_poincare_expression_order_rational,
+  quiz_case_poincare_expression_order_float,
+  quiz_case_poincare_expression_order_power,
+  quiz_case_poincare_expression_order_symbol,
+  quiz_case_poincare_expression_order_function,
+  quiz_case_poincare_expression_order_mix,
+  quiz_case_poincare_expression_order_addition_multiplication,
+  quiz_case_poincare_properties_is_number,
+  quiz_case_poincare_properties_is_number_zero,
+  quiz_case_poincare_properties_is_random,
+  quiz_case_poincare_properties_is_parametered_expression,
+  quiz_case_poincare_properties_is_rational_number,
+  quiz_case_poincare_properties_is_approximate,
+  quiz_case_poincare_properties_is_matrix,
+  quiz_case_poincare_properties_deep_is_matrix,
+  quiz_case_poincare_properties_is_infinity,
+  quiz_case_poincare_properties_decimal_sign,
+  quiz_case_poincare_properties_based_integer_sign,
+  quiz_case_poincare_properties_rational_sign,
+  quiz_case_poincare_properties_expression_sign,
+  quiz_case_poincare_properties_sign,
+  quiz_case_poincare_properties_set_sign_positive,
+  quiz_case_poincare_properties_is_real,
+  quiz_case_poincare_properties_polynomial_degree,
+  quiz_case_poincare_properties_get_variables,
+  quiz_case_poincare_properties_get_polynomial_coefficients,
+  quiz_case_poincare_properties_remove_unit,
+  quiz_case_poincare_expression_additional_results,
+  quiz_case_poincare_expression_children_list_length,
+  quiz_case_poincare_expression_list_of_points,
+  quiz_case_poincare_expression_continuous,
+  quiz_case_poincare_expression_is_linear_combination_of_pattern,
+  quiz_case_poincare_expression_deep_is_symbolic,
+  quiz_case_poincare_serialization_based_integer,
+  quiz_case_poincare_serialization_rational,
+  quiz_case_poincare_serialization_decimal,
+  quiz_case_poincare_serialization_float,
+  quiz_case_poincare_serialization_division,
+  quiz_case_poincare_serialization_factorial,
+  quiz_case_poincare_serialization_percent,
+  quiz_case_poincare_expression_to_layout,
+  quiz_case_poincare_expression_to_layout_multiplication_operator,
+  quiz_case_poincare_expression_to_layout_implicit_addition,
+  quiz_case_poincare_expression_to_layout_serializes_to_self,
+  quiz_case_poincare_expression_to_layout_mixed_fraction,
+  quiz_case_poincare_solver_roots,
+  quiz_case_poincare_solver_minima,
+  quiz_case_poincare_solver_maxima,
+  quiz_case_poincare_solver_intersections,
+  quiz_case_poincare_helpers_gcd,
+  quiz_case_poincare_helpers_insert_simple_swap,
+  quiz_case_poincare_helpers_rotate,
+  quiz_case_poincare_helpers_sort,
+  quiz_case_poincare_input_beautification_after_inserting_text,
+  quiz_case_poincare_input_beautification_after_inserting_layout,
+  quiz_case_poincare_input_beautification_derivative,
+  quiz_case_poincare_integer_constructor,
+  quiz_case_poincare_integer_compare,
+  quiz_case_poincare_integer_properties,
+  quiz_case_poincare_integer_addition,
+  quiz_case_poincare_integer_subtraction,
+  quiz_case_poincare_integer_multiplication,
+  quiz_case_poincare_integer_divide,
+  quiz_case_poincare_integer_pow,
+  quiz_case_poincare_integer_factorial,
+  quiz_case_poincare_integer_evaluate,
+  quiz_case_poincare_integer_serialize,
+  quiz_case_poincare_integer_euclidian_division,
+  quiz_case_poincare_integer_mixed_fraction,
+  quiz_case_poincare_layout_constructors,
+  quiz_case_poincare_layout_comparison,
+  quiz_case_poincare_layout_fraction_create,
+  quiz_case_poincare_layout_power,
+  quiz_case_poincare_layout_cursor_layout_to_point,
+  quiz_case_poincare_layout_cursor_delete,
+  quiz_case_poincare_layout_parentheses,
+  quiz_case_poincare_layout_cursor_sizes_invalidation,
+  quiz_case_poincare_layout_serialization,
+  quiz_case_poincare_layout_to_expression_unparsable,
+  quiz_case_poincare_layout_to_expression_parsable,
+  quiz_case_poincare_matrix_rank,
+  quiz_case_poincare_matrix_undef,
+  quiz_case_poincare_matrix_float_children,
+  quiz_case_poincare_parsing_tokenize_numbers,
+  quiz_case_poincare_parsing_memory_exhaustion,
+  quiz_case_poincare_parsing_parse_numbers,
+  quiz_case_poincare_parsing_parse,
+  quiz_case_poincare_parsing_matrices,
+  quiz_case_poincare_parsing_lists,
+  quiz_case_poincare_parsing_lists_access,
+  quiz_case_poincare_parsing_constants,
+  quiz_case_poincare_parsing_units,
+  quiz_case_poincare_parsing_identifiers,
+  quiz_case_poincare_parsing_parse_store,
+  quiz_case_poincare_parsing_parse_unit_convert,
+  quiz_case_poincare_parsing_implicit_multiplication,
+  quiz_case_poincare_parsing_adding_missing_parentheses,
+  quiz_case_poincare_parsing_mixed_fraction,
+  quiz_case_poincare_parsing_function_assignment,
+  quiz_case_poincare_parsing_east_arrows,
+  quiz_case_poincare_parsing_logic,
+  quiz_case_poincare_parsing_points,
+  quiz_case_poincare_points_of_interest_list,
+  quiz_case_poincare_polynomial_roots_quadratic,
+  quiz_case_poincare_polynomial_roots_cubic,
+  quiz_case_poincare_print_custom_print,
+  quiz_case_assert_print_floats,
+  quiz_case_poincare_print_int_left,
+  quiz_case_poincare_print_int_right,
+  quiz_case_poincare_range_1d_validity,
+  quiz_case_poincare_range_1d_geometry,
+  quiz_case_poincare_range_1d_extend,
+  quiz_case_poincare_range_1d_zoom,
+  quiz_case_poincare_rational_order,
+  quiz_case_poincare_rational_specific_properties,
+  quiz_case_poincare_rational_addition,
+  quiz_case_poincare_rational_power,
+  quiz_case_regularized_incomplete_beta_function,
+  quiz_case_probability_regularized_gamma,
+  quiz_case_poincare_simplification_based_integer,
+  quiz_case_poincare_simplification_decimal,
+  quiz_case_poincare_simplification_rational,
+  quiz_case_poincare_simplification_infinity,
+  quiz_case_poincare_simplification_addition,
+  quiz_case_poincare_simplification_multiplication,
+  quiz_case_poincare_simplification_constants,
+  quiz_case_poincare_simplification_units,
+  quiz_case_poincare_simplification_power,
+  quiz_case_poincare_simplification_factorial,
+  quiz_case_poincare_simplification_percent,
+  quiz_case_poincare_simplification_logarithm,
+  quiz_case_poincare_simplification_random,
+  quiz_case_poincare_simplification_randint,
+  quiz_case_poincare_simplification_function,
+  quiz_case_poincare_simplification_trigonometry_functions,
+  quiz_case_poincare_simplification_matrix,
+  quiz_case_poincare_simplification_functions_of_matrices,
+  quiz_case_poincare_simplification_store,
+  quiz_case_poincare_simplification_store_matrix,
+  quiz_case_poincare_simplification_store_correctly_parsed,
+  quiz_case_poincare_simplification_unit_convert,
+  quiz_case_poincare_simplification_complex_format,
+  quiz_case_poincare_simplification_reduction_target,
+  quiz_case_poincare_simplification_unit_conversion,
+  quiz_case_poincare_simplification_user_function,
+  quiz_case_poincare_simplification_mix,
+  quiz_case_poincare_hyperbolic_trigonometry,
+  quiz_case_poincare_advanced_trigonometry,
+  quiz_case_poincare_probability,
+  quiz_case_poincare_simplification_system_circuit_breaker_handled,
+  quiz_case_poincare_simplification_list,
+  quiz_case_poincare_simplification_functions_of_lists,
+  quiz_case_poincare_simplification_mix_lists,
+  quiz_case_poincare_simplification_mixed_fraction,
+  quiz_case_poincare_simplification_booleans,
+  quiz_case_poincare_simplification_comparison_operators,
+  quiz_case_poincare_simplification_logical_operators,
+  quiz_case_poincare_simplification_piecewise_operator,
+  quiz_case_poincare_simplification_integral,
+  quiz_case_poincare_simplification_point,
+  quiz_case_poincare_simplification_reduction_cache,
+  quiz_case_poincare_zoom_fit_points_of_interest,
+  quiz_case_poincare_zoom_fit_intersections,
+  quiz_case_poincare_zoom_fit_magnitude_in_batch,
+  quiz_case_poincare_zoom_sanitation,
+  quiz_case_python_basics,
+  quiz_case_python_built_in,
+  quiz_case_python_template,
+  quiz_case_python_fixes,
+  quiz_case_python_compiled_module_cache,
+  quiz_case_python_native_emitters,
+  quiz_case_python_ion_import,
+  quiz_case_python_ion_keydown,
+  quiz_case_python_kandinsky_import,
+  quiz_case_python_kandinsky_basics,
+  quiz_case_python_kandinsky_pixels,
+  quiz_case_python_math,
+  quiz_case_python_cmath,
+  quiz_case_python_numpy,
+  quiz_case_python_random,
+  quiz_case_python_time,
+  quiz_case_python_turtle,
+  quiz_case_python_turtle_circle,
+  quiz_case_python_matplotlib_pyplot_import,
+  quiz_case_python_matplotlib_pyplot_arrow,
+  quiz_case_python_matplotlib_pyplot_axis,
+  quiz_case_python_matplotlib_pyplot_bar,
+  quiz_case_python_matplotlib_pyplot_grid,
+  quiz_case_python_matplotlib_pyplot_hist,
+  quiz_case_python_matplotlib_pyplot_plot,
+  quiz_case_python_matplotlib_pyplot_scatter,
+  quiz_case_python_matplotlib_pyplot_text,
+  quiz_case_escher_clipboard_stored_text_is_parseable,
+  quiz_case_escher_layout_field_select_left_right,
+  quiz_case_escher_layout_field_select_up_down,
+  quiz_case_escher_layout_field_unselect,
+  quiz_case_escher_layout_field_delete,
+  quiz_case_omg_bit_helper,
+  quiz_case_omg_print_integer,
+  quiz_case_omg_signaling_nan,
+  quiz_case_alignment_handling,
+  quiz_case_interval_values,
+  quiz_case_calculation_store,
+  quiz_case_calculation_ans,
+  quiz_case_calculation_significant_digits,
+  quiz_case_calculation_display_exact_approximate,
+  quiz_case_calculation_symbolic_computation,
+  quiz_case_calculation_symbolic_computation_and_parametered_expressions,
+  quiz_case_calculation_complex_format,
+  quiz_case_calculation_involving_sequence,
+  quiz_case_calculation_additional_results,
+  quiz_case_graph_caching,
+  quiz_case_graph_caches_lending,
+  quiz_case_graph_function_properties,
+  quiz_case_graph_function_properties_with_predefined_variables,
+  quiz_case_code_clipboard_enters_and_exits_python,
+  quiz_case_variable_box_controller,
+  quiz_case_data_statistics,
+  quiz_case_data_statistics_multiple_series,
+  quiz_case_data_statistics_histograms,
+  quiz_case_probability_binomial_distribution,
+  quiz_case_probability_uniform_distribution,
+  quiz_case_probability_exponential_distribution,
+  quiz_case_probability_poisson_distribution,
+  quiz_case_probability_chi_squared_distribution,
+  quiz_case_probability_student_distribution,
+  quiz_case_probability_geometric_distribution,
+  quiz_case_probability_normal_distribution,
+  quiz_case_probability_fisher_distribution,
+  quiz_case_probability_one_proportion_statistic,
+  quiz_case_probability_one_mean_t_statistic,
+  quiz_case_probability_one_mean_z_statistic,
+  quiz_case_probability_two_proportions_statistic,
+  quiz_case_probability_two_means_t_statistic,
+  quiz_case_probability_pooled_t_test,
+  quiz_case_probability_two_means_z_statistic,
+  quiz_case_probability_goodness_test,
+  quiz_case_probability_homogeneity_test,
+  quiz_case_probability_slope_t_statistic,
+  quiz_case_solver_error,
+  quiz_case_solver_linear_system,
+  quiz_case_solver_polynomial_system,
+  quiz_case_solver_approximate,
+  quiz_case_solver_complex_real,
+  quiz_case_solver_complex_cartesian,
+  quiz_case_solver_complex_polar,
+  quiz_case_solver_symbolic_computation,
+  quiz_case_sequence_evaluation,
+  quiz_case_sequence_context,
+  quiz_case_sequence_order,
+  quiz_case_sequence_sum_evaluation,
+  quiz_case_sequence_rank_checkpoints,
+  quiz_case_sequence_affine_recurrence,
+  quiz_case_sequence_suitable_for_cobweb,
+  quiz_case_regression_linear,
+  quiz_case_regression_linear_2,
+  quiz_case_regression_proportional,
+  quiz_case_regression_proportional_2,
+  quiz_case_regression_proportional_3,
+  quiz_case_regression_proportional_4,
+  quiz_case_regression_proportional_5,
+  quiz_case_regression_quadratic,
+  quiz_case_regression_cubic,
+  quiz_case_regression_quartic,
+  quiz_case_regression_logarithmic,
+  quiz_case_regression_exponential,
+  quiz_case_regression_exponential_2,
+  quiz_case_regression_exponential_3,
+  quiz_case_regression_exponential_4,
+  quiz_case_regression_exponential_5,
+  quiz_case_regression_exponential_abx,
+  quiz_case_regression_power,
+  quiz_case_regression_median_0,
+  quiz_case_regression_median_1,
+  quiz_case_regression_median_2,
+  quiz_case_regression_trigonometric_1,
+  quiz_case_regression_trigonometric_2,
+  quiz_case_regression_trigonometric_3,
+  quiz_case_regression_trigonometric_4,
+  quiz_case_regression_trigonometric_4_bis,
+  quiz_case_regression_logistic,
+  quiz_case_regression_column_calculation,
+  quiz_case_regression_constant_column_calculation,
+  quiz_case_regression_calculation,
+  quiz_case_finance_simple_interest,
+  quiz_case_finance_compound_interest,
+  NULL
+};
+
+char * quiz_case_names[] = {
+  "ion_crc32",
+  "ion_events_from_keyboard",
+  "ion_exam_mode_uninitialized",
+  "ion_exam_mode",
+  "ion_keyboard",
+  "ion_persisting_bytes",
+  "escher_ring_buffer",
+  "ion_storage_records_crc32",
+  "ion_storage_store_and_destroy_record",
+  "ion_storage_put_record_twice",
+  "ion_storage_invalid_renaming",
+  "ion_storage_valid_renaming",
+  "ion_storage_available_space_moving",
+  "ion_storage_record_name_verifier",
+  "ion_storage_many_records",
+  "ion_utf8_code_point_system_parentheses",
+  "ion_utf8_decode_forward",
+  "ion_utf8_decode_backwards",
+  "ion_utf8_decoder_next_glyph",
+  "ion_utf8_decoder_previous_glyph",
+  "ion_utf8_decoder_code_point",
+  "ion_utf8_helper_count_occurrences",
+  "ion_utf8_helper_code_point_search",
+  "ion_utf8_helper_not_code_point_search",
+  "ion_utf8_copy_and_remove_code_point",
+  "ion_utf8_remove_code_point",
+  "ion_utf8_move_string_from_index_by_number_of_char",
+  "ion_utf8_try_and_replace_pattern_in_string_by_pattern",
+  "ion_utf8_helper_copy_until_code_point",
+  "ion_utf8_helper_previous_code_point_is",
+  "ion_utf8_helper_code_point_is",
+  "ion_utf8_helper_remove_previous_glyph",
+  "ion_utf8_code_point_at_glyph_offset",
+  "ion_utf8_glyph_offset_at_code_point",
+  "ion_utf8_helper_string_codepoint_length",
+  "ion_utf8_helper_string_glyph_length",
+  "ion_utf8_helper_beginning_of_word",
+  "ion_utf8_helper_end_of_word",
+  "ion_utf8_helper_is_prefix",
+  "kandinsky_color_rgb",
+  "kandinsky_color_blend",
+  "kandinsky_color_hsv",
+  "kandinsky_font_index_for_code_point",
+  "kandinsky_glyph_cache",
+  "kandinsky_rect_intersect",
+  "kandinsky_rect_union",
+  "kandinsky_rect_empty_union",
+  "kandinsky_rect_difference",
+  "tree_handle_are_discared_after_block",
+  "tree_handle_are_discared_after_function_call",
+  "tree_handle_can_be_copied",
+  "tree_handle_can_be_moved",
+  "tree_handle_can_be_returned",
+  "tree_handle_memory_failure",
+  "tree_handle_survive_memory_failure",
+  "tree_handle_does_not_copy",
+  "poincare_approximation_decimal",
+  "poincare_approximation_based_integer",
+  "poincare_approximation_rational",
+  "poincare_approximation_float",
+  "poincare_approximation_infinity",
+  "poincare_approximation_addition",
+  "poincare_approximation_multiplication",
+  "poincare_approximation_power",
+  "poincare_approximation_subtraction",
+  "poincare_approximation_constant",
+  "poincare_approximation_division",
+  "poincare_approximation_logarithm",
+  "poincare_approximation_function",
+  "poincare_approximation_unique_random",
+  "poincare_approximation_integral",
+  "poincare_approximation_trigonometry_functions",
+  "poincare_approximation_matrix",
+  "poincare_approximation_list",
+  "poincare_approximation_list_sequence",
+  "poincare_approximation_map_on_list",
+  "poincare_approximation_probability",
+  "poincare_approximation_complex_format",
+  "poincare_approximation_mix",
+  "poincare_approximation_lists_access",
+  "poincare_approximation_lists_functions",
+  "poincare_approximation_mixed_fraction",
+  "poincare_approximation_floor_ceil_integer",
+  "poincare_approximation_booleans",
+  "poincare_approximation_piecewise_operator",
+  "poincare_approximation_point",
+  "poincare_approximation_keeping_symbols",
+  "poincare_approximation_program",
+  "poincare_arithmetic_gcd",
+  "poincare_arithmetic_lcm",
+  "poincare_arithmetic_factorization",
+  "poincare_arithmetic_divisors",
+  "poincare_conics_canonic",
+  "poincare_conics_invalid",
+  "poincare_conics_general",
+  "poincare_conics_reduction",
+  "poincare_context_user_variable_simple",
+  "poincare_context_user_variable_2_circular_variables",
+  "poincare_context_user_variable_3_circular_variables",
+  "poincare_context_user_variable_1_circular_function",
+  "poincare_context_user_variable_2_circular_functions",
+  "poincare_context_user_variable_3_circular_functions",
+  "poincare_context_user_variable_circular_variables_and_functions",
+  "poincare_context_user_variable_composed_functions",
+  "poincare_context_user_variable_properties",
+  "poincare_context_function_evaluate_at_undef",
+  "erf_inv",
+  "poincare_exam_modes",
+  "poincare_no_dependency",
+  "poincare_dependency_function",
+  "poincare_dependency_derivative",
+  "poincare_dependency_parametered_expression",
+  "poincare_dependency_sequence",
+  "poincare_dependency_power",
+  "poincare_dependency_multiplication",
+  "poincare_dependency_trigonometry",
+  "poincare_derivative_formal",
+  "poincare_derivative_formal_higher_order",
+  "poincare_derivative_reduced_approximation",
+  "poincare_derivative_approximation",
+  "poincare_derivative_approximation_higher_order",
+  "poincare_student_distribution",
+  "probability_chi2_law",
+  "poincare_normal_distribution_find_parameters",
+  "poincare_discrete_distributions",
+  "poincare_expression_can_start_uninitialized",
+  "poincare_expression_can_be_copied_even_if_uninitialized",
+  "poincare_expression_cast_does_not_copy",
+  "poincare_expression_decimal_constructor",
+  "poincare_expression_rational_constructor",
+  "poincare_expression_constant_constructor",
+  "poincare_expression_unit_constructor",
+  "poincare_number_of_numerical_values",
+  "poincare_expression_generalization",
+  "poincare_expression_order_constant",
+  "poincare_expression_order_decimal",
+  "poincare_expression_order_rational",
+  "poincare_expression_order_float",
+  "poincare_expression_order_power",
+  "poincare_expression_order_symbol",
+  "poincare_expression_order_function",
+  "poincare_expression_order_mix",
+  "poincare_expression_order_addition_multiplication",
+  "poincare_properties_is_number",
+  "poincare_properties_is_number_zero",
+  "poincare_properties_is_random",
+  "poincare_properties_is_parametered_expression",
+  "poincare_properties_is_rational_number",
+  "poincare_properties_is_approximate",
+  "poincare_properties_is_matrix",
+  "poincare_properties_deep_is_matrix",
+  "poincare_properties_is_infinity",
+  "poincare_properties_decimal_sign",
+  "poincare_properties_based_integer_sign",
+  "poincare_properties_rational_sign",
+  "poincare_properties_expression_sign",
+  "poincare_properties_sign",
+  "poincare_properties_set_sign_positive",
+  "poincare_properties_is_real",
+  "poincare_properties_polynomial_degree",
+  "poincare_properties_get_variables",
+  "poincare_properties_get_polynomial_coefficients",
+  "poincare_properties_remove_unit",
+  "poincare_expression_additional_results",
+  "poincare_expression_children_list_length",
+  "poincare_expression_list_of_points",
+  "poincare_expression_continuous",
+  "poincare_expression_is_linear_combination_of_pattern",
+  "poincare_expression_deep_is_symbolic",
+  "poincare_serialization_based_integer",
+  "poincare_serialization_rational",
+  "poincare_serialization_decimal",
+  "poincare_serialization_float",
+  "poincare_serialization_division",
+  "poincare_serialization_factorial",
+  "poincare_serialization_percent",
+  "poincare_expression_to_layout",
+  "poincare_expression_to_layout_multiplication_operator",
+  "poincare_expression_to_layout_implicit_addition",
+  "poincare_expression_to_layout_serializes_to_self",
+  "poincare_expression_to_layout_mixed_fraction",
+  "poincare_solver_roots",
+  "poincare_solver_minima",
+  "poincare_solver_maxima",
+  "poincare_solver_intersections",
+  "poincare_helpers_gcd",
+  "poincare_helpers_insert_simple_swap",
+  "poincare_helpers_rotate",
+  "poincare_helpers_sort",
+  "poincare_input_beautification_after_inserting_text",
+  "poincare_input_beautification_after_inserting_layout",
+  "poincare_input_beautification_derivative",
+  "poincare_integer_constructor",
+  "poincare_integer_compare",
+  "poincare_integer_properties",
+  "poincare_integer_addition",
+  "poincare_integer_subtraction",
+  "poincare_integer_multiplication",
+  "poincare_integer_divide",
+  "poincare_integer_pow",
+  "poincare_integer_factorial",
+  "poincare_integer_evaluate",
+  "poincare_integer_serialize",
+  "poincare_integer_euclidian_division",
+  "poincare_integer_mixed_fraction",
+  "poincare_layout_constructors",
+  "poincare_layout_comparison",
+  "poincare_layout_fraction_create",
+  "poincare_layout_power",
+  "poincare_layout_cursor_layout_to_point",
+  "poincare_layout_cursor_delete",
+  "poincare_layout_parentheses",
+  "poincare_layout_cursor_sizes_invalidation",
+  "poincare_layout_serialization",
+  "poincare_layout_to_expression_unparsable",
+  "poincare_layout_to_expression_parsable",
+  "poincare_matrix_rank",
+  "poincare_matrix_undef",
+  "poincare_matrix_float_children",
+  "poincare_parsing_tokenize_numbers",
+  "poincare_parsing_memory_exhaustion",
+  "poincare_parsing_parse_numbers",
+  "poincare_parsing_parse",
+  "poincare_parsing_matrices",
+  "poincare_parsing_lists",
+  "poincare_parsing_lists_access",
+  "poincare_parsing_constants",
+  "poincare_parsing_units",
+  "poincare_parsing_identifiers",
+  "poincare_parsing_parse_store",
+  "poincare_parsing_parse_unit_convert",
+  "poincare_parsing_implicit_multiplication",
+  "poincare_parsing_adding_missing_parentheses",
+  "poincare_parsing_mixed_fraction",
+  "poincare_parsing_function_assignment",
+  "poincare_parsing_east_arrows",
+  "poincare_parsing_logic",
+  "poincare_parsing_points",
+  "poincare_points_of_interest_list",
+  "poincare_polynomial_roots_quadratic",
+  "poincare_polynomial_roots_cubic",
+  "poincare_print_custom_print",
+  "assert_print_floats",
+  "poincare_print_int_left",
+  "poincare_print_int_right",
+  "poincare_range_1d_validity",
+  "poincare_range_1d_geometry",
+  "poincare_range_1d_extend",
+  "poincare_range_1d_zoom",
+  "poincare_rational_order",
+  "poincare_rational_specific_properties",
+  "poincare_rational_addition",
+  "poincare_rational_power",
+  "regularized_incomplete_beta_function",
+  "probability_regularized_gamma",
+  "poincare_simplification_based_integer",
+  "poincare_simplification_decimal",
+  "poincare_simplification_rational",
+  "poincare_simplification_infinity",
+  "poincare_simplification_addition",
+  "poincare_simplification_multiplication",
+  "poincare_simplification_constants",
+  "poincare_simplification_units",
+  "poincare_simplification_power",
+  "poincare_simplification_factorial",
+  "poincare_simplification_percent",
+  "poincare_simplification_logarithm",
+  "poincare_simplification_random",
+  "poincare_simplification_randint",
+  "poincare_simplification_function",
+  "poincare_simplification_trigonometry_functions",
+  "poincare_simplification_matrix",
+  "poincare_simplification_functions_of_matrices",
+  "poincare_simplification_store",
+  "poincare_simplification_store_matrix",
+  "poincare_simplification_store_correctly_parsed",
+  "poincare_simplification_unit_convert",
+  "poincare_simplification_complex_format",
+  "poincare_simplification_reduction_target",
+  "poincare_simplification_unit_conversion",
+  "poincare_simplification_user_function",
+  "poincare_simplification_mix",
+  "poincare_hyperbolic_trigonometry",
+  "poincare_advanced_trigonometry",
+  "poincare_probability",
+  "poincare_simplification_system_circuit_breaker_handled",
+  "poincare_simplification_list",
+  "poincare_simplification_functions_of_lists",
+  "poincare_simplification_mix_lists",
+  "poincare_simplification_mixed_fraction",
+  "poincare_simplification_booleans",
+  "poincare_simplification_comparison_operators",
+  "poincare_simplification_logical_operators",
+  "poincare_simplification_piecewise_operator",
+  "poincare_simplification_integral",
+  "poincare_simplification_point",
+  "poincare_simplification_reduction_cache",
+  "poincare_zoom_fit_points_of_interest",
+  "poincare_zoom_fit_intersections",
+  "poincare_zoom_fit_magnitude_in_batch",
+  "poincare_zoom_sanitation",
+  "python_basics",
+  "python_built_in",
+  "python_template",
+  "python_fixes",
+  "python_compiled_module_cache",
+  "python_native_emitters",
+  "python_ion_import",
+  "python_ion_keydown",
+  "python_kandinsky_import",
+  "python_kandinsky_basics",
+  "python_kandinsky_pixels",
+  "python_math",
+  "python_cmath",
+  "python_numpy",
+  "python_random",
+  "python_time",
+  "python_turtle",
+  "python_turtle_circle",
+  "python_matplotlib_pyplot_import",
+  "python_matplotlib_pyplot_arrow",
+  "python_matplotlib_pyplot_axis",
+  "python_matplotlib_pyplot_bar",
+  "python_matplotlib_pyplot_grid",
+  "python_matplotlib_pyplot_hist",
+  "python_matplotlib_pyplot_plot",
+  "python_matplotlib_pyplot_scatter",
+  "python_matplotlib_pyplot_text",
+  "escher_clipboard_stored_text_is_parseable",
+  "escher_layout_field_select_left_right",
+  "escher_layout_field_select_up_down",
+  "escher_layout_field_unselect",
+  "escher_layout_field_delete",
+  "omg_bit_helper",
+  "omg_print_integer",
+  "omg_signaling_nan",
+  "alignment_handling",
+  "interval_values",
+  "calculation_store",
+  "calculation_ans",
+  "calculation_significant_digits",
+  "calculation_display_exact_approximate",
+  "calculation_symbolic_computation",
+  "calculation_symbolic_computation_and_parametered_expressions",
+  "calculation_complex_format",
+  "calculation_involving_sequence",
+  "calculation_additional_results",
+  "graph_caching",
+  "graph_caches_lending",
+  "graph_function_properties",
+  "graph_function_properties_with_predefined_variables",
+  "code_clipboard_enters_and_exits_python",
+  "variable_box_controller",
+  "data_statistics",
+  "data_statistics_multiple_series",
+  "data_statistics_histograms",
+  "probability_binomial_distribution",
+  "probability_uniform_distribution",
+  "probability_exponential_distribution",
+  "probability_poisson_distribution",
+  "probability_chi_squared_distribution",
+  "probability_student_distribution",
+  "probability_geometric_distribution",
+  "probability_normal_distribution",
+  "probability_fisher_distribution",
+  "probability_one_proportion_statistic",
+  "probability_one_mean_t_statistic",
+  "probability_one_mean_z_statistic",
+  "probability_two_proportions_statistic",
+  "probability_two_means_t_statistic",
+  "probability_pooled_t_test",
+  "probability_two_means_z_statistic",
+  "probability_goodness_test",
+  "probability_homogeneity_test",
+  "probability_slope_t_statistic",
+  "solver_error",
+  "solver_linear_system",
+  "solver_polynomial_system",
+  "solver_approximate",
+  "solver_complex_real",
+  "solver_complex_cartesian",
+  "solver_complex_polar",
+  "solver_symbolic_computation",
+  "sequence_evaluation",
+  "sequence_context",
+  "sequence_order",
+  "sequence_sum_evaluation",
+  "sequence_rank_checkpoints",
+  "sequence_affine_recurrence",
+  "sequence_suitable_for_cobweb",
+  "regression_linear",
+  "regression_linear_2",
+  "regression_proportional",
+  "regression_proportional_2",
+  "regression_proportional_3",
+  "regression_proportional_4",
+  "regression_proportional_5",
+  "regression_quadratic",
+  "regression_cubic",
+  "regression_quartic",
+  "regression_logarithmic",
+  "regression_exponential",
+  "regression_exponential_2",
+  "regression_exponential_3",
+  "regression_exponential_4",
+  "regression_exponential_5",
+  "regression_exponential_abx",
+  "regression_power",
+  "regression_median_0",
+  "regression_median_1",
+  "regression_median_2",
+  "regression_trigonometric_1",
+  "regression_trigonometric_2",
+  "regression_trigonometric_3",
+  "regression_trigonometric_4",
+  "regression_trigonometric_4_bis",
+  "regression_logistic",
+  "regression_column_calculation",
+  "regression_constant_column_calculation",
+  "regression_calculation",
+  "finance_simple_interest",
+  "finance_compound_interest",
+  NULL
+};
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "code_icon.h"
+
+// Compressed 3080 pixels into 919 bytes (14.92% compression ratio)/
+const uint8_t compressedPixelData[919] = {0x17, 0xff, 0x01, 0x00, 0x5f, 0xdf, 0xff, 0x9e, 0xf7, 0xbe, 0x02, 0x00, 0x3a, 0x4f, 0x9e, 0xf7, 0xdf, 0xff, 0x01, 0x00, 0x01, 0x2f, 0xbe, 0xf7, 0x02, 0x00, 0x49, 0x0a, 0x6c, 0x00, 0x0f, 0xd4, 0x00, 0x3d, 0x0e, 0xe4, 0x00, 0x0f, 0x6c, 0x00, 0x57, 0x08, 0x70, 0x00, 0x2f, 0xbe, 0xf7, 0x02, 0x00, 0x55, 0x0f, 0x6e, 0x00, 0x5d, 0x0f, 0x46, 0x01, 0x51, 0x06, 0x4e, 0x01, 0x0f, 0x6e, 0x00, 0x87, 0xff, 0x03, 0x9e, 0xf7, 0x1c, 0xe7, 0x9a, 0xd6, 0x59, 0xce, 0x59, 0xc6, 0x59, 0xc6, 0x7a, 0xce, 0xbb, 0xd6, 0x3c, 0xe7, 0xac, 0x00, 0x1b, 0x0f, 0x2e, 0x00, 0x15, 0x9b, 0xba, 0xd6, 0x15, 0x9d, 0x11, 0x7c, 0x4f, 0x63, 0x4e, 0x02, 0x00, 0x7f, 0x6f, 0x63, 0x52, 0x84, 0xd7, 0xb5, 0x9e, 0x00, 0x01, 0x3a, 0x2c, 0xd4, 0x94, 0x66, 0x00, 0x0a, 0x02, 0x00, 0x4f, 0x11, 0x7c, 0x1c, 0xe7, 0x6e, 0x00, 0x35, 0x20, 0xb7, 0xb5, 0x52, 0x00, 0x5f, 0x8f, 0x6b, 0x32, 0x84, 0x6f, 0x70, 0x00, 0x06, 0x4f, 0xf1, 0x7b, 0x7e, 0xef, 0x6e, 0x00, 0x33, 0xcf, 0x31, 0x7c, 0x4e, 0x63, 0xd0, 0x73, 0x3d, 0xe7, 0xbe, 0xf7, 0x9a, 0xce, 0xe0, 0x00, 0x07, 0x2f, 0xb7, 0xb5, 0x6e, 0x00, 0x33, 0x62, 0x8f, 0x6b, 0x4e, 0x63, 0xf4, 0x9c, 0x0c, 0x00, 0x2f, 0xf1, 0x73, 0x6e, 0x00, 0x05, 0x2f, 0x93, 0x8c, 0x6e, 0x00, 0x37, 0x8f, 0xf1, 0x7b, 0x9e, 0xef, 0xbe, 0xf7, 0xfc, 0xde, 0x4c, 0x01, 0x07, 0x2f, 0x72, 0x84, 0x6e, 0x00, 0x37, 0x00, 0x70, 0x00, 0x22, 0xf4, 0x9c, 0x0a, 0x00, 0x0f, 0x6e, 0x00, 0x51, 0x0e, 0x02, 0x00, 0x0f, 0x6e, 0x00, 0xb1, 0x0e, 0x02, 0x00, 0x2f, 0x1c, 0xe7, 0x6e, 0x00, 0x39, 0x8f, 0xfb, 0xde, 0x55, 0xa5, 0x72, 0x84, 0x11, 0x7c, 0x02, 0x00, 0x07, 0x0f, 0x6e, 0x00, 0x01, 0x42, 0x9d, 0xf7, 0x92, 0xf6, 0x02, 0x00, 0x5f, 0xb3, 0xf6, 0x17, 0xf7, 0x9e, 0x3a, 0x04, 0x14, 0x4f, 0x56, 0xa5, 0x4f, 0x63, 0x3c, 0x01, 0x11, 0x0e, 0x6e, 0x00, 0x20, 0xa7, 0xfd, 0x02, 0x00, 0x11, 0xa8, 0x02, 0x00, 0x3f, 0x0d, 0xf6, 0x9d, 0x6e, 0x00, 0x10, 0x2e, 0x56, 0xad, 0x6a, 0x00, 0x0f, 0x6e, 0x00, 0x21, 0x4f, 0xa8, 0xfd, 0x91, 0xf6, 0x44, 0x01, 0x0f, 0x2f, 0x4e, 0x63, 0x6e, 0x00, 0x35, 0x3f, 0xa8, 0xfd, 0x7c, 0x6e, 0x00, 0x0c, 0x2f, 0x15, 0x9d, 0x6e, 0x00, 0x27, 0x1d, 0x7c, 0x6e, 0x00, 0x1f, 0xd5, 0xde, 0x00, 0x0c, 0x2f, 0xf1, 0x73, 0x6e, 0x00, 0x25, 0x3d, 0xb4, 0x94, 0x5a, 0x6e, 0x00, 0x1f, 0x4f, 0x6e, 0x00, 0x0a, 0x4f, 0x5d, 0xef, 0x4e, 0x63, 0x02, 0x00, 0x25, 0x4c, 0xf8, 0xbd, 0xd4, 0xf6, 0x6e, 0x00, 0x2f, 0xeb, 0xf5, 0x6e, 0x00, 0x09, 0x2f, 0x9a, 0xce, 0x6c, 0x00, 0x25, 0x6c, 0x31, 0x7c, 0x9d, 0xf7, 0xeb, 0xf5, 0x6e, 0x00, 0x2f, 0xa8, 0xfd, 0x98, 0x02, 0x09, 0x2f, 0x18, 0xbe, 0x6c, 0x00, 0x23, 0x53, 0x52, 0x84, 0x3c, 0xe7, 0x91, 0xda, 0x00, 0x0a, 0x6e, 0x00, 0x1f, 0x7c, 0x38, 0x07, 0x0e, 0x0f, 0x30, 0x07, 0x05, 0x4e, 0xd4, 0x94, 0xf4, 0x9c, 0x02, 0x00, 0xaf, 0x56, 0xa5, 0x59, 0xce, 0x9d, 0xf7, 0x71, 0xf6, 0x87, 0xfd, 0x6e, 0x00, 0x01, 0x1f, 0x7b, 0x6e, 0x00, 0x08, 0x2f, 0x97, 0xb5, 0xbc, 0x00, 0x05, 0x99, 0xdb, 0xd6, 0x9e, 0xf7, 0x5a, 0xf7, 0x39, 0xf7, 0x3a, 0x02, 0x00, 0x00, 0x12, 0x00, 0x8f, 0x17, 0xf7, 0x92, 0xf6, 0xca, 0xf5, 0x87, 0xfd, 0x6e, 0x00, 0x03, 0x1f, 0x5b, 0x6e, 0x00, 0x08, 0x2f, 0xf8, 0xbd, 0x6e, 0x02, 0x03, 0x00, 0x94, 0x04, 0x3d, 0xa7, 0xfd, 0x86, 0x02, 0x00, 0x19, 0x87, 0x02, 0x00, 0x0f, 0xdc, 0x00, 0x1d, 0x2f, 0x59, 0xc6, 0x42, 0x01, 0x01, 0x4e, 0x7d, 0xef, 0x2e, 0xf6, 0x6a, 0x00, 0x0f, 0x6e, 0x00, 0x13, 0x1f, 0x7c, 0xdc, 0x05, 0x1c, 0x3e, 0x18, 0xc6, 0xf6, 0x6c, 0x00, 0x0f, 0x6e, 0x00, 0x16, 0x1f, 0x9d, 0x92, 0x05, 0x0a, 0x0e, 0xcc, 0x06, 0x0e, 0xda, 0x00, 0x0f, 0x6e, 0x00, 0x17, 0x1f, 0x0c, 0x4c, 0x04, 0x0c, 0x2a, 0x93, 0x8c, 0x6c, 0x00, 0x6f, 0xb0, 0x73, 0xbe, 0xf7, 0xea, 0xf5, 0x6e, 0x00, 0x25, 0x1f, 0xb3, 0x6e, 0x00, 0x0c, 0x0c, 0x28, 0x02, 0x5f, 0xd0, 0x73, 0xbe, 0xf7, 0xca, 0x6e, 0x00, 0x26, 0x1f, 0x7b, 0x96, 0x05, 0x0c, 0x4f, 0x7d, 0xef, 0xd0, 0x73, 0x6e, 0x00, 0x35, 0x2f, 0x4e, 0xf6, 0xe0, 0x06, 0x0f, 0x3f, 0x7a, 0xce, 0x6f, 0x6e, 0x00, 0x32, 0x3f, 0xc9, 0xf5, 0x5b, 0xbe, 0x07, 0x12, 0x4f, 0x9a, 0xd6, 0x11, 0x7c, 0x6e, 0x00, 0x2d, 0x3f, 0xeb, 0xf5, 0x39, 0x9a, 0x08, 0x18, 0x40, 0x3c, 0xe7, 0xdb, 0xde, 0x02, 0x00, 0x2f, 0xfb, 0xde, 0x6e, 0x00, 0x01, 0x24, 0xa7, 0xfd, 0x4c, 0x04, 0x0f, 0x02, 0x00, 0x03, 0x1f, 0x5b, 0x62, 0x09, 0x28, 0x2e, 0xca, 0xf5, 0xd4, 0x00, 0x26, 0x4f, 0xf6, 0x02, 0x00, 0x11, 0x50, 0x02, 0x00, 0x2f, 0xb3, 0xf6, 0xd0, 0x09, 0x33, 0x0f, 0x4a, 0x01, 0x13, 0x1f, 0x0d, 0x6e, 0x00, 0xbe, 0x6f, 0xf7, 0xf6, 0x9d, 0xf7, 0xd5, 0xf6, 0x6e, 0x00, 0x39, 0x0f, 0x4c, 0x04, 0x07, 0x13, 0x2e, 0x62, 0x00, 0x5f, 0xeb, 0xf5, 0x87, 0xfd, 0x2d, 0x6e, 0x00, 0x34, 0x0f, 0x28, 0x05, 0x07, 0x20, 0xeb, 0xf5, 0x12, 0x0b, 0x7f, 0x9d, 0xf7, 0xc9, 0xf5, 0x87, 0xfd, 0x71, 0x6e, 0x00, 0x34, 0x2f, 0x39, 0xf7, 0x4a, 0x01, 0x07, 0x7e, 0x2e, 0xf6, 0xd5, 0xf6, 0x0c, 0xf6, 0x87, 0x38, 0x07, 0x0f, 0x56, 0x10, 0x28, 0x1f, 0xd5, 0xe0, 0x06, 0x0c, 0x3f, 0xa8, 0xfd, 0x18, 0x6c, 0x00, 0x14, 0x1f, 0x7d, 0x9e, 0x0f, 0x12, 0x1f, 0x5a, 0x50, 0x01, 0x02, 0x02, 0x6a, 0x00, 0x2f, 0x70, 0xf6, 0x7e, 0x05, 0x0d, 0x06, 0x86, 0x05, 0x1f, 0x7d, 0x0c, 0x10, 0x16, 0xa2, 0x7c, 0xf7, 0xf6, 0xf6, 0x70, 0xf6, 0x0c, 0xf6, 0xc9, 0xf5, 0x08, 0x05, 0x5f, 0x0c, 0xf6, 0x71, 0xf6, 0xf7, 0x5c, 0x0c, 0x12, 0x06, 0x6e, 0x00, 0x1f, 0xdf, 0xea, 0x12, 0x56, 0x02, 0x88, 0x15, 0x2f, 0x5d, 0xef, 0x6e, 0x00, 0x53, 0x22, 0x5d, 0xef, 0xa2, 0x14, 0x2f, 0x5d, 0xef, 0x6c, 0x00, 0x57, 0x00, 0xbe, 0x16, 0x0e, 0x20, 0x13, 0x0f, 0x44, 0x01, 0x3b, 0x2a, 0x3c, 0xe7, 0xce, 0x16, 0x5f, 0x5d, 0xef, 0x5d, 0xef, 0x9e, 0x6a, 0x00, 0x42, 0x26, 0x5d, 0xef, 0xd8, 0x00, 0x08, 0xa0, 0x17, 0x40, 0x5d, 0xef, 0x3c, 0xe7, 0x02, 0x00, 0x2f, 0x5d, 0xef, 0x02, 0x00, 0x31, 0x04, 0x4c, 0x00, 0x03, 0xd6, 0x00, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 
+};
+
+constexpr Escher::Image image = Escher::Image(55, 56, compressedPixelData, 919, false);
+
+const Escher::Image * const ImageStore::CodeIcon = &image;
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "distributions_icon.h"
+
+// Compressed 3080 pixels into 971 bytes (15.76% compression ratio)/
+const uint8_t compressedPixelData[971] = {0x15, 0xff, 0x01, 0x00, 0xcf, 0xdf, 0xff, 0xf8, 0xbd, 0x10, 0x84, 0xec, 0x5a, 0x49, 0x4a, 0x08, 0x42, 0x02, 0x00, 0x31, 0xae, 0x29, 0x42, 0xcb, 0x5a, 0x31, 0x84, 0x18, 0xc6, 0xdf, 0xff, 0x01, 0x00, 0x6f, 0x18, 0xc6, 0xec, 0x5a, 0x08, 0x42, 0x02, 0x00, 0x41, 0x4a, 0xec, 0x5a, 0x38, 0xc6, 0x6c, 0x00, 0x4f, 0xb3, 0x94, 0x08, 0x42, 0x02, 0x00, 0x49, 0x26, 0xd3, 0x9c, 0x6c, 0x00, 0x1f, 0x92, 0x6c, 0x00, 0x4c, 0x08, 0x70, 0x00, 0x4f, 0xf8, 0xbd, 0x08, 0x42, 0x02, 0x00, 0x51, 0x20, 0x18, 0xc6, 0x1c, 0x02, 0x2f, 0xab, 0x52, 0x6e, 0x00, 0x53, 0x5f, 0xab, 0x52, 0xdf, 0xff, 0xd7, 0xda, 0x00, 0x54, 0x00, 0x02, 0x00, 0x4f, 0xf7, 0xbd, 0xf0, 0x7b, 0x6e, 0x00, 0x57, 0x4f, 0x10, 0x84, 0xab, 0x52, 0x6e, 0x00, 0x57, 0x3f, 0xcc, 0x5a, 0x29, 0x3e, 0x00, 0x27, 0x1f, 0x3a, 0x32, 0x00, 0x1d, 0x0f, 0x38, 0x04, 0x21, 0xff, 0x01, 0xa9, 0x5a, 0xac, 0xb4, 0xee, 0xed, 0x90, 0x63, 0x6f, 0x63, 0xed, 0x5a, 0x29, 0x42, 0xe8, 0x39, 0x0e, 0x01, 0x49, 0xc0, 0xeb, 0x93, 0x4f, 0xfe, 0x6f, 0xfe, 0x6f, 0xfe, 0x90, 0x63, 0x90, 0x63, 0x72, 0x00, 0x4f, 0xab, 0x52, 0xe8, 0x39, 0x6c, 0x00, 0x47, 0x00, 0x6a, 0x00, 0x06, 0x6e, 0x00, 0x00, 0x70, 0x00, 0x1f, 0xcc, 0x70, 0x00, 0x44, 0x4c, 0x2a, 0x73, 0x4f, 0xfe, 0x6e, 0x00, 0x6f, 0x90, 0x63, 0x4f, 0x63, 0x6a, 0x4a, 0x70, 0x00, 0x41, 0x3d, 0x2e, 0xfe, 0x6f, 0x6e, 0x00, 0x00, 0x02, 0x00, 0x2f, 0x0d, 0x5b, 0x6e, 0x00, 0x3d, 0x42, 0xe8, 0x39, 0xeb, 0xcc, 0x68, 0x00, 0xa6, 0x4e, 0xfe, 0xea, 0xfd, 0x46, 0xe5, 0x4e, 0x63, 0x6f, 0x63, 0x4e, 0x01, 0x1f, 0x4a, 0xde, 0x00, 0x3b, 0x43, 0x3a, 0x28, 0x4a, 0x4e, 0x6c, 0x00, 0x80, 0xc8, 0xfd, 0x86, 0xf5, 0x25, 0xe5, 0x4e, 0x63, 0x02, 0x00, 0x04, 0x70, 0x00, 0x0f, 0xbc, 0x01, 0x3b, 0x42, 0xe8, 0x39, 0x69, 0xb4, 0xda, 0x00, 0x37, 0xe8, 0xfd, 0xa6, 0x6e, 0x00, 0x13, 0x4f, 0x6e, 0x00, 0x6f, 0x4e, 0x63, 0xe8, 0x39, 0x08, 0x3a, 0x6e, 0x00, 0x37, 0x20, 0xed, 0xf5, 0x6c, 0x00, 0x39, 0x2c, 0xfe, 0xa6, 0x6e, 0x00, 0x04, 0x50, 0x01, 0x6f, 0x6f, 0x63, 0xe8, 0x39, 0xe8, 0x39, 0x6c, 0x00, 0x35, 0x22, 0x28, 0x4a, 0x8e, 0x02, 0x2c, 0xc7, 0xfd, 0x6e, 0x00, 0x04, 0x4e, 0x01, 0x2f, 0x4a, 0x4a, 0x6e, 0x00, 0x37, 0x26, 0xca, 0x93, 0xda, 0x00, 0x0c, 0x6e, 0x00, 0x1f, 0x70, 0xba, 0x01, 0x3c, 0x40, 0xe8, 0x39, 0x4c, 0xd5, 0x6e, 0x00, 0x2e, 0xea, 0xfd, 0x6e, 0x00, 0x04, 0x4c, 0x01, 0x2f, 0x2e, 0x63, 0x6e, 0x00, 0x37, 0x26, 0x0e, 0xf6, 0x48, 0x01, 0x0c, 0x6e, 0x00, 0x02, 0x4c, 0x01, 0x1f, 0x70, 0xba, 0x01, 0x35, 0x32, 0x3a, 0x48, 0x4a, 0xfc, 0x02, 0x1e, 0xa6, 0x6e, 0x00, 0x07, 0xba, 0x01, 0x1f, 0x09, 0xa2, 0x05, 0x32, 0x40, 0xe8, 0x39, 0x4a, 0x7b, 0x6e, 0x00, 0x1e, 0x0b, 0x6e, 0x00, 0x09, 0x4c, 0x01, 0x2f, 0x8b, 0x4a, 0x6e, 0x00, 0x33, 0x11, 0x8b, 0x6c, 0x03, 0x2f, 0xe9, 0xfd, 0x6e, 0x00, 0x0b, 0x2f, 0x0d, 0x5b, 0x6e, 0x00, 0x33, 0x20, 0x8c, 0xe5, 0x48, 0x01, 0x1f, 0xc6, 0x6e, 0x00, 0x06, 0x13, 0x4e, 0x9e, 0x05, 0x0f, 0x6e, 0x00, 0x33, 0x19, 0x2d, 0x48, 0x01, 0x0e, 0x6e, 0x00, 0x02, 0xde, 0x00, 0x1f, 0x70, 0xba, 0x01, 0x30, 0x40, 0xe8, 0x39, 0x87, 0x5a, 0x22, 0x05, 0x2f, 0xc8, 0xfd, 0x6e, 0x00, 0x09, 0x1f, 0x4f, 0xba, 0x01, 0x34, 0x9f, 0xe8, 0x39, 0x07, 0xac, 0x6f, 0xfe, 0x2d, 0xfe, 0xa6, 0x6e, 0x00, 0x0a, 0x02, 0xe4, 0x03, 0x0f, 0xba, 0x01, 0x2e, 0x58, 0x3a, 0xe8, 0x41, 0x89, 0xf5, 0x22, 0x02, 0x0f, 0x6e, 0x00, 0x05, 0x11, 0x6f, 0xba, 0x01, 0x1f, 0x4a, 0x4c, 0x01, 0x2a, 0x9f, 0xe8, 0x39, 0x67, 0x8b, 0x0b, 0xfe, 0x4d, 0xfe, 0xa6, 0x6e, 0x00, 0x0e, 0x22, 0x4e, 0x63, 0x18, 0x09, 0x0f, 0xde, 0x00, 0x2b, 0x3b, 0x46, 0xe5, 0x4d, 0xda, 0x00, 0x0e, 0x6e, 0x00, 0x04, 0xde, 0x00, 0x3f, 0x70, 0x63, 0x4e, 0xde, 0x00, 0x28, 0x00, 0xb4, 0x01, 0x2c, 0xc7, 0xfd, 0xda, 0x00, 0x0e, 0x6e, 0x00, 0x06, 0xde, 0x00, 0x1f, 0x4e, 0xbc, 0x01, 0x26, 0x7d, 0xe8, 0x39, 0xc7, 0x6a, 0xa6, 0xfd, 0x0a, 0xda, 0x00, 0x0e, 0x6e, 0x00, 0x06, 0x9a, 0x02, 0x5f, 0x6f, 0x63, 0x4e, 0x63, 0xac, 0x0e, 0x06, 0x21, 0x74, 0x3a, 0x48, 0x52, 0x46, 0xed, 0xa6, 0xfd, 0x66, 0x06, 0x0f, 0x6e, 0x00, 0x11, 0x11, 0x4e, 0x6e, 0x00, 0x1f, 0x4e, 0x84, 0x09, 0x22, 0x8f, 0xe6, 0xd4, 0xa6, 0xfd, 0xe9, 0xfd, 0xc8, 0xfd, 0x6e, 0x00, 0x19, 0x8f, 0x4f, 0x63, 0x4f, 0x63, 0x4e, 0x63, 0x2e, 0x63, 0x44, 0x0b, 0x1a, 0x00, 0x8c, 0x02, 0x10, 0xbc, 0x58, 0x00, 0x0e, 0x46, 0x01, 0x0e, 0x6e, 0x00, 0x0c, 0x70, 0x00, 0x10, 0x4e, 0xbe, 0x01, 0x1f, 0x63, 0x6c, 0x00, 0x19, 0x20, 0x27, 0xac, 0x56, 0x00, 0x3f, 0xc7, 0xfd, 0xc7, 0x6e, 0x00, 0x1e, 0x04, 0x02, 0x00, 0x4f, 0x0d, 0x5b, 0x08, 0x3a, 0x8a, 0x02, 0x15, 0x02, 0x56, 0x00, 0x0e, 0x6c, 0x00, 0x0f, 0x6e, 0x00, 0x17, 0x4f, 0x4e, 0x63, 0xed, 0x5a, 0x70, 0x00, 0x11, 0x2e, 0x47, 0xb4, 0x64, 0x00, 0x0f, 0x6e, 0x00, 0x21, 0x0e, 0x70, 0x00, 0x0e, 0xa6, 0x07, 0x4f, 0xc6, 0xcc, 0xa6, 0xfd, 0x6e, 0x00, 0x35, 0x00, 0x50, 0x01, 0x1f, 0x09, 0xe8, 0x0d, 0x06, 0x6f, 0x28, 0x7b, 0x66, 0xed, 0xa6, 0xfd, 0x6e, 0x00, 0x11, 0x1f, 0x26, 0x6e, 0x00, 0x14, 0x00, 0xa0, 0x02, 0x2f, 0x6a, 0x4a, 0xb2, 0x01, 0x05, 0x6f, 0xc8, 0x39, 0xc7, 0x39, 0xa7, 0x31, 0x02, 0x00, 0x37, 0x3f, 0xc7, 0x31, 0xc8, 0x1c, 0x09, 0x06, 0x00, 0x36, 0x09, 0x00, 0x72, 0x00, 0x0f, 0x02, 0x00, 0x37, 0x02, 0x52, 0x00, 0x0f, 0x90, 0x02, 0x07, 0x0f, 0x02, 0x00, 0x3f, 0x0a, 0x5e, 0x00, 0x0f, 0x54, 0x10, 0x57, 0x0f, 0x6e, 0x00, 0x5b, 0x4f, 0x08, 0x42, 0xcb, 0x5a, 0x6c, 0x00, 0x57, 0x6f, 0xec, 0x5a, 0x55, 0xad, 0xe8, 0x39, 0x48, 0x01, 0x55, 0x4f, 0x75, 0xad, 0xbe, 0xf7, 0x6e, 0x00, 0x57, 0x00, 0x86, 0x15, 0x4f, 0x96, 0xb5, 0xa7, 0x31, 0x6c, 0x00, 0x4f, 0x42, 0x87, 0x31, 0xb6, 0xb5, 0xa2, 0x14, 0x4f, 0x10, 0x84, 0xa7, 0x31, 0x6c, 0x00, 0x4d, 0x26, 0x31, 0x84, 0x7e, 0x15, 0x6f, 0xcf, 0x7b, 0x66, 0x29, 0xe8, 0x39, 0x42, 0x01, 0x45, 0x4a, 0x66, 0x29, 0xef, 0x7b, 0x5a, 0x16, 0x20, 0xb6, 0xb5, 0x16, 0x00, 0x2f, 0xa7, 0x31, 0x1c, 0x10, 0x3b, 0x8e, 0xa7, 0x31, 0x66, 0x29, 0x08, 0x42, 0xb6, 0xb5, 0x36, 0x17, 0xcf, 0xdf, 0xff, 0x75, 0xad, 0x2d, 0x63, 0x08, 0x42, 0x45, 0x29, 0x04, 0x21, 0x02, 0x00, 0x31, 0x83, 0x25, 0x21, 0xe7, 0x39, 0x6e, 0x6b, 0x96, 0xb5, 0xa2, 0x17, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 
+};
+
+constexpr Escher::Image image = Escher::Image(55, 56, compressedPixelData, 971, false);
+
+const Escher::Image * const ImageStore::DistributionsIcon = &image;
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "chi_squared_icon.h"
+
+// Compressed 665 pixels into 295 bytes (14.79% compression ratio)/
+const uint8_t compressedPixelData[295] = {0x1f, 0xff, 0x01, 0x00, 0xff, 0xdb, 0xdf, 0xfe, 0xff, 0x8d, 0xfe, 0xa1, 0xfd, 0x81, 0xfd, 0xc4, 0xfd, 0x6c, 0xfe, 0x57, 0x46, 0x00, 0x26, 0x46, 0x49, 0xfe, 0x80, 0xfd, 0x02, 0x00, 0x3f, 0x28, 0xfe, 0x9a, 0x44, 0x00, 0x20, 0x4c, 0x35, 0xff, 0x80, 0xfd, 0x02, 0x00, 0x3f, 0x8d, 0xfe, 0xde, 0x46, 0x00, 0x1c, 0x19, 0x06, 0x8a, 0x00, 0x04, 0x02, 0x00, 0x3f, 0xc3, 0xfd, 0x35, 0x44, 0x00, 0x18, 0x1e, 0xbb, 0x8a, 0x00, 0x07, 0xdc, 0x00, 0x1f, 0x99, 0x46, 0x00, 0x14, 0x1e, 0xf2, 0x8a, 0x00, 0x09, 0x02, 0x00, 0x1f, 0x4a, 0x26, 0x01, 0x12, 0x1f, 0x6c, 0x46, 0x00, 0x0c, 0x02, 0x4a, 0x00, 0x1f, 0x78, 0x16, 0x01, 0x22, 0x0e, 0x02, 0x00, 0x4f, 0x06, 0xfe, 0x13, 0xff, 0x72, 0x01, 0x07, 0x3f, 0xa2, 0xfd, 0x80, 0x02, 0x00, 0x16, 0x1f, 0xa1, 0x50, 0x02, 0x06, 0x2f, 0x80, 0xfd, 0x02, 0x00, 0x1d, 0x5f, 0xa2, 0xfd, 0x8d, 0xfe, 0x57, 0x46, 0x00, 0x2e, 0x04, 0x98, 0x00, 0x53, 0x4a, 0xfe, 0x13, 0xff, 0xbc, 0x46, 0x00, 0x2f, 0xc4, 0xfd, 0x02, 0x00, 0x2b, 0x7f, 0x29, 0xfe, 0xd1, 0xfe, 0x79, 0xff, 0x00, 0x01, 0x00, 0xe3, 0x7f, 0x08, 0x91, 0xf1, 0xf7, 0xdc, 0x9e, 0x40, 0x22, 0x00, 0x08, 0x22, 0x01, 0xb2, 0x67, 0x01, 0x2f, 0xbf, 0x2b, 0x23, 0x00, 0x06, 0x14, 0x56, 0xd1, 0x01, 0x3f, 0xfb, 0x90, 0x0c, 0x23, 0x00, 0x04, 0x16, 0xc9, 0xf6, 0x01, 0x2f, 0xe3, 0x53, 0x22, 0x00, 0x02, 0x19, 0x22, 0x1b, 0x02, 0x3e, 0xbf, 0x31, 0x00, 0x01, 0x00, 0x1a, 0x69, 0x3f, 0x02, 0x3d, 0xfd, 0xa8, 0x29, 0x23, 0x00, 0x1c, 0x9c, 0xaa, 0x02, 0x3b, 0xfd, 0xae, 0x3a, 0x23, 0x00, 0x2e, 0xc8, 0xff, 0x01, 0x00, 0x29, 0xcd, 0x62, 0xb9, 0x00, 0x1f, 0xec, 0xf5, 0x02, 0x02, 0x45, 0xf3, 0x9f, 0x42, 0x03, 0x23, 0x00, 0x0f, 0x61, 0x03, 0x06, 0x4e, 0xe9, 0x97, 0x43, 0x06, 0x23, 0x00, 0x0c, 0x01, 0x00, 0x8f, 0xf0, 0xac, 0x61, 0x1a, 0x00, 0x00, 0x00, 0xdd, 0x01, 0x00, 0x0a, 0x50, 0xdd, 0xdd, 0xb5, 0x73, 0x33, 
+};
+
+constexpr Escher::Image image = Escher::Image(35, 19, compressedPixelData, 295, true);
+
+const Escher::Image * const ImageStore::ChiSquaredIcon = &image;
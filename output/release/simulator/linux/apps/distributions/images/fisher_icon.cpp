@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "fisher_icon.h"
+
+// Compressed 665 pixels into 359 bytes (17.99% compression ratio)/
+const uint8_t compressedPixelData[359] = {0x1f, 0xff, 0x01, 0x00, 0xc4, 0x4f, 0x8e, 0xfe, 0x8d, 0xfe, 0x44, 0x00, 0x2d, 0x7f, 0x9b, 0xff, 0xc3, 0xfd, 0xc3, 0xfd, 0x78, 0x46, 0x00, 0x2c, 0x20, 0xd1, 0xfe, 0x46, 0x00, 0x1f, 0x4b, 0x8e, 0x00, 0x2c, 0x11, 0x29, 0x46, 0x00, 0x3f, 0xc3, 0xfd, 0x79, 0x44, 0x00, 0x28, 0x11, 0xdd, 0xd0, 0x00, 0x00, 0x02, 0x00, 0x1f, 0x6b, 0x8e, 0x00, 0x28, 0x15, 0x57, 0x46, 0x00, 0x0f, 0x1c, 0x01, 0x29, 0x26, 0xd1, 0xfe, 0x46, 0x00, 0x1f, 0x29, 0x8e, 0x00, 0x26, 0x17, 0x6b, 0x46, 0x00, 0x3f, 0xc3, 0xfd, 0xf2, 0x48, 0x00, 0x24, 0x19, 0x06, 0x46, 0x00, 0x1f, 0xc4, 0xd6, 0x00, 0x22, 0x17, 0xde, 0x16, 0x01, 0x02, 0x02, 0x00, 0x3f, 0xe5, 0xfd, 0x9a, 0x46, 0x00, 0x1e, 0x1d, 0x9a, 0x46, 0x00, 0x00, 0x90, 0x00, 0x1f, 0x35, 0x46, 0x00, 0x1c, 0x1e, 0x35, 0x46, 0x00, 0x03, 0xf6, 0x01, 0x1f, 0x9a, 0xa2, 0x01, 0x24, 0x0c, 0x02, 0x00, 0x5f, 0x4a, 0xfe, 0x15, 0xff, 0xde, 0x46, 0x00, 0x12, 0x1e, 0x6c, 0x46, 0x00, 0x0b, 0xde, 0x00, 0x5f, 0x4b, 0xfe, 0xf3, 0xfe, 0x9a, 0xfe, 0x02, 0x14, 0x0f, 0x02, 0x00, 0x0d, 0x7f, 0xe6, 0xfd, 0x6c, 0xfe, 0xf2, 0xfe, 0x78, 0x9c, 0x00, 0x04, 0x1f, 0xe5, 0x44, 0x00, 0x12, 0x0a, 0x50, 0x00, 0x95, 0x6b, 0xfe, 0xd0, 0xfe, 0x35, 0xff, 0x79, 0xff, 0xdd, 0x46, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x58, 0x2f, 0x9b, 0xa5, 0x22, 0x00, 0x0d, 0x4f, 0x2a, 0xfe, 0xff, 0x42, 0x23, 0x00, 0x0c, 0x4f, 0x85, 0xff, 0xff, 0xbd, 0x23, 0x00, 0x0c, 0x5f, 0xcd, 0xff, 0xff, 0xff, 0x3a, 0x22, 0x00, 0x0a, 0x6f, 0x13, 0xfd, 0xff, 0xff, 0xff, 0xb7, 0x23, 0x00, 0x0a, 0x11, 0x4e, 0x1f, 0x01, 0x1f, 0x3f, 0x23, 0x00, 0x09, 0x11, 0x81, 0x23, 0x00, 0x2f, 0xcd, 0x03, 0x23, 0x00, 0x08, 0x12, 0xb5, 0x66, 0x01, 0x1f, 0x79, 0x23, 0x00, 0x08, 0x12, 0xe2, 0x23, 0x00, 0x1f, 0xfa, 0xf9, 0x00, 0x07, 0x14, 0x0d, 0xad, 0x01, 0x2f, 0xf0, 0x35, 0x23, 0x00, 0x05, 0x15, 0x34, 0xd1, 0x01, 0x2f, 0xf4, 0x5a, 0x23, 0x00, 0x04, 0x17, 0x5c, 0x3c, 0x02, 0x2f, 0xb7, 0x33, 0x23, 0x00, 0x02, 0x19, 0x86, 0x61, 0x02, 0x3e, 0xc2, 0x61, 0x10, 0x23, 0x00, 0x1b, 0xac, 0x86, 0x02, 0x4b, 0xf9, 0xb9, 0x73, 0x2d, 0x23, 0x00, 0x2e, 0xce, 0xff, 0x01, 0x00, 0x56, 0xe9, 0xb1, 0x77, 0x40, 0x11, 0x23, 0x00, 0x1f, 0xee, 0x1b, 0x03, 0x05, 0xa0, 0xe3, 0xb6, 0x89, 0x5b, 0x36, 0x12, 0x00, 0x00, 0x00, 0x00, 
+};
+
+constexpr Escher::Image image = Escher::Image(35, 19, compressedPixelData, 359, true);
+
+const Escher::Image * const ImageStore::FisherIcon = &image;
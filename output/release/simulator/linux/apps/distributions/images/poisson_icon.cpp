@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "poisson_icon.h"
+
+// Compressed 665 pixels into 233 bytes (11.68% compression ratio)/
+const uint8_t compressedPixelData[233] = {0x1f, 0xff, 0x01, 0x00, 0x0c, 0x22, 0x48, 0xfe, 0x04, 0x00, 0x0f, 0x01, 0x00, 0x2b, 0x22, 0xc0, 0xfd, 0x04, 0x00, 0x0f, 0x46, 0x00, 0x6d, 0x26, 0x48, 0xfe, 0x46, 0x00, 0x2f, 0x48, 0xfe, 0x88, 0x00, 0x2d, 0x0f, 0x90, 0x00, 0x27, 0x08, 0x88, 0x00, 0x0f, 0x90, 0x00, 0x27, 0x0c, 0x42, 0x00, 0x0e, 0x90, 0x00, 0x0f, 0x46, 0x00, 0x53, 0x0e, 0xce, 0x00, 0x0e, 0xd6, 0x00, 0x0f, 0x88, 0x00, 0x27, 0x0e, 0x90, 0x00, 0x0f, 0x46, 0x00, 0x4b, 0x0e, 0xce, 0x00, 0x0f, 0xd6, 0x00, 0x21, 0x2f, 0xc0, 0xfd, 0x04, 0x00, 0x13, 0x0f, 0x46, 0x00, 0x4d, 0x0e, 0xce, 0x00, 0x0f, 0xd6, 0x00, 0x21, 0x2f, 0xc0, 0xfd, 0x04, 0x00, 0x1b, 0x0f, 0x88, 0x00, 0x2b, 0x0e, 0x90, 0x00, 0x0f, 0x42, 0x00, 0x25, 0x0a, 0x4a, 0x00, 0x0f, 0x42, 0x00, 0x29, 0x06, 0x4a, 0x00, 0x1b, 0x00, 0x01, 0x00, 0x4f, 0xbb, 0x00, 0xbb, 0x00, 0x01, 0x00, 0x0c, 0x3f, 0xff, 0x00, 0xff, 0x23, 0x00, 0x2e, 0x11, 0xbb, 0x23, 0x00, 0x1f, 0xbb, 0x44, 0x00, 0x0d, 0x0e, 0x48, 0x00, 0x0d, 0x44, 0x00, 0x0f, 0x48, 0x00, 0x0a, 0x17, 0xff, 0x02, 0x00, 0x0f, 0x23, 0x00, 0x25, 0x06, 0x67, 0x00, 0x0f, 0x6b, 0x00, 0x06, 0x1b, 0xff, 0x02, 0x00, 0x0f, 0x23, 0x00, 0x21, 0x1d, 0xbb, 0x23, 0x00, 0x1e, 0xbb, 0x44, 0x00, 0x0e, 0x02, 0x00, 0x0f, 0x23, 0x00, 0x1d, 0x0e, 0x67, 0x00, 0x0d, 0x6b, 0x00, 0x1f, 0xff, 0x02, 0x00, 0x04, 0x0e, 0x44, 0x00, 0x0e, 0x48, 0x00, 0x0f, 0x21, 0x00, 0x0d, 0x03, 0x25, 0x00, 0x0f, 0x21, 0x00, 0x0b, 0x50, 0xff, 0x00, 0xff, 0x00, 0xbb, 
+};
+
+constexpr Escher::Image image = Escher::Image(35, 19, compressedPixelData, 233, true);
+
+const Escher::Image * const ImageStore::PoissonIcon = &image;
@@ -0,0 +1,2529 @@
+#ifndef APPS_I18N_H
+#define APPS_I18N_H
+
+// This file is auto-generated by i18n.py
+
+#include <escher/i18n.h>
+#include <apps/country_preferences.h>
+
+namespace I18n {
+
+constexpr static int NumberOfLanguages = 7;
+
+constexpr static int NumberOfCountries = 10;
+
+enum class Message : uint16_t {
+  Default = 0,
+  A,
+  AbsCommandWithArg,
+  AccelerationOfGravitySymbol,
+  AcoshCommandWithArg,
+  AcotCommandWithArg,
+  AcscCommandWithArg,
+  AlmostEqual,
+  Alpha,
+  AndCommand,
+  AndCommandWithSpaces,
+  ArgCommandWithArg,
+  AsecCommandWithArg,
+  AsinhCommandWithArg,
+  AtanhCommandWithArg,
+  AvogadroConstantSymbol,
+  B,
+  BinomialCDFCommandWithArg,
+  BinomialCommandWithArg,
+  BinomialPDFCommandWithArg,
+  BlankMessage,
+  BoltzmannConstantSymbol,
+  C,
+  CapitalAlpha,
+  CeilCommandWithArg,
+  CircleRadiusTitle,
+  CmathModule,
+  CodeApp,
+  CodeAppCapital,
+  ColorMagenta,
+  ColorMagentaCurve,
+  ConditionAnd,
+  ConditionNot,
+  ConditionOr,
+  ConditionsMenu,
+  ConjCommandWithArg,
+  ConsolePrompt,
+  CoshCommandWithArg,
+  CotCommandWithArg,
+  CoulombConstantSymbol,
+  Cov,
+  CrossCommandWithArg,
+  CscCommandWithArg,
+  CubicRegressionFormula,
+  D,
+  Dash,
+  DefaultSetting,
+  DeterminantCommandWithArg,
+  DeviationSymbol,
+  DiffCommand,
+  DiffCommandWithArg,
+  DimensionCommandWithArg,
+  DiscreteLegend,
+  DotCommandWithArg,
+  E,
+  EccentricityTitle,
+  ElectronMassSymbol,
+  ElementaryChargeSymbol,
+  ElementsASymbol,
+  ElementsAffinitySymbol,
+  ElementsDensitySymbol,
+  ElementsElectronegativitySymbol,
+  ElementsMassSymbol,
+  ElementsRadiusSymbol,
+  ElementsZSymbol,
+  EllipseSemiMajorAxisTitle,
+  EllipseSemiMinorAxisTitle,
+  Equal,
+  EqualityCondition,
+  EqualityConditionWithArg,
+  ExamModeTitleBarIB,
+  ExamModeTitleBarKeystone,
+  ExamModeTitleBarNL,
+  ExamModeTitleBarPT,
+  ExamModeTitleBarSTAAR,
+  ExamModeTitleBarSouthCarolina,
+  ExamModeTitleBarUK,
+  ExponentialAbxRegressionFormula,
+  ExponentialAebxRegressionFormula,
+  FactorCommandWithArg,
+  FactorialCommand,
+  FactorialCommandWithArg,
+  FccId,
+  Finance360,
+  Finance365,
+  FinanceCY,
+  FinanceFV,
+  FinanceI,
+  FinanceLowerN,
+  FinanceN,
+  FinanceP,
+  FinancePV,
+  FinancePY,
+  FinancePmt,
+  FinanceRPct,
+  FiniteIntegralFirstLegend,
+  FiniteIntegralLegend,
+  FirstQuartileSymbol,
+  FloorCommandWithArg,
+  ForInListLoop,
+  ForInListLoopWithArg,
+  ForInRange1ArgLoop,
+  ForInRange1ArgLoopWithArg,
+  ForInRange2ArgsLoop,
+  ForInRange2ArgsLoopWithArg,
+  ForInRange3ArgsLoop,
+  ForInRange3ArgsLoopWithArg,
+  ForLoopMenu,
+  FracCommandWithArg,
+  GcdCommandWithArg,
+  GeomCDFCommandWithArg,
+  GeomCDFRangeCommandWithArg,
+  GeomPDFCommandWithArg,
+  Gon,
+  GravitationalConstantSymbol,
+  GreaterOrEqual,
+  GreekAlpha,
+  HigherOrderDiffCommand,
+  HigherOrderDiffCommandWithArg,
+  HyperbolaSemiMajorAxisTitle,
+  HyperbolaSemiMinorAxisTitle,
+  HypergeomCDFCommandWithArg,
+  HypergeomCDFRangeCommandWithArg,
+  HypergeomPDFCommandWithArg,
+  IfAndIfElseStatement,
+  IfAndIfElseStatementWithArg,
+  IfElifElseStatement,
+  IfElifElseStatementWithArg,
+  IfElseStatement,
+  IfElseStatementWithArg,
+  IfOrIfElseStatement,
+  IfOrIfElseStatementWithArg,
+  IfStatementMenu,
+  IfThenStatement,
+  IfThenStatementWithArg,
+  ImCommandWithArg,
+  IndentityCommandWithArg,
+  InferiorCondition,
+  InferiorConditionWithArg,
+  InferiorStrictCondition,
+  InferiorStrictConditionWithArg,
+  IntCommand,
+  IntCommandWithArg,
+  InvBinomialCommandWithArg,
+  InvGeomCommandWithArg,
+  InvHypergeomCommandWithArg,
+  InvNormCommandWithArg,
+  InvSortCommandWithArg,
+  InvStudentCommandWithArg,
+  InverseCommandWithArg,
+  IonModule,
+  KandinskyModule,
+  LanguageDE,
+  LanguageEN,
+  LanguageES,
+  LanguageFR,
+  LanguageIT,
+  LanguageNL,
+  LanguagePT,
+  LcmCommandWithArg,
+  LeftIntegralFirstLegend,
+  LeftIntegralSecondLegend,
+  LessOrEqual,
+  LineSlopeTitle,
+  LinearApbxRegressionFormula,
+  LinearEccentricityTitle,
+  LinearMxpbRegressionFormula,
+  LinearRegressionFormula,
+  ListCommand,
+  ListCommandWithArg,
+  ListLengthCommandWithArg,
+  ListMaxCommandWithArg,
+  ListMeanCommandWithArg,
+  ListMedianCommandWithArg,
+  ListMinCommandWithArg,
+  ListProductCommandWithArg,
+  ListSampleStandardDevCommandWithArg,
+  ListSequenceCommand,
+  ListSequenceCommandWithArg,
+  ListSortCommandWithArg,
+  ListStandardDevCommandWithArg,
+  ListSumCommandWithArg,
+  ListVarianceCommandWithArg,
+  LogCommandWithArg,
+  LogarithmicRegressionFormula,
+  LogisticRegressionFormula,
+  M,
+  ME,
+  MathModule,
+  MatplotlibPyplotModule,
+  MatrixCommand,
+  MatrixCommandWithArg,
+  MaxCommandWithArg,
+  MaximumSymbol,
+  MeanSymbol,
+  MinCommandWithArg,
+  MinimumSymbol,
+  MixedFractionCommand,
+  MixedFractionCommandWithArg,
+  MolarGasConstantSymbol,
+  MuMeanSymbol,
+  N,
+  NandCommand,
+  NandCommandWithSpaces,
+  NeutronMassSymbol,
+  NonEqualityCondition,
+  NonEqualityConditionWithArg,
+  NorCommand,
+  NorCommandWithSpaces,
+  NormCDFCommandWithArg,
+  NormCDFRangeCommandWithArg,
+  NormPDFCommandWithArg,
+  NormVectorCommandWithArg,
+  NotCommand,
+  NotCommandWithSpaces,
+  NotEqual,
+  NumpyModule,
+  OrCommand,
+  OrCommandWithSpaces,
+  ParabolaParameterTitle,
+  PermuteCommandWithArg,
+  PiecewiseCommand,
+  PiecewiseCommandWithArgs,
+  PlanckConstantSymbol,
+  Poisson,
+  PoissonCDFCommandWithArg,
+  PoissonPDFCommandWithArg,
+  PowerRegressionFormula,
+  PressToTest,
+  ProductCommand,
+  ProductCommandWithArg,
+  ProportionalRegressionFormula,
+  ProtonMassSymbol,
+  PythonCommand1J,
+  PythonCommandAbs,
+  PythonCommandAcos,
+  PythonCommandAcosh,
+  PythonCommandAmpersand,
+  PythonCommandAppend,
+  PythonCommandAppendWithoutArg,
+  PythonCommandArange,
+  PythonCommandArgmax,
+  PythonCommandArgmin,
+  PythonCommandArray,
+  PythonCommandArrow,
+  PythonCommandAsin,
+  PythonCommandAsinh,
+  PythonCommandAtan,
+  PythonCommandAtan2,
+  PythonCommandAtanh,
+  PythonCommandAxis,
+  PythonCommandAxisWithoutArg,
+  PythonCommandBar,
+  PythonCommandBin,
+  PythonCommandCeil,
+  PythonCommandChoice,
+  PythonCommandClear,
+  PythonCommandClearWithoutArg,
+  PythonCommandCmathFunction,
+  PythonCommandCmathFunctionWithoutArg,
+  PythonCommandColor,
+  PythonCommandColorBlack,
+  PythonCommandColorBlue,
+  PythonCommandColorBrown,
+  PythonCommandColorGray,
+  PythonCommandColorGreen,
+  PythonCommandColorOrange,
+  PythonCommandColorPink,
+  PythonCommandColorPurple,
+  PythonCommandColorRed,
+  PythonCommandColorWhite,
+  PythonCommandColorYellow,
+  PythonCommandComplex,
+  PythonCommandConcatenate,
+  PythonCommandConcatenateWithoutArg,
+  PythonCommandConstantE,
+  PythonCommandConstantPi,
+  PythonCommandCopySign,
+  PythonCommandCos,
+  PythonCommandCosComplex,
+  PythonCommandCosh,
+  PythonCommandCount,
+  PythonCommandCountWithoutArg,
+  PythonCommandCross,
+  PythonCommandDef,
+  PythonCommandDefWithArg,
+  PythonCommandDegrees,
+  PythonCommandDivMod,
+  PythonCommandDot,
+  PythonCommandDrawString,
+  PythonCommandErf,
+  PythonCommandErfc,
+  PythonCommandEval,
+  PythonCommandExp,
+  PythonCommandExpComplex,
+  PythonCommandExpm1,
+  PythonCommandFabs,
+  PythonCommandFactorial,
+  PythonCommandFillRect,
+  PythonCommandFlatten,
+  PythonCommandFlattenWithoutArg,
+  PythonCommandFloat,
+  PythonCommandFloor,
+  PythonCommandFmod,
+  PythonCommandFrExp,
+  PythonCommandGamma,
+  PythonCommandGcd,
+  PythonCommandGetPixel,
+  PythonCommandGetPixels,
+  PythonCommandGetrandbits,
+  PythonCommandGrid,
+  PythonCommandHex,
+  PythonCommandHist,
+  PythonCommandImag,
+  PythonCommandImagWithoutArg,
+  PythonCommandImportCmath,
+  PythonCommandImportFromCmath,
+  PythonCommandImportFromIon,
+  PythonCommandImportFromKandinsky,
+  PythonCommandImportFromMath,
+  PythonCommandImportFromMatplotlibPyplot,
+  PythonCommandImportFromMatplotlibPyplotTrimmed,
+  PythonCommandImportFromNumpy,
+  PythonCommandImportFromRandom,
+  PythonCommandImportFromTime,
+  PythonCommandImportFromTurtle,
+  PythonCommandImportIon,
+  PythonCommandImportKandinsky,
+  PythonCommandImportMath,
+  PythonCommandImportMatplotlibPyplot,
+  PythonCommandImportNumpy,
+  PythonCommandImportRandom,
+  PythonCommandImportTime,
+  PythonCommandImportTurtle,
+  PythonCommandIndex,
+  PythonCommandIndexWithoutArg,
+  PythonCommandInput,
+  PythonCommandInsert,
+  PythonCommandInsertWithoutArg,
+  PythonCommandInt,
+  PythonCommandIonFunction,
+  PythonCommandIonFunctionWithoutArg,
+  PythonCommandIsFinite,
+  PythonCommandIsInfinite,
+  PythonCommandIsKeyDown,
+  PythonCommandIsNaN,
+  PythonCommandKandinskyFunction,
+  PythonCommandKandinskyFunctionWithoutArg,
+  PythonCommandKeyAlpha,
+  PythonCommandKeyAns,
+  PythonCommandKeyBack,
+  PythonCommandKeyBackspace,
+  PythonCommandKeyComma,
+  PythonCommandKeyCosine,
+  PythonCommandKeyDivision,
+  PythonCommandKeyDot,
+  PythonCommandKeyDown,
+  PythonCommandKeyEe,
+  PythonCommandKeyEight,
+  PythonCommandKeyExe,
+  PythonCommandKeyExp,
+  PythonCommandKeyFive,
+  PythonCommandKeyFour,
+  PythonCommandKeyHome,
+  PythonCommandKeyImaginary,
+  PythonCommandKeyLeft,
+  PythonCommandKeyLeftParenthesis,
+  PythonCommandKeyLn,
+  PythonCommandKeyLog,
+  PythonCommandKeyMinus,
+  PythonCommandKeyMultiplication,
+  PythonCommandKeyNine,
+  PythonCommandKeyOk,
+  PythonCommandKeyOnOff,
+  PythonCommandKeyOne,
+  PythonCommandKeyPi,
+  PythonCommandKeyPlus,
+  PythonCommandKeyPower,
+  PythonCommandKeyRight,
+  PythonCommandKeyRightParenthesis,
+  PythonCommandKeySeven,
+  PythonCommandKeyShift,
+  PythonCommandKeySine,
+  PythonCommandKeySix,
+  PythonCommandKeySqrt,
+  PythonCommandKeySquare,
+  PythonCommandKeyTangent,
+  PythonCommandKeyThree,
+  PythonCommandKeyToolbox,
+  PythonCommandKeyTwo,
+  PythonCommandKeyUp,
+  PythonCommandKeyVar,
+  PythonCommandKeyXnt,
+  PythonCommandKeyZero,
+  PythonCommandLF,
+  PythonCommandLdexp,
+  PythonCommandLength,
+  PythonCommandLgamma,
+  PythonCommandLinspace,
+  PythonCommandLog,
+  PythonCommandLog10,
+  PythonCommandLog2,
+  PythonCommandLogComplex,
+  PythonCommandMathFunction,
+  PythonCommandMathFunctionWithoutArg,
+  PythonCommandMatplotlibPyplotFunction,
+  PythonCommandMatplotlibPyplotFunctionWithoutArg,
+  PythonCommandMax,
+  PythonCommandMean,
+  PythonCommandMedian,
+  PythonCommandMin,
+  PythonCommandModf,
+  PythonCommandMonotonic,
+  PythonCommandNumpyFunction,
+  PythonCommandNumpyFunctionWithoutArg,
+  PythonCommandNumpyMax,
+  PythonCommandNumpyMin,
+  PythonCommandNumpySort,
+  PythonCommandNumpySum,
+  PythonCommandOct,
+  PythonCommandOnes,
+  PythonCommandPercent,
+  PythonCommandPhase,
+  PythonCommandPlot,
+  PythonCommandPolar,
+  PythonCommandPolyVal,
+  PythonCommandPolyfit,
+  PythonCommandPop,
+  PythonCommandPopWithoutArg,
+  PythonCommandPound,
+  PythonCommandPower,
+  PythonCommandPrint,
+  PythonCommandRadians,
+  PythonCommandRandint,
+  PythonCommandRandom,
+  PythonCommandRandomFunction,
+  PythonCommandRandomFunctionWithoutArg,
+  PythonCommandRandrange,
+  PythonCommandRangeStartStop,
+  PythonCommandRangeStop,
+  PythonCommandReal,
+  PythonCommandRealWithoutArg,
+  PythonCommandRect,
+  PythonCommandRemove,
+  PythonCommandRemoveWithoutArg,
+  PythonCommandReshape,
+  PythonCommandReshapeWithoutArg,
+  PythonCommandReturn,
+  PythonCommandReverse,
+  PythonCommandReverseWithoutArg,
+  PythonCommandRound,
+  PythonCommandScatter,
+  PythonCommandSeed,
+  PythonCommandSetPixel,
+  PythonCommandSetPixels,
+  PythonCommandShape,
+  PythonCommandShapeWithoutArg,
+  PythonCommandShow,
+  PythonCommandSin,
+  PythonCommandSinComplex,
+  PythonCommandSingleQuote,
+  PythonCommandSinh,
+  PythonCommandSize,
+  PythonCommandSleep,
+  PythonCommandSort,
+  PythonCommandSortWithoutArg,
+  PythonCommandSorted,
+  PythonCommandSqrt,
+  PythonCommandSqrtComplex,
+  PythonCommandStd,
+  PythonCommandSum,
+  PythonCommandSymbolExp,
+  PythonCommandTab,
+  PythonCommandTan,
+  PythonCommandTanh,
+  PythonCommandText,
+  PythonCommandTimeFunction,
+  PythonCommandTimeFunctionWithoutArg,
+  PythonCommandTolist,
+  PythonCommandTolistWithoutArg,
+  PythonCommandTranspose,
+  PythonCommandTransposeWithoutArg,
+  PythonCommandTrunc,
+  PythonCommandTurtleFunction,
+  PythonCommandTurtleFunctionWithoutArg,
+  PythonCommandUniform,
+  PythonCommandVerticalBar,
+  PythonCommandZeros,
+  PythonConstantE,
+  PythonConstantPi,
+  PythonTurtleCommandBackward,
+  PythonTurtleCommandCircle,
+  PythonTurtleCommandColor,
+  PythonTurtleCommandColorMode,
+  PythonTurtleCommandForward,
+  PythonTurtleCommandGoto,
+  PythonTurtleCommandHeading,
+  PythonTurtleCommandHideturtle,
+  PythonTurtleCommandIsdown,
+  PythonTurtleCommandLeft,
+  PythonTurtleCommandPendown,
+  PythonTurtleCommandPensize,
+  PythonTurtleCommandPenup,
+  PythonTurtleCommandPosition,
+  PythonTurtleCommandReset,
+  PythonTurtleCommandRight,
+  PythonTurtleCommandSetheading,
+  PythonTurtleCommandShowturtle,
+  PythonTurtleCommandSpeed,
+  PythonTurtleCommandWrite,
+  QuadraticRegressionFormula,
+  QuarticRegressionFormula,
+  QuoCommandWithArg,
+  R,
+  R2,
+  RMax,
+  RMin,
+  RSquared,
+  Rad,
+  RandintCommandWithArg,
+  RandintCommandWithOnlyOneArg,
+  RandintNoRepeatCommandWithArg,
+  RandomCommandWithArg,
+  RandomModule,
+  ReCommandWithArg,
+  ReducedRowEchelonFormCommandWithArg,
+  RemCommandWithArg,
+  ResidualStandardDeviationMessageInTable,
+  ResidualStandardDeviationSymbol,
+  RightIntegralFirstLegend,
+  RightIntegralSecondLegend,
+  RootCommandWithArg,
+  RoundCommandWithArg,
+  RowEchelonFormCommandWithArg,
+  SE,
+  SampleStandardDeviationSSymbol,
+  SampleVarianceSymbol,
+  SecCommandWithArg,
+  Shift,
+  SinhCommandWithArg,
+  SortCommandWithArg,
+  SpeedOfLightSymbol,
+  StandardDeviationSigmaSymbol,
+  StatisticGraphControllerIntervalTitleFormat,
+  StudentCDFCommandWithArg,
+  StudentCDFRangeCommandWithArg,
+  StudentPDFCommandWithArg,
+  SumCommand,
+  SumCommandWithArg,
+  SumSquareValuesSymbol,
+  SumValuesSymbol,
+  SuperiorCondition,
+  SuperiorConditionWithArg,
+  SuperiorStrictCondition,
+  SuperiorStrictConditionWithArg,
+  Sxy,
+  T,
+  TMax,
+  TMin,
+  TanhCommandWithArg,
+  Theta,
+  ThetaMax,
+  ThetaMin,
+  ThirdQuartileSymbol,
+  TimeModule,
+  TotalFrequencySymbol,
+  TraceCommandWithArg,
+  TransferDataUrl,
+  TransposeCommandWithArg,
+  TrigonometricRegressionFormula,
+  TurtleModule,
+  USBAppCapital,
+  UnitAmountMoleMicroSymbol,
+  UnitAmountMoleMilliSymbol,
+  UnitAmountMoleSymbol,
+  UnitAngleDMSShortcut,
+  UnitAngleDMSShortcut2,
+  UnitAngleDegreeSymbol,
+  UnitAngleGradianSymbol,
+  UnitAngleRadianSymbol,
+  UnitCapacitanceFarad,
+  UnitCapacitanceFaradMicroSymbol,
+  UnitCapacitanceFaradMilliSymbol,
+  UnitCapacitanceFaradSymbol,
+  UnitChargeCoulomb,
+  UnitChargeCoulombSymbol,
+  UnitConductanceSiemens,
+  UnitConductanceSiemensMilliSymbol,
+  UnitConductanceSiemensSymbol,
+  UnitConversionCommand,
+  UnitConversionCommandWithArg,
+  UnitCurrentAmpereMicroSymbol,
+  UnitCurrentAmpereMilliSymbol,
+  UnitCurrentAmpereSymbol,
+  UnitDistanceAstronomicalUnitSymbol,
+  UnitDistanceFootSymbol,
+  UnitDistanceInchSymbol,
+  UnitDistanceLightYearSymbol,
+  UnitDistanceMeterCentiSymbol,
+  UnitDistanceMeterKiloSymbol,
+  UnitDistanceMeterMicroSymbol,
+  UnitDistanceMeterMilliSymbol,
+  UnitDistanceMeterNanoSymbol,
+  UnitDistanceMeterPicoSymbol,
+  UnitDistanceMeterSymbol,
+  UnitDistanceMileSymbol,
+  UnitDistanceParsec,
+  UnitDistanceParsecSymbol,
+  UnitDistanceYardSymbol,
+  UnitEnergyElectronVoltKiloSymbol,
+  UnitEnergyElectronVoltMegaSymbol,
+  UnitEnergyElectronVoltMilliSymbol,
+  UnitEnergyElectronVoltSymbol,
+  UnitEnergyJoule,
+  UnitEnergyJouleKilo,
+  UnitEnergyJouleKiloSymbol,
+  UnitEnergyJouleMenu,
+  UnitEnergyJouleMilliSymbol,
+  UnitEnergyJouleSymbol,
+  UnitForceNewton,
+  UnitForceNewtonKilo,
+  UnitForceNewtonKiloSymbol,
+  UnitForceNewtonMilliSymbol,
+  UnitForceNewtonSymbol,
+  UnitFrequencyHertz,
+  UnitFrequencyHertzGiga,
+  UnitFrequencyHertzGigaSymbol,
+  UnitFrequencyHertzKilo,
+  UnitFrequencyHertzKiloSymbol,
+  UnitFrequencyHertzMegaSymbol,
+  UnitFrequencyHertzSymbol,
+  UnitHorsePowerSymbol,
+  UnitInductanceHenry,
+  UnitInductanceHenrySymbol,
+  UnitLuminousIntensityCandela,
+  UnitLuminousIntensityCandelaSymbol,
+  UnitMagneticFieldTesla,
+  UnitMagneticFieldTeslaSymbol,
+  UnitMassGramKiloSymbol,
+  UnitMassGramMicroSymbol,
+  UnitMassGramMilliSymbol,
+  UnitMassGramSymbol,
+  UnitMassLongTonSymbol,
+  UnitMassOunceSymbol,
+  UnitMassPoundSymbol,
+  UnitMassShortTonSymbol,
+  UnitMassTonneSymbol,
+  UnitPotentialVolt,
+  UnitPotentialVoltKilo,
+  UnitPotentialVoltKiloSymbol,
+  UnitPotentialVoltMicroSymbol,
+  UnitPotentialVoltMilliSymbol,
+  UnitPotentialVoltSymbol,
+  UnitPowerWatt,
+  UnitPowerWattGiga,
+  UnitPowerWattGigaSymbol,
+  UnitPowerWattKilo,
+  UnitPowerWattKiloSymbol,
+  UnitPowerWattMegaSymbol,
+  UnitPowerWattMicroSymbol,
+  UnitPowerWattMilliSymbol,
+  UnitPowerWattSymbol,
+  UnitPressureAtmSymbol,
+  UnitPressureBar,
+  UnitPressureBarSymbol,
+  UnitPressurePascal,
+  UnitPressurePascalHectoSymbol,
+  UnitPressurePascalSymbol,
+  UnitResistanceOhm,
+  UnitResistanceOhmKilo,
+  UnitResistanceOhmKiloSymbol,
+  UnitResistanceOhmSymbol,
+  UnitSurfaceAcreSymbol,
+  UnitSurfaceHectarSymbol,
+  UnitTemperatureCelsius,
+  UnitTemperatureCelsiusSymbol,
+  UnitTemperatureFahrenheit,
+  UnitTemperatureFahrenheitSymbol,
+  UnitTemperatureKelvin,
+  UnitTemperatureKelvinSymbol,
+  UnitTimeDaySymbol,
+  UnitTimeHourSymbol,
+  UnitTimeMinuteSymbol,
+  UnitTimeMonthSymbol,
+  UnitTimeSecondMicroSymbol,
+  UnitTimeSecondMilliSymbol,
+  UnitTimeSecondNanoSymbol,
+  UnitTimeSecondSymbol,
+  UnitTimeWeekSymbol,
+  UnitTimeYearSymbol,
+  UnitVolumeCupSymbol,
+  UnitVolumeFluidOunceSymbol,
+  UnitVolumeGallonSymbol,
+  UnitVolumeLiterCentiSymbol,
+  UnitVolumeLiterDeciSymbol,
+  UnitVolumeLiterMilliSymbol,
+  UnitVolumeLiterSymbol,
+  UnitVolumePintSymbol,
+  UnitVolumeQuartSymbol,
+  UnitVolumeTablespoonSymbol,
+  UnitVolumeTeaspoonSymbol,
+  UnknownValue,
+  UpperN,
+  VacuumPermeabilitySymbol,
+  VacuumPermittivitySymbol,
+  WhileLoop,
+  WhileLoopMenu,
+  WhileLoopWithArg,
+  X,
+  XMax,
+  XMin,
+  XOfT,
+  XorCommand,
+  XorCommandWithSpaces,
+  Y,
+  YOfT,
+
+  LocalizedMessageMarker,
+
+  About,
+  AbsoluteValue,
+  AcName,
+  AcaridSizeSubtitle,
+  AcaridSizeTitle1,
+  AcaridSizeTitle2,
+  AccelerationOfGravity,
+  ActivateDeactivateListParamDescription,
+  ActivateDeactivateListParamTitle,
+  ActivateDeactivateStoreParamDescription,
+  ActivateDeactivateStoreParamTitle,
+  ActivateDutchExamMode,
+  ActivateEnglishExamMode,
+  ActivateExamMode,
+  ActivateFrenchExamMode,
+  ActivateIBExamMode,
+  ActivateKeystoneExamMode,
+  ActivatePortugueseExamMode,
+  ActivateSTAARExamMode,
+  ActivateSouthCarolinaExamMode,
+  ActivateTestMode,
+  ActiveDutchExamModeMessage,
+  ActiveDutchExamModeWithResetMessage,
+  ActiveEnglishExamModeMessage,
+  ActiveEnglishExamModeWithResetMessage,
+  ActiveExamModeMessage,
+  ActiveExamModeWithResetMessage,
+  ActivePortugueseExamModeMessage,
+  ActivePressToTestModeMessage,
+  ActivePressToTestWithResetMessage,
+  ActiveTxPaScIbExamModeMessage,
+  ActiveTxPaScIbExamModeWithResetMessage,
+  AddEquation,
+  AddFunction,
+  AddScript,
+  AddSequence,
+  AdditionalDeterminant,
+  AdditionalInverse,
+  AdditionalReducedRowEchelonForm,
+  AdditionalResults,
+  AdditionalRowEchelonForm,
+  AdditionalTrace,
+  AdnDiameterSubtitle,
+  AdnDiameterTitle1,
+  AdnDiameterTitle2,
+  AdvancedTrigonometry,
+  AffineType,
+  AfricaAreaSubtitle,
+  AfricaAreaTitle1,
+  AfricaAreaTitle2,
+  AgName,
+  AlName,
+  AllowedCharactersaz09,
+  AmName,
+  AndMessage,
+  AngleInZeroTwoPi,
+  AngleUnit,
+  AngleWithFirstAxis,
+  AnnualInterestRate,
+  ApproximateSolution,
+  ApproximateSolutionIntervalInstruction,
+  Apps,
+  AppsCapital,
+  ArName,
+  ArcCosecant,
+  ArcCotangent,
+  ArcSecant,
+  Area,
+  AreaBetweenCurves,
+  AreaBetweenCurvesWithFunctionName,
+  Argument,
+  Arithmetic,
+  AsName,
+  AscendingSorting,
+  AtName,
+  AtomNucleusDiameterSubtitle,
+  AtomNucleusDiameterTitle1,
+  AtomNucleusDiameterTitle2,
+  AuName,
+  AustraliaAreaSubtitle,
+  AustraliaAreaTitle1,
+  AustraliaAreaTitle2,
+  AutoImportScript,
+  AutoImportScriptSubLabel,
+  Autocomplete,
+  AvogadroConstant,
+  Axis,
+  BName,
+  BaName,
+  BacteriaSizeSubtitle,
+  BacteriaSizeTitle1,
+  BacteriaSizeTitle2,
+  BacteriaWeightSubtitle,
+  BacteriaWeightTitle1,
+  BacteriaWeightTitle2,
+  BarStart,
+  BarStartDescrition,
+  BasedLogarithm,
+  BasketballVolumeSubtitle,
+  BasketballVolumeTitle1,
+  BasketballVolumeTitle2,
+  BathtubVolumeSubtitle,
+  BathtubVolumeTitle1,
+  BathtubVolumeTitle2,
+  BeName,
+  BeginningEndPeriod,
+  BetaPopUp,
+  BetaVersion,
+  BetaVersionMessage1,
+  BetaVersionMessage2,
+  BetaVersionMessage3,
+  BetaVersionMessage4,
+  BetaVersionMessage5,
+  BetaVersionMessage6,
+  BhName,
+  BiName,
+  BigBenWeightSubtitle,
+  BigBenWeightTitle1,
+  BigBenWeightTitle2,
+  BinaryBase,
+  Binomial,
+  BinomialCDF,
+  BinomialDistribution,
+  BinomialPDF,
+  BkName,
+  BlackSeaVolumeSubtitle,
+  BlackSeaVolumeTitle1,
+  BlackSeaVolumeTitle2,
+  BlinkDurationSubtitle,
+  BlinkDurationTitle1,
+  BlinkDurationTitle2,
+  BoltzmannConstant,
+  BoxAndWhiskers,
+  BrName,
+  Brightness,
+  BuiltinsAndKeywords,
+  CName,
+  CaName,
+  CaffeineWeightSubtitle,
+  CaffeineWeightTitle1,
+  CaffeineWeightTitle2,
+  CalculApp,
+  CalculAppCapital,
+  CalculateOnFx,
+  CalculateOnTheCurve,
+  CalculatedValues,
+  CalculatorThicknessSubtitle,
+  CalculatorThicknessTitle1,
+  CalculatorThicknessTitle2,
+  Calculus,
+  CameraFlashDurationSubtitle,
+  CameraFlashDurationTitle1,
+  CameraFlashDurationTitle2,
+  CameraFlashPowerSubtitle,
+  CameraFlashPowerTitle1,
+  CameraFlashPowerTitle2,
+  CanVolumeSubtitle,
+  CanVolumeTitle1,
+  CanVolumeTitle2,
+  Cancel,
+  CapsuleVolumeSubtitle,
+  CapsuleVolumeTitle1,
+  CapsuleVolumeTitle2,
+  Cartesian,
+  CartesianNamedTemplate,
+  CatWeightSubtitle,
+  CatWeightTitle1,
+  CatWeightTitle2,
+  Catalog,
+  CategoricalTypeControllerTitle,
+  CdLaserPowerSubtitle,
+  CdLaserPowerTitle1,
+  CdLaserPowerTitle2,
+  CdName,
+  CeName,
+  Ceiling,
+  CenterAbscissaDescription,
+  CenterAbscissaTitle,
+  CenterOrdinateDescription,
+  CenterOrdinateTitle,
+  CfName,
+  ChannelAreaSubtitle,
+  ChannelAreaTitle1,
+  ChannelAreaTitle2,
+  CheopsPyramidVolumeSubtitle,
+  CheopsPyramidVolumeTitle1,
+  CheopsPyramidVolumeTitle2,
+  CheopsPyramidWeightSubtitle,
+  CheopsPyramidWeightTitle1,
+  CheopsPyramidWeightTitle2,
+  ChiSquare,
+  ChiSquareDistribution,
+  ChooseDistribution,
+  ChooseSequenceType,
+  CircleRadiusDescription,
+  CircleType,
+  ClName,
+  ClassTableAreaSubtitle,
+  ClassTableAreaTitle1,
+  ClassTableAreaTitle2,
+  ClearColumn,
+  ClearColumnConfirmation,
+  ClearTable,
+  ClearTableConfirmation,
+  CmName,
+  CnName,
+  CoName,
+  CobwebPlot,
+  CoefficientA,
+  CoefficientB,
+  CoefficientC,
+  CoefficientD,
+  CoefficientE,
+  CoefficientM,
+  CoinWeightSubtitle,
+  CoinWeightTitle1,
+  CoinWeightTitle2,
+  ColonConvention,
+  Color,
+  ColorBlue,
+  ColorBlueCurve,
+  ColorGreen,
+  ColorGreenCurve,
+  ColorOrange,
+  ColorOrangeCurve,
+  ColorPink,
+  ColorPinkCurve,
+  ColorRed,
+  ColorRedCurve,
+  ColorTurquoise,
+  ColorTurquoiseCurve,
+  ColorYellowDark,
+  ColorYellowDarkCurve,
+  ColumnOptions,
+  Combination,
+  Combinatorics,
+  ComplexAbsoluteValue,
+  ComplexFormat,
+  ComplexNumber,
+  CompoundInterest,
+  CompoundInterestDescription,
+  ComputerScreenAreaSubtitle,
+  ComputerScreenAreaTitle1,
+  ComputerScreenAreaTitle2,
+  ConclusionFailure1,
+  ConclusionFailure2,
+  ConclusionSuccess1,
+  ConclusionSuccess2,
+  Confidence,
+  ConfidenceInterval,
+  ConfidenceLevel,
+  ConfirmDiscard,
+  ConicNamedTemplate,
+  Conjugate,
+  ConnectedMessage1,
+  ConnectedMessage2,
+  ConnectedMessage3,
+  ConnectedMessage4,
+  ConnectedMessage5,
+  Console,
+  ConstantType,
+  Constants,
+  ContainerVolumeSubtitle,
+  ContainerVolumeTitle1,
+  ContainerVolumeTitle2,
+  CorrelationCoeff,
+  Cosecant,
+  Cotangent,
+  CoulombConstant,
+  Country,
+  CountryCA,
+  CountryDE,
+  CountryES,
+  CountryFR,
+  CountryGB,
+  CountryIT,
+  CountryNL,
+  CountryPT,
+  CountryUS,
+  CountryWW,
+  CountryWarning1,
+  CountryWarning2,
+  Covariance,
+  CrName,
+  CriticalValue,
+  Cross,
+  CsName,
+  CuName,
+  Cubic,
+  CumulatedFrequencyColumnHideDescription,
+  CumulatedFrequencyColumnHideTitle,
+  CumulatedFrequencyColumnName,
+  CumulatedFrequencyColumnToggleDescription,
+  CumulatedFrequencyColumnToggleTitle,
+  CumulativeFrequency,
+  CurveEquation,
+  CurveType,
+  D1FisherDefinition,
+  D2FisherDefinition,
+  DataNotSuitable,
+  DataNotSuitableForRegression,
+  DataTab,
+  DbName,
+  Decimal,
+  DecimalBase,
+  DecimalNumbers,
+  DefineParameters,
+  DefineVariable,
+  Deg,
+  Degrees,
+  DegreesOfFreedom,
+  DegreesOfFreedomDefinition,
+  DeleteExpression,
+  DeleteScript,
+  DeleteSequence,
+  DerivateNumber,
+  DerivativeFunctionColumn,
+  Details,
+  Determinant,
+  DeterminationCoeff,
+  Deviation,
+  Dimension,
+  DinosaursAgeSubtitle,
+  DinosaursAgeTitle1,
+  DinosaursAgeTitle2,
+  Disabled,
+  DisabledFeatureInTestMode1,
+  DisabledFeatureInTestMode2,
+  DisplayMode,
+  DisplayOutliers,
+  DisplayTypeTitle,
+  DisplayValues,
+  Distributions,
+  DistributionsApp,
+  DistributionsAppCapital,
+  Dot,
+  DoubleRecurrence,
+  DsName,
+  DyName,
+  EarthAreaSubtitle,
+  EarthAreaTitle1,
+  EarthAreaTitle2,
+  EarthAtmospherePressureSubtitle,
+  EarthAtmospherePressureTitle1,
+  EarthAtmospherePressureTitle2,
+  EarthAtmosphereWeightSubtitle,
+  EarthAtmosphereWeightTitle1,
+  EarthAtmosphereWeightTitle2,
+  EarthCircumferenceSubtitle,
+  EarthCircumferenceTitle1,
+  EarthCircumferenceTitle2,
+  EarthCorePressureSubtitle,
+  EarthCorePressureTitle1,
+  EarthCorePressureTitle2,
+  EarthRevolutionSpeedSubtitle,
+  EarthRevolutionSpeedTitle1,
+  EarthRevolutionSpeedTitle2,
+  EarthVolumeSubtitle,
+  EarthVolumeTitle1,
+  EarthVolumeTitle2,
+  EarthWeightSubtitle,
+  EarthWeightTitle1,
+  EarthWeightTitle2,
+  EccentricityDescription,
+  Edition2D,
+  EditionLinear,
+  EditionMode,
+  EiffelTowerHeigthSubtitle,
+  EiffelTowerHeigthTitle1,
+  EiffelTowerHeigthTitle2,
+  EiffelTowerVolumeSubtitle,
+  EiffelTowerVolumeTitle1,
+  EiffelTowerVolumeTitle2,
+  EiffelTowerWeightSubtitle,
+  EiffelTowerWeightTitle1,
+  EiffelTowerWeightTitle2,
+  EinsteinHeigthSubtitle,
+  EinsteinTitle1,
+  EinsteinTitle2,
+  EinsteinWeightSubtitle,
+  ElectronMass,
+  ElectronWeightSubtitle,
+  ElectronWeightTitle1,
+  ElectronWeightTitle2,
+  ElementaryCharge,
+  ElementsALegend,
+  ElementsAffinityLegend,
+  ElementsAffinitySubscript,
+  ElementsApp,
+  ElementsAppCapital,
+  ElementsBlockD,
+  ElementsBlockF,
+  ElementsBlockLegend,
+  ElementsBlockP,
+  ElementsBlockS,
+  ElementsBoilingPointLegend,
+  ElementsBoilingPointSubscript,
+  ElementsBoilingPointSymbol,
+  ElementsConfigurationLegend,
+  ElementsConfigurationSymbol,
+  ElementsDataConditions,
+  ElementsDensityLegend,
+  ElementsElectronegativityLegend,
+  ElementsGroupActinide,
+  ElementsGroupAlkali,
+  ElementsGroupAlkalineEarth,
+  ElementsGroupHalogen,
+  ElementsGroupLanthanide,
+  ElementsGroupLegend,
+  ElementsGroupMetalloid,
+  ElementsGroupNobleGas,
+  ElementsGroupNonmetal,
+  ElementsGroupPostTransitionMetal,
+  ElementsGroupSymbol,
+  ElementsGroupTransitionMetal,
+  ElementsGroupUnidentified,
+  ElementsIonizationLegend,
+  ElementsIonizationSubscript,
+  ElementsIonizationSymbol,
+  ElementsMassLegend,
+  ElementsMeltingPointLegend,
+  ElementsMeltingPointSubscript,
+  ElementsMeltingPointSymbol,
+  ElementsMetalLegend,
+  ElementsRadiusLegend,
+  ElementsStateGas,
+  ElementsStateLiquid,
+  ElementsStateSolid,
+  ElementsStateSymbol,
+  ElementsZLegend,
+  ElephantWeightSubtitle,
+  ElephantWeightTitle1,
+  ElephantWeightTitle2,
+  ElevatorAreaSubtitle,
+  ElevatorAreaTitle1,
+  ElevatorAreaTitle2,
+  EllipseSemiMajorAxisDescription,
+  EllipseSemiMinorAxisDescription,
+  EllipseType,
+  EmpireStateBuildingWeightSubtitle,
+  EmpireStateBuildingWeightTitle1,
+  EmpireStateBuildingWeightTitle2,
+  Empty,
+  Eng,
+  Engineering,
+  EnterEquation,
+  EquationType,
+  ErName,
+  EsName,
+  EuName,
+  EuclideanDivision,
+  EuroCoinVolumeSubtitle,
+  EuroCoinVolumeTitle1,
+  EuroCoinVolumeTitle2,
+  EverestAltitudeSubtitle,
+  EverestAltitudeTitle1,
+  EverestAltitudeTitle2,
+  ExactResults,
+  ExamMode,
+  ExecuteScript,
+  ExitExamMode,
+  ExitPressToTestExamMode,
+  Expected,
+  Explicit,
+  Exponential,
+  ExponentialDistribution,
+  ExponentialRegression,
+  ExponentialType,
+  Expressions,
+  ExternalAppIncompatible1,
+  ExternalAppIncompatible2,
+  FName,
+  Factorial,
+  FeName,
+  FillWithFormula,
+  FinalInterestAmount,
+  FinanceApp,
+  FinanceAppCapital,
+  FinanceBeginning,
+  FinanceEnd,
+  FinancePayment,
+  FinanceSolving,
+  FinanceSolvingReduced,
+  FinanceYear,
+  Find,
+  FirstQuartile,
+  FirstTermIndex,
+  Fisher,
+  FisherDistribution,
+  FlName,
+  Floor,
+  FmName,
+  FontSizes,
+  FootballMatchDurationSubtitle,
+  FootballMatchDurationTitle1,
+  FootballMatchDurationTitle2,
+  ForbiddenAppInExamMode1,
+  ForbiddenAppInExamMode2,
+  ForbiddenAppInPressToTestMode1,
+  ForbiddenAppInPressToTestMode2,
+  ForbiddenValue,
+  FormulaTemplateInt,
+  FormulaTemplateList,
+  FormulaTemplateLog,
+  FormulaTemplateRand,
+  FormulaTemplateSum,
+  FrName,
+  FracPart,
+  FranceAreaSubtitle,
+  FranceAreaTitle1,
+  FranceAreaTitle2,
+  Frequencies,
+  Frequency,
+  FunctionApp,
+  FunctionAppCapital,
+  FunctionColor,
+  FunctionDomain,
+  FunctionTab,
+  FunctionType,
+  Functions,
+  FunctionsAndVariables,
+  FutureValue,
+  GaName,
+  GdName,
+  GeName,
+  GeomCDF,
+  GeomCDFRange,
+  GeomPDF,
+  Geometric,
+  GeometricDistribution,
+  GoodnessOfFit,
+  Goto,
+  Gradians,
+  GraphCalculus,
+  GraphDerivative,
+  GraphTab,
+  GravitationalConstant,
+  GreatCommonDivisor,
+  GreaterOrEqualText,
+  Group,
+  H0Sub,
+  HName,
+  HaSub,
+  HardwareTestLaunch,
+  HeName,
+  HenEggWeightSubtitle,
+  HenEggWeightTitle1,
+  HenEggWeightTitle2,
+  HexadecimalBase,
+  HfName,
+  HgName,
+  HideDerivativeColumn,
+  HideSumOfTerms,
+  HigherOrderDerivateNumber,
+  Histogram,
+  HoName,
+  HomoSapiensAgeSubtitle,
+  HomoSapiensAgeTitle1,
+  HomoSapiensAgeTitle2,
+  Homogeneity,
+  HomogeneityResultsContributionsTitle,
+  HomogeneityResultsExpectedValuesTitle,
+  HorizontalLineType,
+  HorseWeightSubtitle,
+  HorseWeightTitle1,
+  HorseWeightTitle2,
+  HsName,
+  HumanCellWeightSubtitle,
+  HumanCellWeightTitle1,
+  HumanCellWeightTitle2,
+  HumanSpeedSubtitle,
+  HumanSpeedTitle1,
+  HumanSpeedTitle2,
+  HydrogenAtomRadiusSubtitle,
+  HydrogenAtomRadiusTitle1,
+  HydrogenAtomRadiusTitle2,
+  HyperbolaSemiMajorAxisDescription,
+  HyperbolaSemiMinorAxisDescription,
+  HyperbolaType,
+  HyperbolicCosine,
+  HyperbolicSine,
+  HyperbolicTangent,
+  HyperbolicTrigonometry,
+  HypergeomCDF,
+  HypergeomCDFRange,
+  HypergeomPDF,
+  Hypergeometric,
+  HypergeometricDistribution,
+  HypothesisControllerTitleOneMeanT,
+  HypothesisControllerTitleOneMeanZ,
+  HypothesisControllerTitleOneProp,
+  HypothesisControllerTitleSlope,
+  HypothesisControllerTitleTwoMeansPooledT,
+  HypothesisControllerTitleTwoMeansT,
+  HypothesisControllerTitleTwoMeansZ,
+  HypothesisControllerTitleTwoProps,
+  IName,
+  Identity,
+  ImaginaryPart,
+  ImportedModulesAndScripts,
+  InName,
+  InequalityType,
+  InferenceApp,
+  InferenceAppCapital,
+  InfiniteNumberOfSolutions,
+  InitialPrincipal,
+  InputGoodnessControllerTitle,
+  InputHomogeneityControllerTitle,
+  Integral,
+  InterquartileRange,
+  InterquartileRangeSymbol,
+  Intersection,
+  Interval,
+  IntervalADescr,
+  IntervalBDescr,
+  IntervalDescr,
+  IntervalR,
+  IntervalSet,
+  IntervalT,
+  IntervalTheta,
+  IntervalX,
+  Intervals,
+  InvBinomial,
+  InvGeom,
+  InvHypergeom,
+  InvNorm,
+  InvSort,
+  InvStudent,
+  InvalidInputWarning,
+  InvalidInputs,
+  InvalidSeries1,
+  InvalidSeries2,
+  InvalidValues,
+  Inverse,
+  InverseFunction,
+  InverseHyperbolicCosine,
+  InverseHyperbolicSine,
+  InverseHyperbolicTangent,
+  IrName,
+  JupiterDaySubtitle,
+  JupiterDayTitle1,
+  JupiterDayTitle2,
+  JupiterVolumeSubtitle,
+  JupiterVolumeTitle1,
+  JupiterVolumeTitle2,
+  JupiterWeightSubtitle,
+  JupiterWeightTitle1,
+  JupiterWeightTitle2,
+  KName,
+  KettlePowerSubtitle,
+  KettlePowerTitle1,
+  KettlePowerTitle2,
+  KrName,
+  LaName,
+  LacLemanVolumeSubtitle,
+  LacLemanVolumeTitle1,
+  LacLemanVolumeTitle2,
+  LambdaExponentialDefinition,
+  LambdaPoissonDefinition,
+  Language,
+  LargeFont,
+  LeastCommonMultiple,
+  LeaveAFieldEmpty,
+  LessOrEqualText,
+  LiName,
+  LifeExpectancySubtitle,
+  LifeExpectancyTitle1,
+  LifeExpectancyTitle2,
+  LightBulbPowerSubtitle,
+  LightBulbPowerTitle1,
+  LightBulbPowerTitle2,
+  LightSpeedSubtitle,
+  LightSpeedTitle1,
+  LightSpeedTitle2,
+  LineEquationDescription,
+  LineEquationTitle,
+  LineSlopeDescription,
+  LineType,
+  LineYInterceptDescription,
+  LineYInterceptTitle,
+  Linear,
+  LinearEccentricityDescription,
+  LinearType,
+  ListLength,
+  ListOfPointsType,
+  ListSequenceDescription,
+  Lists,
+  Logarithmic,
+  LogarithmicType,
+  Logic,
+  Logistic,
+  LondonAreaSubtitle,
+  LondonAreaTitle1,
+  LondonAreaTitle2,
+  LoopsAndTests,
+  LowBattery,
+  LrName,
+  LuName,
+  LucyAgeSubtitle,
+  LucyAgeTitle1,
+  LucyAgeTitle2,
+  LvName,
+  MakeOrthonormal,
+  ManhattanAreaSubtitle,
+  ManhattanAreaTitle1,
+  ManhattanAreaTitle2,
+  MarginOfError,
+  MarianaTrenchPressureSubtitle,
+  MarianaTrenchPressureTitle1,
+  MarianaTrenchPressureTitle2,
+  MarsAtmospherePressureSubtitle,
+  MarsAtmospherePressureTitle1,
+  MarsAtmospherePressureTitle2,
+  MarsWeightSubtitle,
+  MarsWeightTitle1,
+  MarsWeightTitle2,
+  Matrices,
+  MatricesAndVectors,
+  Maximum,
+  McName,
+  MdName,
+  Mean,
+  MeanDefinition,
+  MeanDot,
+  Median,
+  MedianRegression,
+  MedianSymbol,
+  MediterraneanSeaVolumeSubtitle,
+  MediterraneanSeaVolumeTitle1,
+  MediterraneanSeaVolumeTitle2,
+  MgName,
+  MilkyWayDiameterSubtitle,
+  MilkyWayDiameterTitle1,
+  MilkyWayDiameterTitle2,
+  Minimum,
+  MixedFraction,
+  MnName,
+  MoName,
+  Mode,
+  ModeFrequency,
+  ModeFrequencySymbol,
+  ModeSymbol,
+  Modules,
+  MolarGasConstant,
+  MonacoAreaSubtitle,
+  MonacoAreaTitle1,
+  MonacoAreaTitle2,
+  MoonAtmospherePressureSubtitle,
+  MoonAtmospherePressureTitle1,
+  MoonAtmospherePressureTitle2,
+  MoonDistanceSubtitle,
+  MoonDistanceTitle1,
+  MoonDistanceTitle2,
+  MoonVolumeSubtitle,
+  MoonVolumeTitle1,
+  MoonVolumeTitle2,
+  MoonWeightSubtitle,
+  MoonWeightTitle1,
+  MoonWeightTitle2,
+  MousquitoWeightSubtitle,
+  MousquitoWeightTitle1,
+  MousquitoWeightTitle2,
+  Move,
+  MtName,
+  NEnd,
+  NName,
+  NStart,
+  NaName,
+  NameCannotStartWithNumber,
+  NameTaken,
+  NameTooLong,
+  NandMessage,
+  Navigate,
+  NbName,
+  NdName,
+  NeName,
+  NeptuneAreaSubtitle,
+  NeptuneAreaTitle1,
+  NeptuneAreaTitle2,
+  NeutronMass,
+  NewList,
+  NewMatrix,
+  Next,
+  NhName,
+  NiName,
+  NileLengthSubtitle,
+  NileLengthTitle1,
+  NileLengthTitle2,
+  NoActivatedFunction,
+  NoActivatedSequence,
+  NoDataToPlot,
+  NoFunction,
+  NoIntersectionFound,
+  NoMaximumFound,
+  NoMinimumFound,
+  NoName,
+  NoPreimageFound,
+  NoSequence,
+  NoSolutionEquation,
+  NoSolutionInterval,
+  NoSolutionSystem,
+  NoValueToCompute,
+  NoWordAvailableHere,
+  NoZeroFound,
+  NominalAnnualInterestRate,
+  NonIntegerFrequencies,
+  NonLinearSystem,
+  NonrealEquation,
+  NorMessage,
+  NormCDF,
+  NormCDFRange,
+  NormPDF,
+  NormVector,
+  Normal,
+  NormalDistribution,
+  NormalProbabilityPlot,
+  NotEqualText,
+  NotMessage,
+  NotreDameVolumeSubtitle,
+  NotreDameVolumeTitle1,
+  NotreDameVolumeTitle2,
+  NpName,
+  NthRoot,
+  NumberCompoundingPeriodYear,
+  NumberOfDays,
+  NumberOfDaysConvention,
+  NumberOfDots,
+  NumberOfPayments,
+  NumberOfSuccesses,
+  NumberPaymentYear,
+  OName,
+  Observed,
+  OceansVolumeSubtitle,
+  OceansVolumeTitle1,
+  OceansVolumeTitle2,
+  OceansWeightSubtitle,
+  OceansWeightTitle1,
+  OceansWeightTitle2,
+  OgName,
+  Ok,
+  OlympicPoolVolumeSubtitle,
+  OlympicPoolVolumeTitle1,
+  OlympicPoolVolumeTitle2,
+  OnlyFirstSolutionsDisplayed0,
+  OnlyFirstSolutionsDisplayed1,
+  OpenLeftInterval,
+  OpenRightInterval,
+  Operations,
+  Options,
+  Or,
+  OrMessage,
+  OrangeWeightSubtitle,
+  OrangeWeightTitle1,
+  OrangeWeightTitle2,
+  OsName,
+  OtherUnitsMenu,
+  PName,
+  PValue,
+  PaName,
+  ParabolaFocalLengthDescription,
+  ParabolaParameterDescription,
+  ParabolaType,
+  ParabolaVertexAbscissaDescription,
+  ParabolaVertexAbscissaTitle,
+  ParabolaVertexOrdinateDescription,
+  ParabolaVertexOrdinateTitle,
+  ParameterChoose,
+  ParametricCircleType,
+  ParametricEllipseType,
+  ParametricEquationType,
+  ParametricLineType,
+  ParametricParabolaType,
+  ParisAreaSubtitle,
+  ParisAreaTitle1,
+  ParisAreaTitle2,
+  ParkingSpaceAreaSubtitle,
+  ParkingSpaceAreaTitle1,
+  ParkingSpaceAreaTitle2,
+  PaymentEachPeriod,
+  PbName,
+  PcPowerSubtitle,
+  PcPowerTitle1,
+  PcPowerTitle2,
+  PdName,
+  Permutation,
+  PieceWise,
+  PiecewiseFunction,
+  PiecewiseType,
+  PinAreaSubtitle,
+  PinAreaTitle1,
+  PinAreaTitle2,
+  PinVolumeSubtitle,
+  PinVolumeTitle1,
+  PinVolumeTitle2,
+  PingPongBallVolumeSubtitle,
+  PingPongBallVolumeTitle1,
+  PingPongBallVolumeTitle2,
+  PlanckConstant,
+  Plot,
+  PlotOptions,
+  PmName,
+  PoName,
+  PointType,
+  PoissonCDF,
+  PoissonDistribution,
+  PoissonPDF,
+  Polar,
+  PolarCircleType,
+  PolarEllipseType,
+  PolarEquationType,
+  PolarHorizontalLineType,
+  PolarHyperbolaType,
+  PolarLineType,
+  PolarParabolaType,
+  PolarVerticalLineType,
+  PolynomeHasNoRealSolution0,
+  PolynomeHasNoRealSolution1,
+  PolynomialType,
+  PoolMemoryFull1,
+  PoolMemoryFull2,
+  PooledProportion,
+  PooledTInterval,
+  PooledTTest,
+  Population1Std,
+  Population2Std,
+  PopulationSize,
+  PopulationStd,
+  PortugalLengthSubtitle,
+  PortugalLengthTitle1,
+  PortugalLengthTitle2,
+  Power,
+  PrName,
+  PredefinedVariablesIgnoredLeft,
+  PredefinedVariablesIgnoredRight,
+  PredefinedVariablesUsedLeft,
+  PredefinedVariablesUsedRight,
+  Preimage,
+  PresentValue,
+  PressToTestActiveIntro,
+  PressToTestElements,
+  PressToTestEquationSolver,
+  PressToTestExactResults,
+  PressToTestGraphDetails,
+  PressToTestImplicitPlots,
+  PressToTestInequalityGraphing,
+  PressToTestIntro1,
+  PressToTestLogBaseA,
+  PressToTestStatDiagnostics,
+  PressToTestStatDiagnosticsDescription,
+  PressToTestSum,
+  PressToTestVectors,
+  PressToTestVectorsDescription,
+  PrimeFactorDecomposition,
+  PrimeFactors,
+  Probability,
+  Product,
+  ProductOfElements,
+  Proportional,
+  ProtonMass,
+  ProtonWeightSubtitle,
+  ProtonWeightTitle1,
+  ProtonWeightTitle2,
+  PtName,
+  PuName,
+  Python1J,
+  PythonAbs,
+  PythonAcos,
+  PythonAcosh,
+  PythonAmpersand,
+  PythonAppend,
+  PythonArange,
+  PythonArgmax,
+  PythonArgmin,
+  PythonArray,
+  PythonArrow,
+  PythonAsin,
+  PythonAsinh,
+  PythonAtan,
+  PythonAtan2,
+  PythonAtanh,
+  PythonAxis,
+  PythonBar,
+  PythonBin,
+  PythonCeil,
+  PythonChoice,
+  PythonClear,
+  PythonCmathFunction,
+  PythonColor,
+  PythonColorBlack,
+  PythonColorBlue,
+  PythonColorBrown,
+  PythonColorGray,
+  PythonColorGreen,
+  PythonColorOrange,
+  PythonColorPink,
+  PythonColorPurple,
+  PythonColorRed,
+  PythonColorWhite,
+  PythonColorYellow,
+  PythonComplex,
+  PythonConcatenate,
+  PythonCopySign,
+  PythonCos,
+  PythonCosh,
+  PythonCount,
+  PythonCross,
+  PythonDegrees,
+  PythonDivMod,
+  PythonDot,
+  PythonDrawString,
+  PythonErf,
+  PythonErfc,
+  PythonEval,
+  PythonExp,
+  PythonExpm1,
+  PythonFabs,
+  PythonFactorial,
+  PythonFillRect,
+  PythonFlatten,
+  PythonFloat,
+  PythonFloor,
+  PythonFmod,
+  PythonFrExp,
+  PythonGamma,
+  PythonGcd,
+  PythonGetPixel,
+  PythonGetPixels,
+  PythonGetrandbits,
+  PythonGrid,
+  PythonHex,
+  PythonHist,
+  PythonImag,
+  PythonImportCmath,
+  PythonImportIon,
+  PythonImportKandinsky,
+  PythonImportMath,
+  PythonImportMatplotlibPyplot,
+  PythonImportNumpy,
+  PythonImportRandom,
+  PythonImportTime,
+  PythonImportTurtle,
+  PythonIndex,
+  PythonInput,
+  PythonInsert,
+  PythonInt,
+  PythonIonFunction,
+  PythonIsFinite,
+  PythonIsInfinite,
+  PythonIsKeyDown,
+  PythonIsNaN,
+  PythonKandinskyFunction,
+  PythonKeyAlpha,
+  PythonKeyAns,
+  PythonKeyBack,
+  PythonKeyBackspace,
+  PythonKeyComma,
+  PythonKeyCosine,
+  PythonKeyDivision,
+  PythonKeyDot,
+  PythonKeyDown,
+  PythonKeyEe,
+  PythonKeyEight,
+  PythonKeyExe,
+  PythonKeyExp,
+  PythonKeyFive,
+  PythonKeyFour,
+  PythonKeyHome,
+  PythonKeyImaginary,
+  PythonKeyLeft,
+  PythonKeyLeftParenthesis,
+  PythonKeyLn,
+  PythonKeyLog,
+  PythonKeyMinus,
+  PythonKeyMultiplication,
+  PythonKeyNine,
+  PythonKeyOk,
+  PythonKeyOnOff,
+  PythonKeyOne,
+  PythonKeyPi,
+  PythonKeyPlus,
+  PythonKeyPower,
+  PythonKeyRight,
+  PythonKeyRightParenthesis,
+  PythonKeySeven,
+  PythonKeyShift,
+  PythonKeySine,
+  PythonKeySix,
+  PythonKeySqrt,
+  PythonKeySquare,
+  PythonKeyTangent,
+  PythonKeyThree,
+  PythonKeyToolbox,
+  PythonKeyTwo,
+  PythonKeyUp,
+  PythonKeyVar,
+  PythonKeyXnt,
+  PythonKeyZero,
+  PythonLF,
+  PythonLdexp,
+  PythonLength,
+  PythonLgamma,
+  PythonLinspace,
+  PythonLog,
+  PythonLog10,
+  PythonLog2,
+  PythonMathFunction,
+  PythonMatplotlibPyplotFunction,
+  PythonMax,
+  PythonMean,
+  PythonMedian,
+  PythonMin,
+  PythonModf,
+  PythonModulePrefix,
+  PythonModuleSuffix,
+  PythonMonotonic,
+  PythonNumpyFunction,
+  PythonNumpyMax,
+  PythonNumpyMin,
+  PythonNumpySort,
+  PythonNumpySum,
+  PythonOct,
+  PythonOnes,
+  PythonPercent,
+  PythonPhase,
+  PythonPlot,
+  PythonPolar,
+  PythonPolyVal,
+  PythonPolyfit,
+  PythonPop,
+  PythonPound,
+  PythonPower,
+  PythonPrint,
+  PythonRadians,
+  PythonRandint,
+  PythonRandomFunction,
+  PythonRandrange,
+  PythonRangeStartStop,
+  PythonRangeStop,
+  PythonReal,
+  PythonRect,
+  PythonRemove,
+  PythonReshape,
+  PythonReverse,
+  PythonRound,
+  PythonScatter,
+  PythonScriptPrefix,
+  PythonScriptSuffix,
+  PythonSeed,
+  PythonSetPixel,
+  PythonSetPixels,
+  PythonShape,
+  PythonShow,
+  PythonSin,
+  PythonSingleQuote,
+  PythonSinh,
+  PythonSize,
+  PythonSleep,
+  PythonSort,
+  PythonSqrt,
+  PythonStd,
+  PythonSum,
+  PythonSymbolExp,
+  PythonTab,
+  PythonTan,
+  PythonTanh,
+  PythonText,
+  PythonTimeFunction,
+  PythonTolist,
+  PythonTranspose,
+  PythonTrunc,
+  PythonTurtleBackward,
+  PythonTurtleCircle,
+  PythonTurtleColor,
+  PythonTurtleColorMode,
+  PythonTurtleForward,
+  PythonTurtleFunction,
+  PythonTurtleGoto,
+  PythonTurtleHeading,
+  PythonTurtleHideturtle,
+  PythonTurtleIsdown,
+  PythonTurtleLeft,
+  PythonTurtlePendown,
+  PythonTurtlePensize,
+  PythonTurtlePenup,
+  PythonTurtlePosition,
+  PythonTurtleReset,
+  PythonTurtleRight,
+  PythonTurtleSetheading,
+  PythonTurtleShowturtle,
+  PythonTurtleSpeed,
+  PythonTurtleWrite,
+  PythonUniform,
+  PythonVerticalBar,
+  PythonZeros,
+  Quadratic,
+  Quartic,
+  QuennMaryPowerSubtitle,
+  QuennMaryPowerTitle1,
+  QuennMaryPowerTitle2,
+  Quotient,
+  REnd,
+  RStart,
+  RaName,
+  Radian,
+  Random,
+  RandomFloat,
+  RandomInteger,
+  RandomUniqueIntegers,
+  Range,
+  RangeSymbol,
+  RationalType,
+  RbName,
+  ReName,
+  ReactivateDutchExamMode,
+  ReactivateEnglishExamMode,
+  ReactivateExamMode,
+  ReactivateFrenchExamMode,
+  ReactivateIBExamMode,
+  ReactivateKeystoneExamMode,
+  ReactivatePortugueseExamMode,
+  ReactivateSTAARExamMode,
+  ReactivateSouthCarolinaExamMode,
+  Real,
+  RealPart,
+  RectangleWidth,
+  RectangleWidthDescription,
+  ReducedRowEchelonForm,
+  Regression,
+  RegressionApp,
+  RegressionAppCapital,
+  RegressionCurve,
+  RegressionEquation,
+  RegressionModel,
+  RelativeFrequency,
+  Remainder,
+  RemoveRegression,
+  Rename,
+  RepetitionNumber,
+  RequireEquation,
+  ResetCalculator,
+  ResetCalculatorWarning,
+  ResetFreqConfirmation,
+  ResetFrequencies,
+  Residual,
+  ResidualPlot,
+  ResidualStandardDeviation,
+  ResolveEquation,
+  ResolveSystem,
+  RfName,
+  RgName,
+  RhName,
+  RiceGrainLengthSubtitle,
+  RiceGrainLengthTitle1,
+  RiceGrainLengthTitle2,
+  RiceGrainWeightSubtitle,
+  RiceGrainWeightTitle1,
+  RiceGrainWeightTitle2,
+  RnName,
+  Rounding,
+  RowEchelonForm,
+  RuName,
+  SName,
+  Sample1Mean,
+  Sample1Proportion,
+  Sample1Size,
+  Sample1Std,
+  Sample2Mean,
+  Sample2Proportion,
+  Sample2Size,
+  Sample2Std,
+  SampleMean,
+  SampleProportion,
+  SampleSTD,
+  SampleSize,
+  SampleStandardDeviationS,
+  SampleTwoMeans,
+  SampleTwoProportions,
+  SampleVariance,
+  SandGrainAreaSubtitle,
+  SandGrainAreaTitle1,
+  SandGrainAreaTitle2,
+  SandGrainDiameterSubtitle,
+  SandGrainDiameterTitle1,
+  SandGrainDiameterTitle2,
+  SandGrainVolumeSubtitle,
+  SandGrainVolumeTitle1,
+  SandGrainVolumeTitle2,
+  SandGrainWeightSubtitle,
+  SandGrainWeightTitle1,
+  SandGrainWeightTitle2,
+  SatelliteSpeedSubtitle,
+  SatelliteSpeedTitle1,
+  SatelliteSpeedTitle2,
+  SaturnAreaSubtitle,
+  SaturnAreaTitle1,
+  SaturnAreaTitle2,
+  SaturnDistanceSubtitle,
+  SaturnDistanceTitle1,
+  SaturnDistanceTitle2,
+  SaturnWeightSubtitle,
+  SaturnWeightTitle1,
+  SaturnWeightTitle2,
+  SbName,
+  ScName,
+  Sci,
+  Scientific,
+  ScientificNotation,
+  ScriptInProgress,
+  ScriptOptions,
+  ScubaTankPressureSubtitle,
+  ScubaTankPressureTitle1,
+  ScubaTankPressureTitle2,
+  SeName,
+  SearchInverval,
+  Secant,
+  SelectFirstTerm,
+  SelectLastTerm,
+  SelectLowerBound,
+  SelectSecondCurve,
+  SelectUpperBound,
+  SemolinaGrainVolumeSubtitle,
+  SemolinaGrainVolumeTitle1,
+  SemolinaGrainVolumeTitle2,
+  SequenceApp,
+  SequenceAppCapital,
+  SequenceColor,
+  SequenceOptions,
+  SequenceTab,
+  SequenceType,
+  Sequences,
+  SerialNumber,
+  SettingsApp,
+  SettingsAppCapital,
+  SgName,
+  ShowSumOfTerms,
+  ShowSumOfTermsSublabel,
+  SiName,
+  SignificanceLevel,
+  SignificantFigures,
+  SimpleInterest,
+  SimpleInterestDescription,
+  SingleRecurrence,
+  SiriusDistanceSubtitle,
+  SiriusDistanceTitle1,
+  SiriusDistanceTitle2,
+  Skip,
+  Slope,
+  SmName,
+  SmallFont,
+  SmartphoneScreenAreaSubtitle,
+  SmartphoneScreenAreaTitle1,
+  SmartphoneScreenAreaTitle2,
+  SnName,
+  SnailSpeedSubtitle,
+  SnailSpeedTitle1,
+  SnailSpeedTitle2,
+  SoccerBallPressureSubtitle,
+  SoccerBallPressureTitle1,
+  SoccerBallPressureTitle2,
+  SoccerFieldAreaSubtitle,
+  SoccerFieldAreaTitle1,
+  SoccerFieldAreaTitle2,
+  SoccerFieldWidthSubtitle,
+  SoccerFieldWidthTitle1,
+  SoccerFieldWidthTitle2,
+  SoftwareVersion,
+  SolarSystemRadiusSubtitle,
+  SolarSystemRadiusTitle1,
+  SolarSystemRadiusTitle2,
+  Solution,
+  SolverApp,
+  SolverAppCapital,
+  Sort,
+  SortCellLabel,
+  SortSizes,
+  SortValues,
+  SoundSpeedSubtitle,
+  SoundSpeedTitle1,
+  SoundSpeedTitle2,
+  SpeedOfLight,
+  SpiderThreadSectionAreaSubtitle,
+  SpiderThreadSectionAreaTitle1,
+  SpiderThreadSectionAreaTitle2,
+  SquareSum,
+  SrName,
+  StampAreaSubtitle,
+  StampAreaTitle1,
+  StampAreaTitle2,
+  StandardDeviation,
+  StandardError,
+  StatTab,
+  StatisticGraphControllerTestTitleFormatGoodnessTest,
+  StatisticGraphControllerTestTitleFormatHomogeneityTest,
+  StatisticGraphControllerTestTitleFormatTTest,
+  StatisticGraphControllerTestTitleFormatZtest,
+  StatisticsBoxLowerWhisker,
+  StatisticsBoxOutlier,
+  StatisticsBoxUpperWhisker,
+  StatisticsFrequencyFcc,
+  StatisticsGraphSettings,
+  StatisticsGraphTab,
+  StatisticsGraphType,
+  StatisticsNormalProbabilityZScore,
+  StatisticsSampleMean,
+  StatisticsValue,
+  StatsApp,
+  StatsAppCapital,
+  Step,
+  StepLengthSubtitle,
+  StepLengthTitle1,
+  StepLengthTitle2,
+  StorageMemoryFull1,
+  StorageMemoryFull2,
+  Student,
+  StudentCDF,
+  StudentCDFRange,
+  StudentDistribution,
+  StudentPDF,
+  SuccessProbability,
+  SuccessSample1,
+  SuccessSample2,
+  Sum,
+  SumOfElements,
+  SumOfProducts,
+  SumSquareValues,
+  SumValues,
+  SunAreaSubtitle,
+  SunAreaTitle1,
+  SunAreaTitle2,
+  SunCorePressureSubtitle,
+  SunCorePressureTitle1,
+  SunCorePressureTitle2,
+  SunDiameterSubtitle,
+  SunDiameterTitle1,
+  SunDiameterTitle2,
+  SunDistanceSubtitle,
+  SunDistanceTitle1,
+  SunDistanceTitle2,
+  SunVolumeSubtitle,
+  SunVolumeTitle1,
+  SunVolumeTitle2,
+  SunWeightSubtitle,
+  SunWeightTitle1,
+  SunWeightTitle2,
+  SyntaxError,
+  TEnd,
+  TInterval,
+  TOrZInterval,
+  TOrZTest,
+  TStart,
+  TTest,
+  TaName,
+  TajMahalAreaSubtitle,
+  TajMahalAreaTitle1,
+  TajMahalAreaTitle2,
+  Tangent,
+  TbName,
+  TcName,
+  TeName,
+  TennisCourtAreaSubtitle,
+  TennisCourtAreaTitle1,
+  TennisCourtAreaTitle2,
+  TermSum,
+  TermsOfUse,
+  TermsOfUseLink,
+  Test,
+  TestCategorical,
+  TestDescr,
+  TestMode,
+  TestOneMean,
+  TestOneProp,
+  TestStatistic,
+  TestTwoMeans,
+  TestTwoProps,
+  Tests,
+  ThName,
+  TheAtlanticVolumeSubtitle,
+  TheAtlanticVolumeTitle1,
+  TheAtlanticVolumeTitle2,
+  TheChannelVolumeSubtitle,
+  TheChannelVolumeTitle1,
+  TheChannelVolumeTitle2,
+  ThetaEnd,
+  ThetaStart,
+  ThirdQuartile,
+  TiName,
+  TitanicWeightSubtitle,
+  TitanicWeightTitle1,
+  TitanicWeightTitle2,
+  TlName,
+  TmName,
+  ToDeactivateExamMode1,
+  ToDeactivateExamMode2,
+  ToDeactivateExamMode3,
+  ToDeactivatePressToTest1,
+  ToZoom,
+  TooManyDataPoints,
+  TooManyVariables,
+  Toolbox,
+  Total,
+  TotalFrequency,
+  TotalItemsWithFeature,
+  Trace,
+  TrainSpeedSubtitle,
+  TrainSpeedTitle1,
+  TrainSpeedTitle2,
+  Transpose,
+  TravelToMarsSubtitle,
+  TravelToMarsTitle1,
+  TravelToMarsTitle2,
+  TravelToTheMoonSubtitle,
+  TravelToTheMoonTitle1,
+  TravelToTheMoonTitle2,
+  TrigonometricType,
+  Trigonometrical,
+  Trigonometry,
+  TruckPowerSubtitle,
+  TruckPowerTitle1,
+  TruckPowerTitle2,
+  TsName,
+  TypeControllerTitleOne,
+  TypeControllerTitleTwo,
+  UName,
+  USBConnected,
+  UndefinedEquation,
+  UndefinedType,
+  UndefinedValue,
+  UnhandledType,
+  UniformDistribution,
+  Uniforme,
+  UnitAmountMenu,
+  UnitAmountMole,
+  UnitAmountMoleMicro,
+  UnitAmountMoleMilli,
+  UnitAndConstant,
+  UnitAngleDMS,
+  UnitAngleDegree,
+  UnitAngleGradian,
+  UnitAngleMenu,
+  UnitAngleRadian,
+  UnitCapacitanceFaradMicro,
+  UnitCapacitanceFaradMilli,
+  UnitCapacitanceMenu,
+  UnitConductanceSiemensMilli,
+  UnitConversion,
+  UnitCurrentAmpere,
+  UnitCurrentAmpereMicro,
+  UnitCurrentAmpereMilli,
+  UnitCurrentMenu,
+  UnitDistanceAndAngleMenu,
+  UnitDistanceAstronomicalUnit,
+  UnitDistanceFoot,
+  UnitDistanceInch,
+  UnitDistanceLightYear,
+  UnitDistanceMenu,
+  UnitDistanceMeter,
+  UnitDistanceMeterCenti,
+  UnitDistanceMeterKilo,
+  UnitDistanceMeterMicro,
+  UnitDistanceMeterMilli,
+  UnitDistanceMeterNano,
+  UnitDistanceMeterPico,
+  UnitDistanceMile,
+  UnitDistanceYard,
+  UnitElectricityMenu,
+  UnitEnergyAndPowerMenu,
+  UnitEnergyElectronVolt,
+  UnitEnergyElectronVoltKilo,
+  UnitEnergyElectronVoltMega,
+  UnitEnergyElectronVoltMilli,
+  UnitEnergyEletronVoltMenu,
+  UnitEnergyJouleMilli,
+  UnitEnergyMenu,
+  UnitForceAndPressureMenu,
+  UnitForceMenu,
+  UnitForceNewtonMilli,
+  UnitFrequencyHertzMega,
+  UnitFrequencyMenu,
+  UnitHorsePower,
+  UnitImperialMenu,
+  UnitMassGram,
+  UnitMassGramKilo,
+  UnitMassGramMicro,
+  UnitMassGramMilli,
+  UnitMassLongTon,
+  UnitMassMenu,
+  UnitMassOunce,
+  UnitMassPound,
+  UnitMassShortTon,
+  UnitMassTonne,
+  UnitMetricMenu,
+  UnitPotentialMenu,
+  UnitPotentialVoltMicro,
+  UnitPotentialVoltMilli,
+  UnitPowerMenu,
+  UnitPowerWattMega,
+  UnitPowerWattMicro,
+  UnitPowerWattMilli,
+  UnitPressureAtm,
+  UnitPressureMenu,
+  UnitPressurePascalHecto,
+  UnitResistanceMenu,
+  UnitSurfaceAcre,
+  UnitSurfaceHectar,
+  UnitSurfaceMenu,
+  UnitTemperatureMenu,
+  UnitTimeAndFrequencyMenu,
+  UnitTimeDay,
+  UnitTimeHour,
+  UnitTimeMenu,
+  UnitTimeMinute,
+  UnitTimeMonth,
+  UnitTimeSecond,
+  UnitTimeSecondMicro,
+  UnitTimeSecondMilli,
+  UnitTimeSecondNano,
+  UnitTimeWeek,
+  UnitTimeYear,
+  UnitVector,
+  UnitVolumeAndAreaMenu,
+  UnitVolumeCup,
+  UnitVolumeFluidOunce,
+  UnitVolumeGallon,
+  UnitVolumeLiter,
+  UnitVolumeLiterCenti,
+  UnitVolumeLiterDeci,
+  UnitVolumeLiterMilli,
+  UnitVolumeMenu,
+  UnitVolumePint,
+  UnitVolumeQuart,
+  UnitVolumeTablespoon,
+  UnitVolumeTeaspoon,
+  UniverseAgeSubtitle,
+  UniverseAgeTitle1,
+  UniverseAgeTitle2,
+  UpdateAvailable,
+  UpdateMessage1,
+  UpdateMessage2,
+  UpdateMessage3,
+  UpdateMessage4,
+  UpdatePopUp,
+  UranusWeightSubtitle,
+  UranusWeightTitle1,
+  UranusWeightTitle2,
+  UseEquationModel,
+  UseFunctionModel,
+  VName,
+  VacuumPermeability,
+  VacuumPermittivity,
+  ValueNotReachedByRegression,
+  Values,
+  ValuesOfX,
+  ValuesOfY,
+  ValuesTab,
+  VanVolumeSubtitle,
+  VanVolumeTitle1,
+  VanVolumeTitle2,
+  VariableCantBeEdited,
+  Variables,
+  VaticanAreaSubtitle,
+  VaticanAreaTitle1,
+  VaticanAreaTitle2,
+  Vectors,
+  VenusAtmospherePressureSubtitle,
+  VenusAtmospherePressureTitle1,
+  VenusAtmospherePressureTitle2,
+  VerticalLineType,
+  VirusSizeSubtitle,
+  VirusSizeTitle1,
+  VirusSizeTitle2,
+  VirusWeightSubtitle,
+  VirusWeightTitle1,
+  VirusWeightTitle2,
+  WName,
+  Warning,
+  WaterDropVolumeSubtitle,
+  WaterDropVolumeTitle1,
+  WaterDropVolumeTitle2,
+  WaterMoleculeWeightSubtitle,
+  WaterMoleculeWeightTitle1,
+  WaterMoleculeWeightTitle2,
+  WhaleWeightSubtitle,
+  WhaleWeightTitle1,
+  WhaleWeightTitle2,
+  WindTurbinePowerSubtitle,
+  WindTurbinePowerTitle1,
+  WindTurbinePowerTitle2,
+  WorldRecord100mSubtitle,
+  WorldRecord100mTitle1,
+  WorldRecord100mTitle2,
+  WritingAgeSubtitle,
+  WritingAgeTitle1,
+  WritingAgeTitle2,
+  X2Test,
+  XEnd,
+  XPrediction,
+  XRayPeriodSubtitle,
+  XRayPeriodTitle1,
+  XRayPeriodTitle2,
+  XStart,
+  XeName,
+  XorMessage,
+  YName,
+  YPrediction,
+  YbName,
+  ZInterval,
+  ZTest,
+  Zero,
+  Zeros,
+  ZnName,
+  ZrName,
+};
+
+enum class Language : uint8_t {
+  EN,
+  FR,
+  NL,
+  PT,
+  IT,
+  DE,
+  ES,
+};
+
+constexpr const Message LanguageNames[NumberOfLanguages] = {
+  Message::LanguageEN,
+  Message::LanguageFR,
+  Message::LanguageNL,
+  Message::LanguagePT,
+  Message::LanguageIT,
+  Message::LanguageDE,
+  Message::LanguageES,
+};
+
+enum class Country : uint8_t {
+  WW,
+  CA,
+  DE,
+  ES,
+  FR,
+  GB,
+  IT,
+  NL,
+  PT,
+  US,
+};
+
+constexpr const Message CountryNames[NumberOfCountries] = {
+  Message::CountryWW,
+  Message::CountryCA,
+  Message::CountryDE,
+  Message::CountryES,
+  Message::CountryFR,
+  Message::CountryGB,
+  Message::CountryIT,
+  Message::CountryNL,
+  Message::CountryPT,
+  Message::CountryUS,
+};
+
+constexpr static Country DefaultCountryForLanguage[NumberOfLanguages] = {
+  I18n::Country::US,
+  I18n::Country::FR,
+  I18n::Country::NL,
+  I18n::Country::PT,
+  I18n::Country::IT,
+  I18n::Country::DE,
+  I18n::Country::ES,
+};
+
+constexpr static CountryPreferences CountryPreferencesArray[] = {
+  CountryPreferences(CountryPreferences::AvailableExamModes::All, CountryPreferences::MethodForQuartiles::MedianOfSublist, CountryPreferences::OutlierDefaultVisibility::Hidden, Poincare::Preferences::UnitFormat::Metric, CountryPreferences::HomeAppsLayout::Default, CountryPreferences::DiscriminantSymbol::Delta, CountryPreferences::HistogramsOffset::None, CountryPreferences::YPredictedSymbol::YHat, CountryPreferences::StatsRowsLayout::Default, Poincare::Preferences::CombinatoricSymbols::Default, CountryPreferences::ListsStatsOrderInToolbox::Default, CountryPreferences::SequencesInitialRank::Zero, Poincare::Preferences::MixedFractions::Disabled, CountryPreferences::RegressionApp::Default, CountryPreferences::GraphTemplatesLayout::Default, Poincare::Preferences::LogarithmBasePosition::BottomRight, Poincare::Preferences::LogarithmKeyEvent::Default, Poincare::Preferences::ParabolaParameter::Default),
+  CountryPreferences(CountryPreferences::AvailableExamModes::StandardOnly, CountryPreferences::MethodForQuartiles::MedianOfSublist, CountryPreferences::OutlierDefaultVisibility::Hidden, Poincare::Preferences::UnitFormat::Metric, CountryPreferences::HomeAppsLayout::Default, CountryPreferences::DiscriminantSymbol::Delta, CountryPreferences::HistogramsOffset::None, CountryPreferences::YPredictedSymbol::YHat, CountryPreferences::StatsRowsLayout::Default, Poincare::Preferences::CombinatoricSymbols::Default, CountryPreferences::ListsStatsOrderInToolbox::Default, CountryPreferences::SequencesInitialRank::Zero, Poincare::Preferences::MixedFractions::Disabled, CountryPreferences::RegressionApp::Default, CountryPreferences::GraphTemplatesLayout::Default, Poincare::Preferences::LogarithmBasePosition::BottomRight, Poincare::Preferences::LogarithmKeyEvent::Default, Poincare::Preferences::ParabolaParameter::Default),
+  CountryPreferences(CountryPreferences::AvailableExamModes::StandardOnly, CountryPreferences::MethodForQuartiles::MedianOfSublist, CountryPreferences::OutlierDefaultVisibility::Hidden, Poincare::Preferences::UnitFormat::Metric, CountryPreferences::HomeAppsLayout::Default, CountryPreferences::DiscriminantSymbol::D, CountryPreferences::HistogramsOffset::None, CountryPreferences::YPredictedSymbol::YHat, CountryPreferences::StatsRowsLayout::Default, Poincare::Preferences::CombinatoricSymbols::Default, CountryPreferences::ListsStatsOrderInToolbox::Default, CountryPreferences::SequencesInitialRank::Zero, Poincare::Preferences::MixedFractions::Disabled, CountryPreferences::RegressionApp::Default, CountryPreferences::GraphTemplatesLayout::Default, Poincare::Preferences::LogarithmBasePosition::BottomRight, Poincare::Preferences::LogarithmKeyEvent::Default, Poincare::Preferences::ParabolaParameter::Default),
+  CountryPreferences(CountryPreferences::AvailableExamModes::StandardOnly, CountryPreferences::MethodForQuartiles::MedianOfSublist, CountryPreferences::OutlierDefaultVisibility::Hidden, Poincare::Preferences::UnitFormat::Metric, CountryPreferences::HomeAppsLayout::Default, CountryPreferences::DiscriminantSymbol::Delta, CountryPreferences::HistogramsOffset::None, CountryPreferences::YPredictedSymbol::YHat, CountryPreferences::StatsRowsLayout::Default, Poincare::Preferences::CombinatoricSymbols::Default, CountryPreferences::ListsStatsOrderInToolbox::Default, CountryPreferences::SequencesInitialRank::Zero, Poincare::Preferences::MixedFractions::Disabled, CountryPreferences::RegressionApp::Default, CountryPreferences::GraphTemplatesLayout::Default, Poincare::Preferences::LogarithmBasePosition::BottomRight, Poincare::Preferences::LogarithmKeyEvent::Default, Poincare::Preferences::ParabolaParameter::Default),
+  CountryPreferences(CountryPreferences::AvailableExamModes::StandardOnly, CountryPreferences::MethodForQuartiles::CumulatedFrequency, CountryPreferences::OutlierDefaultVisibility::Hidden, Poincare::Preferences::UnitFormat::Metric, CountryPreferences::HomeAppsLayout::Default, CountryPreferences::DiscriminantSymbol::Delta, CountryPreferences::HistogramsOffset::None, CountryPreferences::YPredictedSymbol::YHat, CountryPreferences::StatsRowsLayout::Default, Poincare::Preferences::CombinatoricSymbols::Default, CountryPreferences::ListsStatsOrderInToolbox::Default, CountryPreferences::SequencesInitialRank::Zero, Poincare::Preferences::MixedFractions::Disabled, CountryPreferences::RegressionApp::Default, CountryPreferences::GraphTemplatesLayout::Default, Poincare::Preferences::LogarithmBasePosition::BottomRight, Poincare::Preferences::LogarithmKeyEvent::Default, Poincare::Preferences::ParabolaParameter::Default),
+  CountryPreferences(CountryPreferences::AvailableExamModes::EnglishOnly, CountryPreferences::MethodForQuartiles::MedianOfSublist, CountryPreferences::OutlierDefaultVisibility::Hidden, Poincare::Preferences::UnitFormat::Metric, CountryPreferences::HomeAppsLayout::Default, CountryPreferences::DiscriminantSymbol::Delta, CountryPreferences::HistogramsOffset::None, CountryPreferences::YPredictedSymbol::YHat, CountryPreferences::StatsRowsLayout::Default, Poincare::Preferences::CombinatoricSymbols::Default, CountryPreferences::ListsStatsOrderInToolbox::Default, CountryPreferences::SequencesInitialRank::Zero, Poincare::Preferences::MixedFractions::Enabled, CountryPreferences::RegressionApp::Default, CountryPreferences::GraphTemplatesLayout::Default, Poincare::Preferences::LogarithmBasePosition::BottomRight, Poincare::Preferences::LogarithmKeyEvent::WithBaseTen, Poincare::Preferences::ParabolaParameter::Default),
+  CountryPreferences(CountryPreferences::AvailableExamModes::StandardOnly, CountryPreferences::MethodForQuartiles::CumulatedFrequency, CountryPreferences::OutlierDefaultVisibility::Hidden, Poincare::Preferences::UnitFormat::Metric, CountryPreferences::HomeAppsLayout::Variant2, CountryPreferences::DiscriminantSymbol::Delta, CountryPreferences::HistogramsOffset::None, CountryPreferences::YPredictedSymbol::YHat, CountryPreferences::StatsRowsLayout::Default, Poincare::Preferences::CombinatoricSymbols::Default, CountryPreferences::ListsStatsOrderInToolbox::Default, CountryPreferences::SequencesInitialRank::Zero, Poincare::Preferences::MixedFractions::Disabled, CountryPreferences::RegressionApp::Default, CountryPreferences::GraphTemplatesLayout::Default, Poincare::Preferences::LogarithmBasePosition::BottomRight, Poincare::Preferences::LogarithmKeyEvent::Default, Poincare::Preferences::ParabolaParameter::Default),
+  CountryPreferences(CountryPreferences::AvailableExamModes::DutchOnly, CountryPreferences::MethodForQuartiles::MedianOfSublist, CountryPreferences::OutlierDefaultVisibility::Hidden, Poincare::Preferences::UnitFormat::Metric, CountryPreferences::HomeAppsLayout::Variant3, CountryPreferences::DiscriminantSymbol::D, CountryPreferences::HistogramsOffset::OnIntegerValues, CountryPreferences::YPredictedSymbol::YHat, CountryPreferences::StatsRowsLayout::Default, Poincare::Preferences::CombinatoricSymbols::Default, CountryPreferences::ListsStatsOrderInToolbox::Default, CountryPreferences::SequencesInitialRank::Zero, Poincare::Preferences::MixedFractions::Enabled, CountryPreferences::RegressionApp::Default, CountryPreferences::GraphTemplatesLayout::Default, Poincare::Preferences::LogarithmBasePosition::TopLeft, Poincare::Preferences::LogarithmKeyEvent::WithBaseTen, Poincare::Preferences::ParabolaParameter::Default),
+  CountryPreferences(CountryPreferences::AvailableExamModes::PortugueseOnly, CountryPreferences::MethodForQuartiles::MedianOfSublist, CountryPreferences::OutlierDefaultVisibility::Hidden, Poincare::Preferences::UnitFormat::Metric, CountryPreferences::HomeAppsLayout::Variant1, CountryPreferences::DiscriminantSymbol::Delta, CountryPreferences::HistogramsOffset::None, CountryPreferences::YPredictedSymbol::Y, CountryPreferences::StatsRowsLayout::Default, Poincare::Preferences::CombinatoricSymbols::LetterWithSubAndSuperscript, CountryPreferences::ListsStatsOrderInToolbox::Default, CountryPreferences::SequencesInitialRank::One, Poincare::Preferences::MixedFractions::Disabled, CountryPreferences::RegressionApp::Default, CountryPreferences::GraphTemplatesLayout::Variant2, Poincare::Preferences::LogarithmBasePosition::BottomRight, Poincare::Preferences::LogarithmKeyEvent::Default, Poincare::Preferences::ParabolaParameter::Default),
+  CountryPreferences(CountryPreferences::AvailableExamModes::AmericanAll, CountryPreferences::MethodForQuartiles::MedianOfSublist, CountryPreferences::OutlierDefaultVisibility::Displayed, Poincare::Preferences::UnitFormat::Imperial, CountryPreferences::HomeAppsLayout::Variant4, CountryPreferences::DiscriminantSymbol::Delta, CountryPreferences::HistogramsOffset::None, CountryPreferences::YPredictedSymbol::YHat, CountryPreferences::StatsRowsLayout::Variant1, Poincare::Preferences::CombinatoricSymbols::Default, CountryPreferences::ListsStatsOrderInToolbox::Alternate, CountryPreferences::SequencesInitialRank::One, Poincare::Preferences::MixedFractions::Enabled, CountryPreferences::RegressionApp::Variant1, CountryPreferences::GraphTemplatesLayout::Variant1, Poincare::Preferences::LogarithmBasePosition::BottomRight, Poincare::Preferences::LogarithmKeyEvent::WithBaseTen, Poincare::Preferences::ParabolaParameter::FocalLength),
+};
+
+constexpr const char * LanguageISO6391Codes[NumberOfLanguages] = {
+  "en",
+  "fr",
+  "nl",
+  "pt",
+  "it",
+  "de",
+  "es",
+};
+
+}
+
+#endif
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "inference_icon.h"
+
+// Compressed 3080 pixels into 1296 bytes (21.04% compression ratio)/
+const uint8_t compressedPixelData[1296] = {0x17, 0xff, 0x01, 0x00, 0x5f, 0xdf, 0xff, 0x9e, 0xf7, 0xbe, 0x02, 0x00, 0x3a, 0x4f, 0x9e, 0xf7, 0xdf, 0xff, 0x01, 0x00, 0x01, 0x2f, 0xbe, 0xf7, 0x02, 0x00, 0x49, 0x0a, 0x6c, 0x00, 0x0f, 0xd4, 0x00, 0x3d, 0x0e, 0xe4, 0x00, 0x0f, 0x6c, 0x00, 0x57, 0x08, 0x70, 0x00, 0x2f, 0xbe, 0xf7, 0x02, 0x00, 0x55, 0x0f, 0x6e, 0x00, 0x5d, 0x0f, 0x46, 0x01, 0x51, 0x06, 0x4e, 0x01, 0x0f, 0x6e, 0x00, 0xc9, 0x1f, 0xbe, 0x02, 0x00, 0xf0, 0x7f, 0x7c, 0xf7, 0xb2, 0xfe, 0xb2, 0xfe, 0x7c, 0x6c, 0x00, 0x52, 0xbf, 0x9d, 0xf7, 0x09, 0xfe, 0xa6, 0xfd, 0xa6, 0xfd, 0x0a, 0xfe, 0x9d, 0x6e, 0x00, 0x50, 0x60, 0xb2, 0xfe, 0xa6, 0xfd, 0xc7, 0xfd, 0x70, 0x00, 0x2f, 0xb2, 0xfe, 0xda, 0x00, 0x4f, 0xc8, 0xc8, 0xfd, 0xa6, 0xfd, 0x91, 0xfe, 0x90, 0xfe, 0xa6, 0xfd, 0xc8, 0xfd, 0xde, 0x00, 0x6f, 0x38, 0xc6, 0x92, 0x94, 0xf7, 0xbd, 0x6e, 0x00, 0x3b, 0x11, 0xf6, 0x46, 0x01, 0x40, 0x7b, 0xf7, 0x7c, 0xf7, 0xe0, 0x00, 0x15, 0xf5, 0xde, 0x00, 0x40, 0x55, 0xad, 0x08, 0x42, 0x02, 0x00, 0x2f, 0xd3, 0x9c, 0x6e, 0x00, 0x39, 0x51, 0x4d, 0xfe, 0xa6, 0xfd, 0x4d, 0x64, 0x00, 0x53, 0x4e, 0xfe, 0xa6, 0xfd, 0x2c, 0x6e, 0x00, 0x60, 0xfb, 0xde, 0x29, 0x42, 0x08, 0x42, 0x04, 0x00, 0x4f, 0x09, 0x42, 0x59, 0xce, 0x48, 0x01, 0x37, 0x06, 0xd2, 0x00, 0x22, 0x16, 0xf7, 0xe6, 0x00, 0x00, 0x0c, 0x00, 0xff, 0x00, 0xf0, 0x7b, 0x08, 0x42, 0x49, 0x42, 0x53, 0x84, 0x6a, 0x4a, 0x08, 0x42, 0x2d, 0x63, 0x9e, 0x48, 0x01, 0x38, 0x37, 0xc6, 0xfd, 0x9c, 0xc2, 0x01, 0x20, 0xd3, 0xfe, 0xda, 0x00, 0xa0, 0x09, 0x42, 0x08, 0x42, 0x6f, 0x6b, 0x94, 0x8c, 0xf1, 0x7b, 0x4e, 0x01, 0x1f, 0xf8, 0xbe, 0x01, 0x34, 0x15, 0x6f, 0x48, 0x01, 0x04, 0x0e, 0x00, 0x00, 0x4c, 0x01, 0x20, 0x92, 0x94, 0xda, 0x00, 0xcf, 0x74, 0x8c, 0x94, 0x8c, 0x94, 0x8c, 0x8b, 0x52, 0x08, 0x42, 0x4d, 0x6b, 0x6e, 0x00, 0x33, 0x55, 0xe8, 0xfd, 0xa6, 0xfd, 0xd4, 0x6e, 0x00, 0x02, 0x4c, 0x01, 0x91, 0x5b, 0xef, 0x4a, 0x4a, 0x08, 0x42, 0x4e, 0x63, 0x94, 0x6e, 0x00, 0x20, 0xd0, 0x73, 0xde, 0x00, 0x2f, 0x9a, 0xd6, 0x6c, 0x00, 0x2f, 0x11, 0x59, 0x5e, 0x00, 0x1b, 0x5a, 0xc6, 0x01, 0x20, 0xb0, 0xcd, 0x1c, 0x02, 0x42, 0x53, 0x84, 0x94, 0x8c, 0x02, 0x00, 0x00, 0xbc, 0x01, 0x2f, 0x31, 0x84, 0xd8, 0x03, 0x33, 0x2c, 0xe9, 0xfd, 0xa2, 0x02, 0x84, 0xe9, 0xcc, 0x08, 0x42, 0xcc, 0x5a, 0x94, 0x8c, 0x02, 0x00, 0x8f, 0x6f, 0x6b, 0x08, 0x42, 0x49, 0x4a, 0x5d, 0xef, 0x6e, 0x00, 0x2d, 0x59, 0x2c, 0xfe, 0xa6, 0xfd, 0x6f, 0x40, 0x04, 0xa6, 0xd4, 0xfe, 0xa6, 0xfd, 0x66, 0xf5, 0x08, 0x42, 0xd0, 0x73, 0x6e, 0x00, 0x20, 0x53, 0x84, 0x34, 0x02, 0x2f, 0x76, 0xad, 0xfe, 0x02, 0x2d, 0x59, 0xc6, 0xfd, 0xa6, 0xfd, 0x16, 0x4e, 0x08, 0x11, 0x7b, 0x5c, 0x01, 0x22, 0x08, 0x73, 0x22, 0x02, 0x04, 0x02, 0x00, 0x5f, 0xcc, 0x5a, 0x08, 0x42, 0x6e, 0x2a, 0x02, 0x2c, 0x11, 0x17, 0x5a, 0x00, 0x0c, 0x8a, 0x05, 0x79, 0x47, 0xe5, 0xa6, 0xfd, 0x69, 0xb4, 0x94, 0x6e, 0x00, 0x11, 0xd1, 0x2a, 0x02, 0x2f, 0xdb, 0xde, 0x6e, 0x00, 0x29, 0x00, 0x1a, 0x05, 0x1b, 0x2b, 0x88, 0x05, 0xaa, 0xba, 0xd6, 0x07, 0xac, 0xa6, 0xfd, 0x68, 0xe5, 0x94, 0x8c, 0x02, 0x00, 0x2f, 0x4a, 0x4a, 0xc4, 0x04, 0x2d, 0x2e, 0xe9, 0xfd, 0xf6, 0x05, 0x41, 0xb2, 0x94, 0x08, 0x73, 0x0e, 0x06, 0x1a, 0x9c, 0x6e, 0x00, 0x6f, 0x2e, 0x63, 0x08, 0x42, 0xab, 0x52, 0x54, 0x04, 0x27, 0x02, 0xa2, 0x01, 0x1b, 0x39, 0x5c, 0x08, 0xaa, 0xab, 0x52, 0x28, 0x42, 0xa7, 0xfd, 0xa6, 0xfd, 0x0e, 0xbd, 0x6e, 0x00, 0x20, 0x12, 0x7c, 0x4c, 0x01, 0x2f, 0x39, 0xc6, 0x6e, 0x00, 0x25, 0x11, 0xd4, 0x62, 0x06, 0x1a, 0x9e, 0x80, 0x03, 0x10, 0xce, 0x54, 0x00, 0x6c, 0xea, 0xfd, 0xa6, 0xfd, 0x6a, 0xdd, 0x4c, 0x01, 0x6f, 0x8b, 0x4a, 0x08, 0x42, 0x30, 0x84, 0xfc, 0x05, 0x29, 0x1b, 0x4e, 0x48, 0x01, 0x71, 0x51, 0x8c, 0x08, 0x42, 0x0c, 0x63, 0x4d, 0x84, 0x06, 0x1b, 0x93, 0x6e, 0x00, 0x02, 0x76, 0x03, 0x2f, 0x7d, 0xef, 0xfc, 0x05, 0x2d, 0x04, 0x02, 0x00, 0x20, 0x7d, 0xef, 0x36, 0x04, 0x31, 0x14, 0xa5, 0x90, 0x6e, 0x00, 0x2a, 0xf0, 0xac, 0x6e, 0x00, 0x02, 0x76, 0x03, 0x2f, 0x96, 0xb5, 0xfc, 0x05, 0x2d, 0x04, 0x02, 0x00, 0x20, 0xb6, 0xb5, 0xb2, 0x04, 0x40, 0x1c, 0xe7, 0x92, 0xfe, 0x40, 0x02, 0x2c, 0x4c, 0xd5, 0x4c, 0x01, 0x2f, 0xcc, 0x52, 0x76, 0x03, 0x25, 0x19, 0x4e, 0xfc, 0x05, 0x02, 0x02, 0x00, 0xfc, 0x01, 0x6e, 0x6b, 0x08, 0x42, 0xaf, 0x73, 0xbe, 0xf7, 0x92, 0xfe, 0x0b, 0xfe, 0xa6, 0xfd, 0xa7, 0xf5, 0x6e, 0x00, 0x20, 0xb0, 0x73, 0x8e, 0x00, 0x2f, 0xfb, 0xde, 0x48, 0x01, 0x31, 0x20, 0xdb, 0xde, 0x22, 0x02, 0x20, 0xf7, 0xbd, 0x6e, 0x00, 0x11, 0x4e, 0x4c, 0x01, 0x1b, 0xd0, 0x4c, 0x01, 0x8f, 0x74, 0x8c, 0x49, 0x4a, 0x08, 0x42, 0xb3, 0x94, 0x90, 0x02, 0x21, 0x3d, 0xc7, 0xfd, 0x9d, 0x22, 0x02, 0x11, 0x8a, 0x52, 0x03, 0x40, 0x92, 0xfe, 0x6f, 0xfe, 0x8a, 0x06, 0x1d, 0x4b, 0x4c, 0x01, 0x00, 0x76, 0x03, 0x1f, 0x8a, 0x76, 0x03, 0x1e, 0x1d, 0x0a, 0x8e, 0x05, 0x40, 0x1c, 0xe7, 0x29, 0x42, 0x22, 0x02, 0x13, 0xbe, 0x6e, 0x00, 0x01, 0x4c, 0x01, 0x3a, 0xfd, 0xb3, 0x94, 0x6e, 0x00, 0x20, 0x32, 0x84, 0x00, 0x01, 0x1f, 0xb6, 0x2a, 0x02, 0x1a, 0x11, 0xf5, 0x28, 0x01, 0x19, 0x59, 0x14, 0x00, 0x00, 0xae, 0x07, 0x13, 0x6a, 0x56, 0x06, 0x00, 0x6e, 0x00, 0x3e, 0x4e, 0xfe, 0xc6, 0xe4, 0x03, 0x03, 0xa0, 0x05, 0x1f, 0x0c, 0xa8, 0x08, 0x18, 0x11, 0x9d, 0xb2, 0x04, 0x2a, 0x4d, 0xfe, 0x1e, 0x05, 0x26, 0x29, 0x42, 0x92, 0x01, 0x00, 0x6e, 0x00, 0x40, 0x6f, 0xfe, 0xea, 0xfd, 0x2a, 0x02, 0x1b, 0x93, 0xde, 0x00, 0x11, 0x11, 0x54, 0x04, 0x1f, 0xd7, 0xa8, 0x08, 0x16, 0x2a, 0x91, 0xfe, 0xb0, 0x07, 0x00, 0x68, 0x03, 0x11, 0x2d, 0x90, 0x01, 0x28, 0x5d, 0xef, 0x6e, 0x00, 0x02, 0x2a, 0x02, 0x2c, 0x2c, 0xcd, 0xde, 0x00, 0x20, 0xab, 0x52, 0x32, 0x05, 0x2f, 0x3d, 0xe7, 0x66, 0x06, 0x17, 0x28, 0x90, 0xfe, 0x1c, 0x05, 0x2a, 0x10, 0x84, 0xb0, 0x00, 0x02, 0x6e, 0x00, 0x20, 0x6f, 0xfe, 0xde, 0x01, 0x0e, 0x4e, 0x01, 0x20, 0x32, 0x7c, 0xe6, 0x03, 0x2f, 0x8e, 0x73, 0x56, 0x04, 0x0f, 0x3b, 0x39, 0xf7, 0xc7, 0x5e, 0x0c, 0x22, 0x7d, 0xef, 0x6c, 0x00, 0x4c, 0x51, 0x8c, 0xbe, 0xf7, 0x6e, 0x00, 0x31, 0x4f, 0xfe, 0xe8, 0x1e, 0x0c, 0x4c, 0x2d, 0xcd, 0x93, 0x94, 0xc4, 0x04, 0x00, 0x88, 0x09, 0x0e, 0x7a, 0x03, 0x08, 0x36, 0x0d, 0x20, 0xb3, 0xfe, 0x6c, 0x00, 0x15, 0xc8, 0x46, 0x01, 0x60, 0x5d, 0xef, 0x96, 0xb5, 0xcb, 0x5a, 0x3a, 0x00, 0x4e, 0xcf, 0x7b, 0x9e, 0xf7, 0x6e, 0x00, 0x00, 0x4e, 0x01, 0x00, 0x62, 0x0a, 0x00, 0xc0, 0x01, 0x46, 0x2d, 0xcd, 0xd1, 0xa4, 0x3a, 0x05, 0x31, 0x4e, 0x63, 0x08, 0x4a, 0x0b, 0x4a, 0x51, 0x8c, 0x59, 0xce, 0x32, 0x02, 0x91, 0x5c, 0xef, 0x29, 0xd5, 0x47, 0xe5, 0x87, 0xf5, 0xa6, 0x38, 0x00, 0xa0, 0x67, 0xed, 0x8b, 0x7b, 0x0c, 0x63, 0xec, 0x5a, 0xcc, 0x5a, 0x14, 0x05, 0x11, 0x08, 0x7a, 0x0b, 0x2a, 0x92, 0x94, 0x32, 0x00, 0x06, 0x6e, 0x00, 0x00, 0xe0, 0x00, 0x02, 0x50, 0x01, 0x02, 0x02, 0x00, 0xf0, 0x01, 0x88, 0xf5, 0x69, 0xed, 0x6a, 0xe5, 0x4a, 0xdd, 0x4a, 0xdd, 0xea, 0xcc, 0x67, 0xbc, 0x87, 0xc4, 0x02, 0x00, 0x73, 0xa7, 0xc4, 0xe8, 0xcc, 0x2b, 0xcd, 0x7c, 0x58, 0x01, 0x26, 0x77, 0xde, 0x2e, 0x00, 0x33, 0x27, 0xb4, 0x48, 0x64, 0x00, 0x04, 0x6a, 0x00, 0x3d, 0xaf, 0x73, 0x7a, 0xe6, 0x0b, 0x08, 0x6e, 0x00, 0x02, 0xe2, 0x00, 0x11, 0x0a, 0x16, 0x01, 0x0f, 0x02, 0x00, 0x09, 0x15, 0x14, 0x70, 0x0a, 0xc6, 0xb1, 0xcd, 0x4d, 0xcd, 0x4d, 0xcd, 0x0f, 0xbd, 0xf2, 0xa4, 0xd3, 0x9c, 0x02, 0x00, 0x6f, 0x35, 0xa5, 0xf7, 0xbd, 0x3c, 0xe7, 0xde, 0x01, 0x02, 0x3e, 0xff, 0x17, 0xff, 0x02, 0x00, 0x31, 0xd5, 0xfe, 0xb2, 0x7a, 0x00, 0x71, 0x4d, 0xfe, 0x6e, 0xfe, 0x4d, 0xfe, 0x4d, 0x08, 0x00, 0xbf, 0x6f, 0xfe, 0x0e, 0xee, 0x8c, 0xe5, 0x4b, 0xd5, 0x4c, 0xcd, 0x7d, 0x50, 0x0f, 0x5e, 0x0f, 0xc2, 0x10, 0x5b, 0x2f, 0x7d, 0xef, 0x6e, 0x00, 0x57, 0x2f, 0x7d, 0xef, 0x6e, 0x00, 0x5b, 0x1f, 0xdf, 0xea, 0x12, 0x56, 0x02, 0x88, 0x15, 0x2f, 0x7d, 0xef, 0xda, 0x00, 0x55, 0x02, 0xa2, 0x14, 0x1f, 0x5d, 0x70, 0x00, 0x50, 0x26, 0x5d, 0xef, 0xbe, 0x16, 0x3f, 0x3c, 0xe7, 0x9e, 0x44, 0x01, 0x4a, 0x2a, 0x3c, 0xe7, 0xce, 0x16, 0x5f, 0x5d, 0xef, 0x5d, 0xef, 0x9e, 0x6a, 0x00, 0x42, 0x26, 0x5d, 0xef, 0xd8, 0x00, 0x08, 0xa0, 0x17, 0x8f, 0x5d, 0xef, 0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xef, 0x02, 0x00, 0x35, 0x02, 0x4e, 0x00, 0x03, 0xd6, 0x00, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 
+};
+
+constexpr Escher::Image image = Escher::Image(55, 56, compressedPixelData, 1296, false);
+
+const Escher::Image * const ImageStore::InferenceIcon = &image;
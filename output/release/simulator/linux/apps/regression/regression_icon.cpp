@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "regression_icon.h"
+
+// Compressed 3080 pixels into 790 bytes (12.82% compression ratio)/
+const uint8_t compressedPixelData[790] = {0x19, 0xff, 0x01, 0x00, 0x4f, 0xdf, 0xff, 0xbe, 0xf7, 0x02, 0x00, 0x39, 0x2f, 0xdf, 0xff, 0x01, 0x00, 0x05, 0x2f, 0xbe, 0xf7, 0x02, 0x00, 0x45, 0x2f, 0xff, 0xff, 0xd4, 0x00, 0x4b, 0x0e, 0xe4, 0x00, 0x0f, 0x6c, 0x00, 0x57, 0x0a, 0x70, 0x00, 0x0f, 0x5e, 0x00, 0x41, 0x1e, 0x9e, 0x50, 0x01, 0x0f, 0x6c, 0x00, 0x46, 0x4e, 0x7a, 0xce, 0x16, 0x9d, 0xc0, 0x01, 0x0f, 0x46, 0x01, 0x43, 0x6f, 0xfc, 0xde, 0xb4, 0x8c, 0xdb, 0xd6, 0x6e, 0x00, 0x11, 0x2f, 0xab, 0x52, 0x6c, 0x00, 0x2d, 0x6f, 0x7d, 0xef, 0xf5, 0x94, 0x19, 0xbe, 0xbc, 0x01, 0x03, 0x0c, 0x12, 0x00, 0x2f, 0x08, 0x42, 0x6e, 0x00, 0x2d, 0x4f, 0x57, 0xa5, 0x77, 0xad, 0x2c, 0x00, 0x15, 0x0f, 0x6e, 0x00, 0x2d, 0x6f, 0x19, 0xbe, 0xf5, 0x9c, 0x7d, 0xef, 0x6e, 0x00, 0x53, 0x8f, 0xbb, 0xd6, 0xb4, 0x8c, 0x1c, 0xe7, 0xbe, 0xf7, 0x6e, 0x00, 0x51, 0x8f, 0x3d, 0xe7, 0xb5, 0x94, 0x7a, 0xce, 0xbe, 0xf7, 0x6e, 0x00, 0x51, 0x8f, 0x9e, 0xf7, 0x16, 0x9d, 0xb8, 0xb5, 0xbe, 0xf7, 0x6e, 0x00, 0x53, 0x6f, 0xb8, 0xb5, 0x36, 0xa5, 0x9e, 0xf7, 0x6e, 0x00, 0x53, 0x57, 0x5a, 0xc6, 0xd5, 0x94, 0x5d, 0x1e, 0x02, 0xaf, 0x16, 0xff, 0x0a, 0xfe, 0xc7, 0xfd, 0x0a, 0xfe, 0x16, 0xff, 0x6e, 0x00, 0x3f, 0x0c, 0xd0, 0x03, 0x44, 0x16, 0xff, 0xa6, 0xfd, 0x02, 0x00, 0x2f, 0x16, 0xff, 0x6e, 0x00, 0x3b, 0x00, 0xd0, 0x03, 0x28, 0x39, 0xc6, 0x12, 0x00, 0x26, 0x0a, 0xfe, 0x6e, 0x00, 0x2f, 0x0a, 0xfe, 0x6e, 0x00, 0x3b, 0x1d, 0x56, 0xd0, 0x03, 0x26, 0xc7, 0xfd, 0x6e, 0x00, 0x28, 0xc7, 0xfd, 0x98, 0x00, 0x0a, 0x02, 0x00, 0x4f, 0x08, 0x42, 0x7d, 0xef, 0x02, 0x00, 0x1b, 0x6a, 0xd8, 0xb5, 0xf5, 0x9c, 0x3c, 0xe7, 0x14, 0x00, 0x0a, 0xdc, 0x00, 0x0e, 0x3c, 0x00, 0x0f, 0x6e, 0x00, 0x25, 0x6c, 0x7a, 0xce, 0xb4, 0x8c, 0xdb, 0xde, 0x16, 0x00, 0x17, 0x37, 0xb8, 0x01, 0x2f, 0x37, 0xff, 0x6e, 0x00, 0x35, 0x6e, 0xfc, 0xde, 0xb4, 0x94, 0x5a, 0xc6, 0x18, 0x00, 0x33, 0x9e, 0xf7, 0x37, 0x94, 0x02, 0x4f, 0x37, 0xff, 0x9e, 0xf7, 0x6e, 0x00, 0x33, 0x6f, 0x3d, 0xe7, 0x15, 0x9d, 0xb8, 0xb5, 0x1c, 0x00, 0x03, 0x13, 0x9e, 0x3e, 0x07, 0x0f, 0x6c, 0x00, 0x09, 0x0a, 0x6e, 0x00, 0x22, 0xd5, 0xf6, 0xa0, 0x00, 0x2f, 0xd5, 0xf6, 0x2c, 0x00, 0x03, 0x5f, 0x77, 0xad, 0x36, 0xa5, 0x5d, 0xe6, 0x01, 0x1c, 0x0e, 0x6e, 0x00, 0x04, 0x6c, 0x00, 0x06, 0x7c, 0x01, 0x0f, 0x70, 0x00, 0x01, 0x7f, 0x39, 0xc6, 0xd5, 0x94, 0x1c, 0xe7, 0x7d, 0x6e, 0x00, 0x34, 0x0f, 0x58, 0x02, 0x0b, 0x8f, 0xbb, 0xd6, 0x94, 0x8c, 0xbb, 0xd6, 0x7d, 0xef, 0x6e, 0x00, 0x35, 0x0a, 0x34, 0x03, 0x0a, 0x26, 0x00, 0x6e, 0x1c, 0xe7, 0xd5, 0x94, 0x19, 0xbe, 0x6c, 0x00, 0x0f, 0xdc, 0x00, 0x41, 0x8f, 0x5d, 0xef, 0x36, 0xa5, 0x77, 0xad, 0x7d, 0xef, 0x6e, 0x00, 0x39, 0x0e, 0x34, 0x03, 0x08, 0xd0, 0x03, 0x2f, 0x3d, 0xe7, 0x6e, 0x00, 0x3b, 0x0e, 0x34, 0x03, 0x06, 0xd0, 0x03, 0x1d, 0xfb, 0xd0, 0x03, 0x0f, 0x6e, 0x00, 0x2d, 0x0f, 0x34, 0x03, 0x03, 0x00, 0xee, 0x05, 0x2f, 0x7a, 0xce, 0x6c, 0x00, 0x33, 0x0e, 0xde, 0x03, 0x0c, 0xd0, 0x03, 0x3e, 0xf5, 0x9c, 0xd8, 0xd0, 0x03, 0x0f, 0x6e, 0x00, 0x44, 0x0e, 0xd0, 0x03, 0x0f, 0x6e, 0x00, 0x47, 0x2e, 0x19, 0xbe, 0xd0, 0x03, 0x0f, 0x6e, 0x00, 0x45, 0x0e, 0xd0, 0x03, 0x0e, 0xe2, 0x04, 0x0f, 0x6e, 0x00, 0x35, 0x01, 0xd0, 0x03, 0x0e, 0xee, 0x05, 0x0e, 0xe2, 0x04, 0x0f, 0x6e, 0x00, 0x30, 0x0e, 0xd0, 0x03, 0x0f, 0x3a, 0x07, 0x1f, 0x00, 0x02, 0x00, 0x2a, 0xdb, 0xde, 0x02, 0x00, 0x4e, 0x08, 0x42, 0xdb, 0xde, 0x02, 0x00, 0x6e, 0x77, 0xad, 0xf5, 0x94, 0xba, 0xd6, 0x1a, 0x00, 0x00, 0x02, 0x00, 0x0a, 0xe2, 0x04, 0x2f, 0xdb, 0xde, 0x02, 0x00, 0x19, 0x0f, 0x6e, 0x00, 0x01, 0x20, 0xf8, 0xbd, 0x64, 0x03, 0x0f, 0x32, 0x00, 0x05, 0x0a, 0xdc, 0x00, 0x0f, 0x6e, 0x00, 0x2d, 0x6f, 0x79, 0xce, 0xb4, 0x8c, 0x18, 0xbe, 0x32, 0x00, 0x07, 0x0a, 0xce, 0x09, 0x0f, 0x6e, 0x00, 0x2b, 0x6f, 0xba, 0xd6, 0xd5, 0x94, 0x97, 0xad, 0x32, 0x00, 0x09, 0x26, 0x3c, 0xe7, 0xe2, 0x04, 0x2f, 0x3c, 0xe7, 0x6e, 0x00, 0x2b, 0x4e, 0x36, 0xa5, 0x16, 0x9d, 0x34, 0x00, 0x0c, 0x70, 0x00, 0x11, 0xdf, 0x2c, 0x10, 0x0f, 0x6c, 0x00, 0x1d, 0x0c, 0x6e, 0x00, 0x00, 0xa0, 0x07, 0x2f, 0x9a, 0xd6, 0x44, 0x00, 0x1d, 0x0f, 0x4a, 0x01, 0x29, 0x0f, 0x6c, 0x00, 0x47, 0x0f, 0x02, 0x03, 0x05, 0x0f, 0x6e, 0x00, 0xff, 0x22, 0x3f, 0x09, 0x42, 0x08, 0x02, 0x00, 0x38, 0x4f, 0x8b, 0x52, 0xdb, 0xde, 0x02, 0x00, 0x67, 0x2f, 0xba, 0xd6, 0x6c, 0x00, 0x57, 0x2f, 0x9a, 0xd6, 0xdc, 0x00, 0x5b, 0x4f, 0xff, 0xff, 0x59, 0xce, 0x6a, 0x00, 0x53, 0x20, 0x38, 0xc6, 0x52, 0x09, 0x1f, 0xfb, 0x4e, 0x01, 0x52, 0x42, 0x9a, 0xd6, 0xfb, 0xde, 0xc2, 0x09, 0x4f, 0x59, 0xce, 0xba, 0xd6, 0x6c, 0x00, 0x4d, 0x26, 0x59, 0xce, 0x7e, 0x15, 0x4f, 0x38, 0xc6, 0x38, 0xc6, 0x6c, 0x00, 0x47, 0x4a, 0x18, 0xc6, 0x38, 0xc6, 0x5a, 0x16, 0x6f, 0xfb, 0xde, 0x55, 0xad, 0x38, 0xc6, 0xae, 0x01, 0x41, 0x24, 0x55, 0xad, 0x44, 0x01, 0x0a, 0x01, 0x00, 0x9f, 0xdb, 0xde, 0xd7, 0xbd, 0x34, 0xa5, 0xf3, 0x9c, 0xd3, 0x02, 0x00, 0x32, 0x74, 0xf3, 0x9c, 0x34, 0xa5, 0xd7, 0xbd, 0xdb, 0x6a, 0x00, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 
+};
+
+constexpr Escher::Image image = Escher::Image(55, 56, compressedPixelData, 790, false);
+
+const Escher::Image * const ImageStore::RegressionIcon = &image;
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "press_to_test_success.h"
+
+// Compressed 169 pixels into 236 bytes (46.55% compression ratio)/
+const uint8_t compressedPixelData[236] = {0x11, 0xff, 0x01, 0x00, 0xe6, 0x79, 0xff, 0x6f, 0xfe, 0xe9, 0xfd, 0xc7, 0xfd, 0xe9, 0xfd, 0x6f, 0xfe, 0x79, 0xff, 0x01, 0x00, 0x48, 0xb1, 0xfe, 0xa6, 0xfd, 0x02, 0x00, 0x22, 0xb1, 0xfe, 0x18, 0x00, 0x1b, 0x90, 0x18, 0x00, 0x00, 0x02, 0x00, 0x6e, 0x90, 0xfe, 0xff, 0xff, 0x7a, 0xff, 0x18, 0x00, 0x00, 0x02, 0x00, 0x3b, 0x7a, 0xff, 0x8f, 0x32, 0x00, 0x31, 0x4c, 0xfe, 0x36, 0x2c, 0x00, 0x39, 0x6f, 0xfe, 0xe8, 0x18, 0x00, 0x33, 0xe8, 0xfd, 0xdd, 0x2c, 0x00, 0x13, 0xe9, 0x12, 0x00, 0x31, 0xd3, 0xfe, 0x2b, 0x10, 0x00, 0x33, 0x58, 0xff, 0x16, 0x5e, 0x00, 0x33, 0xc7, 0xfd, 0xe8, 0x8e, 0x00, 0x93, 0xdd, 0xff, 0x0a, 0xfe, 0xd2, 0xfe, 0x9b, 0xff, 0xc7, 0x2c, 0x00, 0x00, 0xc0, 0x00, 0x15, 0xa6, 0x1c, 0x00, 0x35, 0xde, 0xff, 0x0a, 0x76, 0x00, 0x00, 0xd8, 0x00, 0x04, 0x0c, 0x00, 0x37, 0xb2, 0xfe, 0xb0, 0x8e, 0x00, 0x1e, 0x79, 0xe8, 0x00, 0x09, 0xec, 0x00, 0x0f, 0x04, 0x01, 0x05, 0x0f, 0x38, 0x01, 0x05, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x3c, 0xa7, 0xe4, 0xf9, 0xe4, 0xa7, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x95, 0x17, 0x00, 0x55, 0x95, 0x05, 0x00, 0x00, 0x9b, 0x39, 0x00, 0x37, 0x9b, 0x00, 0x3b, 0x67, 0x01, 0x27, 0x3b, 0xa6, 0x0d, 0x00, 0x27, 0xa7, 0xe8, 0x0d, 0x00, 0x27, 0xe5, 0xff, 0x01, 0x00, 0x19, 0xf9, 0x1a, 0x00, 0x18, 0xa7, 0x34, 0x00, 0x17, 0x3c, 0x0d, 0x00, 0x35, 0x3c, 0x00, 0x94, 0x0c, 0x00, 0x48, 0x94, 0x00, 0x00, 0x05, 0x82, 0x00, 0x00, 0x9c, 0x00, 0x80, 0xe5, 0xf9, 0xe5, 0xa7, 0x3c, 0x00, 0x00, 0x00, 
+};
+
+constexpr Escher::Image image = Escher::Image(13, 13, compressedPixelData, 236, true);
+
+const Escher::Image * const ImageStore::PressToTestSuccess = &image;
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "solver_icon.h"
+
+// Compressed 3080 pixels into 1506 bytes (24.45% compression ratio)/
+const uint8_t compressedPixelData[1506] = {0x15, 0xff, 0x01, 0x00, 0x6f, 0x9a, 0xd6, 0xcb, 0x5a, 0xe8, 0x39, 0x02, 0x00, 0x3d, 0x5b, 0xcb, 0x5a, 0x9a, 0xd6, 0xff, 0x01, 0x00, 0x6f, 0xbe, 0xf7, 0xab, 0x52, 0x08, 0x42, 0x02, 0x00, 0x45, 0x46, 0xab, 0x52, 0xbe, 0xf7, 0x6c, 0x00, 0x6f, 0x1c, 0xe7, 0xe8, 0x39, 0x08, 0x42, 0x02, 0x00, 0x49, 0x44, 0xe8, 0x39, 0x1c, 0xe7, 0xd8, 0x00, 0x0f, 0x6c, 0x00, 0x4d, 0x02, 0x70, 0x00, 0x02, 0xe0, 0x00, 0x0f, 0x44, 0x01, 0x0d, 0xff, 0x0a, 0x29, 0x73, 0x89, 0xb4, 0x28, 0xdd, 0x66, 0xed, 0x84, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x84, 0xfd, 0x85, 0xf5, 0x47, 0xe5, 0xa9, 0xbc, 0x8a, 0x83, 0x09, 0x50, 0x01, 0x1e, 0x00, 0x1c, 0x02, 0x0f, 0x20, 0x00, 0x07, 0x60, 0x49, 0x4a, 0x69, 0xb4, 0x66, 0xf5, 0x62, 0x00, 0x55, 0xa4, 0xfd, 0xa4, 0xfd, 0xa5, 0x02, 0x00, 0x20, 0xa4, 0xfd, 0x7a, 0x00, 0x6f, 0x85, 0xf5, 0xc9, 0xc4, 0xa9, 0x5a, 0x70, 0x00, 0x19, 0x00, 0x88, 0x02, 0x0f, 0xd2, 0x00, 0x04, 0xf1, 0x0d, 0x42, 0x69, 0xac, 0x84, 0xfd, 0x84, 0xfd, 0xa5, 0xfd, 0xc6, 0xfd, 0xc6, 0xfd, 0xc7, 0xfd, 0xa9, 0xf5, 0x8a, 0xe5, 0x4b, 0xd5, 0x4b, 0xd5, 0x6a, 0xdd, 0xa9, 0xed, 0xc7, 0x14, 0x00, 0x20, 0xa5, 0xfd, 0x20, 0x00, 0x4f, 0xc9, 0xc4, 0x69, 0x4a, 0x6e, 0x00, 0x15, 0x2f, 0xcb, 0x5a, 0xb4, 0x01, 0x03, 0x71, 0xe9, 0x62, 0x66, 0xed, 0x83, 0xfd, 0xa5, 0x68, 0x00, 0x86, 0x4b, 0xd5, 0x2c, 0x9c, 0xeb, 0x5a, 0xab, 0x52, 0x02, 0x00, 0x73, 0xcb, 0x5a, 0xec, 0x8b, 0x2b, 0xcd, 0xc8, 0x72, 0x00, 0x4f, 0x85, 0xf5, 0x8a, 0x83, 0xd2, 0x01, 0x29, 0x20, 0xa9, 0x8b, 0x3c, 0x01, 0x00, 0x6a, 0x00, 0x48, 0x0c, 0xc5, 0x0b, 0x63, 0x68, 0x00, 0x0a, 0x74, 0x00, 0x24, 0xac, 0xb4, 0x72, 0x00, 0x2f, 0x6a, 0xac, 0x6c, 0x00, 0x25, 0x22, 0xe9, 0x9b, 0x6c, 0x00, 0x4e, 0x8a, 0xe5, 0x4b, 0x73, 0x6a, 0x00, 0x0a, 0x02, 0x00, 0x40, 0xeb, 0x62, 0x4b, 0xd5, 0x70, 0x00, 0x4f, 0x83, 0xfd, 0xa9, 0xbc, 0xd8, 0x00, 0x25, 0x00, 0x42, 0x01, 0x4f, 0x0c, 0xc5, 0xab, 0x52, 0x02, 0x00, 0x13, 0x7f, 0x8c, 0xac, 0xc7, 0xfd, 0xc5, 0xfd, 0x83, 0xe0, 0x00, 0x20, 0x22, 0xc9, 0x62, 0xd8, 0x00, 0x4f, 0xcc, 0xbc, 0xab, 0x52, 0x02, 0x00, 0x17, 0x31, 0x2c, 0x9c, 0xc7, 0xe0, 0x00, 0x2f, 0xaa, 0x8b, 0x6e, 0x00, 0x1b, 0x3f, 0x67, 0xed, 0x84, 0xd8, 0x00, 0x1a, 0x04, 0x02, 0x00, 0x20, 0x6c, 0xa4, 0x50, 0x01, 0x3f, 0x85, 0xf5, 0x89, 0x00, 0x05, 0x18, 0xaf, 0x49, 0xa4, 0x83, 0xfd, 0xc6, 0xfd, 0xaa, 0xe5, 0xab, 0x52, 0x02, 0x00, 0x1f, 0x8f, 0x2b, 0xcd, 0xc6, 0xfd, 0x84, 0xfd, 0xe9, 0xcc, 0x6c, 0x00, 0x16, 0x9f, 0x4a, 0x85, 0xfd, 0xa5, 0xfd, 0xc7, 0xfd, 0x4c, 0x73, 0x6e, 0x00, 0x21, 0x40, 0xcb, 0x5a, 0xc8, 0xf5, 0x70, 0x00, 0x2f, 0x0a, 0x6b, 0x6e, 0x00, 0x14, 0x2f, 0xac, 0x83, 0x46, 0x01, 0x22, 0x04, 0x02, 0x00, 0x8f, 0x4c, 0x9c, 0xc6, 0xfd, 0xa4, 0xfd, 0x09, 0xcd, 0x6e, 0x00, 0x13, 0x6e, 0x66, 0xed, 0xa4, 0xfd, 0xc7, 0xfd, 0x60, 0x03, 0x0f, 0x02, 0x00, 0x17, 0x20, 0xa8, 0xf5, 0x7c, 0x03, 0x0e, 0x5c, 0x04, 0x0e, 0xa2, 0x05, 0x20, 0x66, 0x5a, 0xda, 0x00, 0x22, 0x4b, 0xd5, 0x38, 0x00, 0x20, 0x39, 0xc6, 0xb0, 0x05, 0x15, 0xaf, 0x54, 0x01, 0x20, 0x11, 0x84, 0x10, 0x00, 0x2f, 0x55, 0xad, 0x4e, 0x01, 0x0c, 0x11, 0xbc, 0x4c, 0x01, 0x1f, 0x9c, 0x6e, 0x00, 0x0d, 0x31, 0xc7, 0x39, 0x08, 0x22, 0x02, 0x22, 0x4c, 0x9c, 0x38, 0x00, 0x91, 0x0c, 0x63, 0x7d, 0xef, 0xff, 0xff, 0x3c, 0xe7, 0xec, 0xb2, 0x04, 0x8f, 0xec, 0x5a, 0x5d, 0xef, 0xff, 0xff, 0xfb, 0xde, 0x2a, 0x02, 0x0e, 0x11, 0x6b, 0x4c, 0x01, 0x1f, 0xd5, 0x6e, 0x00, 0x0f, 0x20, 0x07, 0xd5, 0x68, 0x03, 0x24, 0xeb, 0x62, 0x3a, 0x00, 0x20, 0xf0, 0x7b, 0xce, 0x00, 0x20, 0xd7, 0xbd, 0x0c, 0x00, 0x8f, 0xb7, 0xb5, 0xff, 0xff, 0xdf, 0xff, 0x6e, 0x6b, 0x4c, 0x01, 0x13, 0x2f, 0x86, 0xf5, 0x6e, 0x00, 0x0d, 0x20, 0xa7, 0x31, 0xb6, 0x01, 0x28, 0xa9, 0xf5, 0x3a, 0x00, 0x20, 0x76, 0xad, 0x70, 0x00, 0x40, 0xf0, 0x7b, 0xaf, 0x73, 0x08, 0x00, 0x13, 0xf4, 0xf6, 0x00, 0x00, 0xa6, 0x06, 0x0e, 0x01, 0x00, 0x04, 0x1c, 0x00, 0x20, 0x6a, 0xdd, 0x4c, 0x01, 0x1f, 0x29, 0x6e, 0x00, 0x0e, 0x00, 0xb0, 0x04, 0x2a, 0x8a, 0xe5, 0xd4, 0x02, 0x80, 0xfb, 0xde, 0xff, 0xff, 0x5d, 0xef, 0xfb, 0xde, 0x06, 0x07, 0x2f, 0xab, 0x52, 0x6e, 0x00, 0x11, 0x8f, 0x0b, 0xc5, 0xc6, 0xfd, 0x83, 0xfd, 0xea, 0x62, 0x6e, 0x00, 0x0b, 0x20, 0xa6, 0x31, 0x60, 0x06, 0x2a, 0x6b, 0xd5, 0x18, 0x01, 0x33, 0x6e, 0x6b, 0xdf, 0x4c, 0x08, 0x2f, 0x4d, 0x6b, 0x96, 0x02, 0x13, 0x20, 0xcc, 0xbc, 0x6e, 0x00, 0x2f, 0x2a, 0x73, 0xdc, 0x00, 0x0d, 0x00, 0x6e, 0x00, 0x1b, 0x4b, 0x6e, 0x00, 0x31, 0x2d, 0x63, 0x9e, 0x4c, 0x08, 0x2f, 0x79, 0xce, 0xe4, 0x03, 0x16, 0x10, 0xb4, 0x6e, 0x00, 0x2f, 0x4a, 0x7b, 0x4a, 0x01, 0x11, 0x2a, 0x6b, 0xdd, 0x3c, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x70, 0x00, 0x2f, 0xb3, 0x94, 0x4a, 0x01, 0x13, 0x11, 0xeb, 0xdc, 0x00, 0x0e, 0x50, 0x04, 0x0c, 0x94, 0x02, 0x68, 0x85, 0xf5, 0xa4, 0xfd, 0xa9, 0xed, 0x6c, 0x00, 0x20, 0x14, 0xa5, 0x48, 0x00, 0x4a, 0x8e, 0x73, 0x59, 0xce, 0x92, 0x02, 0x0f, 0x6e, 0x00, 0x09, 0x20, 0x4b, 0xd5, 0x6e, 0x00, 0x0e, 0x9c, 0x05, 0x0c, 0xde, 0x03, 0x20, 0x47, 0xe5, 0x4a, 0x04, 0x06, 0x6c, 0x00, 0x20, 0xaf, 0x73, 0xb4, 0x01, 0x20, 0x76, 0xad, 0x7c, 0x03, 0x20, 0x9e, 0xf7, 0x74, 0x0a, 0x2f, 0xcb, 0x5a, 0x4a, 0x01, 0x0f, 0x6f, 0xa9, 0xed, 0xa5, 0xfd, 0x85, 0xfd, 0xb8, 0x04, 0x0f, 0x20, 0x88, 0xbc, 0x6c, 0x06, 0x24, 0xac, 0x7b, 0x90, 0x02, 0x00, 0x6e, 0x0a, 0x13, 0x3c, 0x62, 0x00, 0x26, 0x31, 0x84, 0x7c, 0x03, 0x0f, 0x9a, 0x05, 0x0b, 0x00, 0xe8, 0x06, 0x2f, 0x48, 0xe5, 0x6e, 0x00, 0x0f, 0x20, 0x68, 0x83, 0x4c, 0x04, 0x13, 0xec, 0x46, 0x07, 0x2a, 0xb7, 0xb5, 0xba, 0x04, 0x02, 0x7c, 0x03, 0x2f, 0x72, 0x8c, 0x56, 0x07, 0x0d, 0x00, 0x4c, 0x04, 0x1f, 0xaa, 0x34, 0x08, 0x10, 0x20, 0xa6, 0x39, 0x28, 0x02, 0x22, 0xa9, 0xf5, 0x8c, 0x02, 0x55, 0xf8, 0xbd, 0xf8, 0xbd, 0xd3, 0xd0, 0x03, 0x02, 0x80, 0x00, 0x4f, 0xf8, 0xbd, 0xb7, 0xb5, 0x4e, 0x01, 0x0b, 0x2f, 0x6a, 0xdd, 0x24, 0x02, 0x11, 0x02, 0x28, 0x02, 0x20, 0xc8, 0xcc, 0x4c, 0x01, 0x2f, 0x2c, 0x9c, 0x02, 0x06, 0x25, 0x20, 0x4b, 0x73, 0xc0, 0x07, 0x2f, 0x67, 0xed, 0x72, 0x06, 0x13, 0x30, 0x86, 0x5a, 0x83, 0xde, 0x00, 0x1f, 0xed, 0x6e, 0x00, 0x25, 0x2f, 0x4a, 0xdd, 0x02, 0x06, 0x13, 0x03, 0x6e, 0x00, 0x4f, 0x31, 0x07, 0xd5, 0x84, 0x02, 0x09, 0x1e, 0x04, 0x02, 0x00, 0x20, 0x0c, 0x94, 0xda, 0x00, 0x3f, 0x66, 0xed, 0x29, 0x86, 0x0c, 0x16, 0x31, 0x06, 0x4a, 0x84, 0x2c, 0x08, 0x2f, 0xcc, 0x8b, 0x96, 0x08, 0x1e, 0x40, 0x6b, 0xc8, 0xf5, 0xc6, 0x76, 0x09, 0x0f, 0x36, 0x0b, 0x18, 0xbf, 0x86, 0x31, 0xe8, 0x9b, 0x83, 0xfd, 0xc5, 0xfd, 0xc8, 0xf5, 0x6c, 0x9c, 0x08, 0x1a, 0x4f, 0xeb, 0x62, 0xa8, 0xf5, 0x04, 0x09, 0x1b, 0x02, 0x02, 0x00, 0x40, 0x45, 0x29, 0xe8, 0xcc, 0x0a, 0x03, 0x4f, 0xc8, 0xf5, 0x8c, 0x7b, 0x6c, 0x00, 0x15, 0x40, 0x0b, 0x63, 0xc7, 0xfd, 0x6c, 0x00, 0x4f, 0x67, 0xed, 0x49, 0x4a, 0xd4, 0x0d, 0x1d, 0x51, 0x65, 0x29, 0x27, 0xdd, 0x84, 0x04, 0x0c, 0x1f, 0x4c, 0x9e, 0x02, 0x12, 0x40, 0xac, 0x83, 0xc8, 0xf5, 0x66, 0x03, 0x5f, 0x83, 0xfd, 0x04, 0xe5, 0x48, 0x4e, 0x0f, 0x1e, 0x62, 0xc7, 0x39, 0x65, 0x31, 0x07, 0xdd, 0xe0, 0x0c, 0x4f, 0x6b, 0xd5, 0x2b, 0x6b, 0x42, 0x01, 0x0b, 0x22, 0x0b, 0xc5, 0xd8, 0x00, 0x11, 0x83, 0x02, 0x00, 0x2f, 0xe4, 0xdc, 0x70, 0x00, 0x1f, 0x73, 0xc8, 0x39, 0x65, 0x29, 0x88, 0xbc, 0x83, 0xe6, 0x0c, 0x4f, 0x4b, 0xcd, 0xac, 0x83, 0x5e, 0x03, 0x03, 0x02, 0x6a, 0x00, 0x00, 0x92, 0x0b, 0x4f, 0x08, 0xd5, 0x64, 0xc4, 0x70, 0x00, 0x26, 0x00, 0x82, 0x09, 0x34, 0x29, 0x07, 0x73, 0xc2, 0x0d, 0xf5, 0x08, 0xc6, 0xfd, 0xa9, 0xf5, 0x4b, 0xd5, 0xac, 0xb4, 0x0c, 0x94, 0xac, 0x83, 0xac, 0x83, 0x0c, 0x94, 0x8c, 0xac, 0x2b, 0xcd, 0xa9, 0xed, 0xc6, 0xbe, 0x0d, 0x8f, 0xc8, 0x93, 0x24, 0x21, 0x44, 0x29, 0x44, 0xbc, 0x70, 0x00, 0x27, 0x01, 0x84, 0x06, 0x61, 0x31, 0x08, 0xa4, 0x85, 0xf5, 0x83, 0x04, 0x0f, 0x1b, 0xc6, 0x02, 0x00, 0x11, 0xa5, 0xaa, 0x01, 0xff, 0x01, 0x85, 0xfd, 0x88, 0xb4, 0xc5, 0x39, 0x86, 0x31, 0xc8, 0x39, 0xa6, 0x31, 0x44, 0x29, 0x64, 0xcc, 0x70, 0x00, 0x29, 0x00, 0x64, 0x07, 0x60, 0x65, 0x29, 0x47, 0x7b, 0xe8, 0xcc, 0x74, 0x00, 0x0a, 0x02, 0x00, 0xa4, 0x84, 0xfd, 0x27, 0xdd, 0xa8, 0x93, 0xa6, 0x31, 0xa7, 0x31, 0xdc, 0x0e, 0x0b, 0x70, 0x00, 0x0f, 0x9e, 0x02, 0x1c, 0x06, 0xe4, 0x00, 0xf0, 0x07, 0x66, 0x29, 0x24, 0x21, 0x26, 0x4a, 0x27, 0x7b, 0xe8, 0x9b, 0x28, 0xac, 0x28, 0xac, 0xe8, 0x9b, 0x68, 0x83, 0x66, 0x52, 0x65, 0x29, 0xd2, 0x00, 0x0c, 0x9c, 0x00, 0x06, 0x70, 0x00, 0x2f, 0xc4, 0xd4, 0x70, 0x00, 0x25, 0x02, 0x74, 0x00, 0xce, 0xa7, 0x31, 0xa6, 0x31, 0x86, 0x31, 0x86, 0x31, 0xa7, 0x31, 0xc7, 0x39, 0x60, 0x11, 0x0f, 0x70, 0x00, 0x3d, 0x0e, 0x7c, 0x01, 0x0f, 0x70, 0x00, 0xfd, 0x2f, 0xe8, 0x39, 0x70, 0x00, 0x4b, 0x28, 0x85, 0xcc, 0x6c, 0x00, 0x2f, 0xc8, 0x39, 0xe0, 0x00, 0x4d, 0x08, 0x6e, 0x00, 0x2f, 0xeb, 0x5a, 0x50, 0x01, 0x43, 0xa6, 0xa6, 0x31, 0x64, 0x31, 0x44, 0xc4, 0x83, 0xfd, 0x84, 0x9b, 0x14, 0x00, 0x6f, 0xeb, 0x5a, 0xfb, 0xde, 0xe8, 0x39, 0x70, 0x00, 0x45, 0x6a, 0x65, 0x29, 0x24, 0x21, 0x86, 0x31, 0xa4, 0x14, 0x0f, 0xde, 0x00, 0x45, 0x0c, 0x02, 0x00, 0x40, 0xec, 0x5a, 0xff, 0xff, 0x76, 0x0b, 0x1f, 0xe7, 0x0e, 0x15, 0x50, 0x22, 0xe7, 0x39, 0x30, 0x0d, 0x00, 0xa4, 0x0d, 0x1f, 0xc7, 0x70, 0x00, 0x4c, 0x48, 0xc7, 0x39, 0x5d, 0xef, 0xc6, 0x16, 0x4f, 0xec, 0x5a, 0xa7, 0x31, 0x80, 0x03, 0x45, 0x4c, 0xec, 0x5a, 0xbe, 0xf7, 0xa8, 0x0c, 0x9f, 0xfb, 0xde, 0x0c, 0x63, 0xa7, 0x31, 0x86, 0x31, 0xa6, 0x02, 0x00, 0x36, 0x60, 0x86, 0x31, 0xc7, 0x39, 0x2c, 0x63, 0xdc, 0x0e, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+};
+
+constexpr Escher::Image image = Escher::Image(55, 56, compressedPixelData, 1506, false);
+
+const Escher::Image * const ImageStore::SolverIcon = &image;